@@ -161,6 +161,15 @@
 	#define ELECTRODES_SENSE_PERIOD   30
 #endif
 
+/*******************************************************************************
+* Modify: Keypad sensor group scan period in electrodes sensing cycles (TS_SENSOR_GROUPS)
+*         Touch button electrodes are scanned every KEYPAD_SCAN_PERIOD_IDLE sensing cycles
+*         while not touched, every KEYPAD_SCAN_PERIOD_ACTIVE sensing cycles while touched.
+*         Value from 1 to 255. DC tracker and IIR filter run once per group scan.
+******************************************************************************/
+#define KEYPAD_SCAN_PERIOD_IDLE     1
+#define KEYPAD_SCAN_PERIOD_ACTIVE   1
+
 /*******************************************************************************
 * Modify: Define filter parameters.
 *         Coefficients B0, B1 and A0 are dependent on filter cutoff frequency [Hz]
@@ -256,6 +265,8 @@
 	#define ELEC0_TOUCH_THRESHOLD_DELTA       ELEC_TOUCH_THRESHOLD_DELTA
 	// Electrode release threshold relative to DC tracker value
 	#define ELEC0_RELEASE_THRESHOLD_DELTA     ELEC_RELEASE_THRESHOLD_DELTA
+	// Neighbour electrodes scanned every period together with the touched electrode (bit per electrode)
+	#define ELEC0_ROI_NEIGHBOURS              (1 << 1)
 #endif
 
 /*******************************************************************************
@@ -266,6 +277,7 @@
 	#define ELEC1_LPFILTER_TYPE               FILTER_1
 	#define ELEC1_TOUCH_THRESHOLD_DELTA       ELEC_TOUCH_THRESHOLD_DELTA
 	#define ELEC1_RELEASE_THRESHOLD_DELTA     ELEC_RELEASE_THRESHOLD_DELTA
+	#define ELEC1_ROI_NEIGHBOURS              (1 << 0)
 #endif
 
 /*******************************************************************************
@@ -71,6 +71,21 @@
 	#define ELEC1_PORT_MASK       (1 << ELEC1_ELEC_GPIO_PIN) | (1 << ELEC1_CEXT_GPIO_PIN)
 #endif
 
+/*******************************************************************************
+* Modify: Touch button electrodes dual ADC conversion
+******************************************************************************/
+// YES (DUAL_ADC_CONVERSION_ON) or NO (DUAL_ADC_CONVERSION_OFF) optional dual ADC conversion
+// If ON, each touch button electrode with Cext on ADC0 is paired with a touch button electrode with Cext on ADC1
+// and both electrodes of the pair are converted at the same time, electrodes left without pair are converted one by one
+#define DUAL_ADC_CONVERSION   DUAL_ADC_CONVERSION_OFF
+
+#if DUAL_ADC_CONVERSION
+	#ifndef ADC_SAMPLE_TIME
+		// ADC sample time adjustment
+		#define ADC_SAMPLE_TIME 14
+	#endif
+#endif
+
 #endif
 
 #endif /* CFG_2PAD_EVB_2PAD_HW_H_ */
@@ -170,6 +170,15 @@
 	#endif
 #endif
 
+/*******************************************************************************
+* Modify: Keypad sensor group scan period in electrodes sensing cycles (TS_SENSOR_GROUPS)
+*         Touch button electrodes are scanned every KEYPAD_SCAN_PERIOD_IDLE sensing cycles
+*         while not touched, every KEYPAD_SCAN_PERIOD_ACTIVE sensing cycles while touched.
+*         Value from 1 to 255. DC tracker and IIR filter run once per group scan.
+******************************************************************************/
+#define KEYPAD_SCAN_PERIOD_IDLE     1
+#define KEYPAD_SCAN_PERIOD_ACTIVE   1
+
 /*******************************************************************************
 * Modify: Define filter parameters.
 *         Coefficients B0, B1 and A0 are dependent on filter cutoff frequency [Hz]
@@ -342,6 +351,8 @@
 	#define ELEC0_TOUCH_THRESHOLD_DELTA       ELEC_TOUCH_THRESHOLD_DELTA
 	// Electrode release threshold relative to DC tracker value
 	#define ELEC0_RELEASE_THRESHOLD_DELTA     ELEC_RELEASE_THRESHOLD_DELTA
+	// Neighbour electrodes scanned every period together with the touched electrode (bit per electrode)
+	#define ELEC0_ROI_NEIGHBOURS              (1 << 1)
 #endif
 
 /*******************************************************************************
@@ -352,6 +363,7 @@
 	#define ELEC1_LPFILTER_TYPE               FILTER_1
 	#define ELEC1_TOUCH_THRESHOLD_DELTA       ELEC_TOUCH_THRESHOLD_DELTA
 	#define ELEC1_RELEASE_THRESHOLD_DELTA     ELEC_RELEASE_THRESHOLD_DELTA
+	#define ELEC1_ROI_NEIGHBOURS              ((1 << 0) | (1 << 2))
 #endif
 
 /*******************************************************************************
@@ -362,6 +374,7 @@
 	#define ELEC2_LPFILTER_TYPE               FILTER_1
 	#define ELEC2_TOUCH_THRESHOLD_DELTA       ELEC_TOUCH_THRESHOLD_DELTA
 	#define ELEC2_RELEASE_THRESHOLD_DELTA     ELEC_RELEASE_THRESHOLD_DELTA
+	#define ELEC2_ROI_NEIGHBOURS              ((1 << 1) | (1 << 3))
 #endif
 
 /*******************************************************************************
@@ -372,6 +385,7 @@
 	#define ELEC3_LPFILTER_TYPE               FILTER_1
 	#define ELEC3_TOUCH_THRESHOLD_DELTA       ELEC_TOUCH_THRESHOLD_DELTA
 	#define ELEC3_RELEASE_THRESHOLD_DELTA     ELEC_RELEASE_THRESHOLD_DELTA
+	#define ELEC3_ROI_NEIGHBOURS              ((1 << 2) | (1 << 4))
 #endif
 
 /*******************************************************************************
@@ -382,6 +396,7 @@
 	#define ELEC4_LPFILTER_TYPE               FILTER_1
 	#define ELEC4_TOUCH_THRESHOLD_DELTA       ELEC_TOUCH_THRESHOLD_DELTA
 	#define ELEC4_RELEASE_THRESHOLD_DELTA     ELEC_RELEASE_THRESHOLD_DELTA
+	#define ELEC4_ROI_NEIGHBOURS              ((1 << 3) | (1 << 5))
 #endif
 
 /*******************************************************************************
@@ -392,6 +407,7 @@
 	#define ELEC5_LPFILTER_TYPE               FILTER_1
 	#define ELEC5_TOUCH_THRESHOLD_DELTA       ELEC_TOUCH_THRESHOLD_DELTA
 	#define ELEC5_RELEASE_THRESHOLD_DELTA     ELEC_RELEASE_THRESHOLD_DELTA
+	#define ELEC5_ROI_NEIGHBOURS              ((1 << 4) | (1 << 6))
 #endif
 
 /*******************************************************************************
@@ -402,6 +418,7 @@
 	#define ELEC6_LPFILTER_TYPE               FILTER_1
 	#define ELEC6_TOUCH_THRESHOLD_DELTA       ELEC_TOUCH_THRESHOLD_DELTA
 	#define ELEC6_RELEASE_THRESHOLD_DELTA     ELEC_RELEASE_THRESHOLD_DELTA
+	#define ELEC6_ROI_NEIGHBOURS              (1 << 5)
 #endif
 
 /*******************************************************************************
@@ -410,6 +427,7 @@
 #ifdef ELEC7
 	#define ELEC7_DCTRACKER_FILTER_FACTOR     5
 	#define ELEC7_LPFILTER_TYPE               FILTER_2
+	#define ELEC7_ROI_NEIGHBOURS              0
 
 	#if(TS_RAW_DATA_CALCULATION == AVERAGING)
 		// Electrode touch threshold relative to DC tracker value
@@ -12,6 +12,38 @@
 #ifndef __ADC_H
 #define __ADC_H
 
+/*******************************************************************************
+* ADC sample time for SW triggered conversion (default)
+******************************************************************************/
+#define ADC_SAMPLE_TIME_SW   14
+
+/*******************************************************************************
+* ADC0 internal temperature sensor channel and its sample time (max, ADCK cycles)
+******************************************************************************/
+#define ADC_CH_TEMP_SENSOR            26
+#define ADC_SAMPLE_TIME_TEMP_SENSOR   255
+
+/*******************************************************************************
+* ADC CFG1 MODE field value for selected resolution (8-bit 0, 12-bit 1, 10-bit 2)
+******************************************************************************/
+#define ADC_CFG1_MODE_RESOLUTION(res)   (((res) == ADC_RESOLUTION_8BIT) ? 0 : (((res) == ADC_RESOLUTION_10BIT) ? 2 : 1))
+
+/*******************************************************************************
+* ADC calibration result (gain and plus-side calibration values)
+******************************************************************************/
+typedef struct
+{
+	uint32_t  G;
+	uint32_t  CLPS;
+	uint32_t  CLP3;
+	uint32_t  CLP2;
+	uint32_t  CLP1;
+	uint32_t  CLP0;
+	uint32_t  CLPX;
+	uint32_t  CLP9;
+}
+tAdcCal;
+
 /*******************************************************************************
 * Function prototypes
 ******************************************************************************/
@@ -19,9 +51,15 @@ void ADC0_Init(uint32_t sampleTime, uint32_t avgSel, uint8_t clkMode);
 void ADC1_Init(uint32_t sampleTime, uint32_t avgSel, uint8_t clkMode);
 void ADCs_SimultaneousHWtrigger(void);
 void ADCs_SetBackToSWtrigger(void);
-int16_t ADC0_Calibration(void);
-int16_t ADC1_Calibration(void);
+void ADC_CalibrationStart(ADC_Type *adcPtr);
+int16_t ADC_CalibrationWait(ADC_Type *adcPtr);
 void ClearADCsGain(void);
 void SetADCsGain(void);
+void ADCs_SleepWaitEnable(void);
+void ADCs_SleepWaitDisable(void);
+void ADCs_ResolutionSet(uint8_t resolution);
+int32_t ADC0_TempSensorConvert(uint32_t samplesNum);
+void ADC_CalibrationSave(ADC_Type *adcPtr, tAdcCal *calPtr);
+int16_t ADC_CalibrationLoad(ADC_Type *adcPtr, const tAdcCal *calPtr);
 
 #endif /* __ADC_H */
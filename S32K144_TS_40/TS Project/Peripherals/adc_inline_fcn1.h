@@ -17,6 +17,197 @@
 *******************************************************************************/
 #include "ets.h"
 #include "S32K144.h"
+#include "main.h"
+#include "gpio_inline_fcn1.h"
+
+#ifdef DEBUG_SCAN_TIMING
+// ADC conversion complete wait cycles
+extern uint32_t scanTimingWaitCycles;
+#if (ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP)
+// Core wake-ups while waiting for ADC conversion complete
+extern uint32_t scanTimingWakeups;
+#endif
+#endif
+
+/*****************************************************************************
+*
+* Function: static inline void ConversionCompletePendingClear(void)
+*
+* Description: Clear ADC interrupts pending flags before core sleeps, so that
+* 				ADC conversion complete sets them and wakes the core (SEVONPEND)
+*
+*****************************************************************************/
+#if (ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP)
+static inline void ConversionCompletePendingClear(void)
+{
+	// Clear pending flags left by the previous conversion, COCO set meanwhile sets them again
+	NVIC_IRQ_CLEAR_PENDING(ADC0_IRQn);
+	NVIC_IRQ_CLEAR_PENDING(ADC1_IRQn);
+}
+#endif
+
+/*****************************************************************************
+*
+* Function: static inline void ConversionStartChargeRedistribution(tElecStruct *pElectrodeStruct)
+*
+* Input: Address of a single electrode structure in electrodes structure array
+*
+* Description: Start Cext voltage ADC conversion and redistribute Electrode and Cext charge
+*
+*****************************************************************************/
+static inline void ConversionStartChargeRedistribution(tElecStruct *pElectrodeStruct)
+{
+	// If compiler optimization is not -O3 (is set to none -> -O0), then set TS_ASM_OPTIMIZE macro to 1 in ts_cfg.h
+#if(TS_ASM_OPTIMIZE == 1)
+	asm volatile (
+			/***** ASSEMBLY TEMPLATE ****************************************/
+			// Start Cext voltage ADC conversion
+			"str %1, [%0, #0]\n\t"    // store %1 to address in %0 with 0 byte offset
+			// Redistribute Electrode and Cext charge
+			"str %3, [%2, #0]"        // store %3 to address in %2 with 0 byte offset
+			/***** LIST OF OUTPUT OPERANDS **********************************/
+			:
+			/***** LIST OF INPUT OPERANDS ***********************************/
+			:  "r" (&pElectrodeStruct->adcBasePtr->SC1[0]),  // operand %0
+			   "r" (pElectrodeStruct->adcChNum),             // operand %1
+			   "r" (&pElectrodeStruct->gpioBasePtr->PDDR),   // operand %2
+			   "r" ((pElectrodeStruct->gpioBasePtr->PDDR) & ~(pElectrodeStruct->portMask))    // operand %3
+	);
+#else
+	// Start Cext voltage ADC conversion
+	pElectrodeStruct->adcBasePtr->SC1[0] = pElectrodeStruct->adcChNum;
+
+	// Redistribute Electrode and Cext charge
+	ChargeRedistribution(pElectrodeStruct);
+#endif
+}
+
+#if(TS_ASM_OPTIMIZE == 1)
+/*****************************************************************************
+*
+* Conversion kernel parameters, offsets are fixed in ConversionKernelRun()
+*
+*****************************************************************************/
+typedef struct
+{
+	volatile uint32_t *pddr0Ptr;        // 0: first distribution stage PDDR address
+	uint32_t  pddr0Distribute;          // 4: first stage pins outputs
+	uint32_t  pddr0Redistribute;        // 8: first stage pins inputs
+	volatile uint32_t *pddr1Ptr;        // 12: second distribution stage PDDR address
+	uint32_t  pddr1Distribute;          // 16: second stage pins outputs
+	uint32_t  pddr1Redistribute;        // 20: second stage pins inputs
+	volatile uint32_t *triggerPtr;      // 24: conversion trigger register address
+	uint32_t  trigger;                  // 28: conversion trigger value
+	uint32_t  delay0;                   // 32: delay after first stage (loop iterations)
+	uint32_t  delay1;                   // 36: delay after second stage (loop iterations)
+}tConvKernel;
+
+/*****************************************************************************
+*
+* Function: static inline void ConversionKernelSet(tConvKernel *pKernel, GPIO_Type *pGpio0, uint32_t pins0Mask, uint32_t delay0,
+* 													GPIO_Type *pGpio1, uint32_t pins1Mask, uint32_t delay1,
+* 													volatile uint32_t *pTrigger, uint32_t trigger)
+*
+* Input: Kernel parameters, pins of the first and second distribution stage, delays, conversion trigger
+*
+* Description: Precalculate all register values of the conversion kernel, so that no value
+* 				is computed between charge distribution and redistribution
+*
+* Note: Single stage - second stage equal to the first one with zero delay
+*
+*****************************************************************************/
+static inline void ConversionKernelSet(tConvKernel *pKernel, GPIO_Type *pGpio0, uint32_t pins0Mask, uint32_t delay0,
+										GPIO_Type *pGpio1, uint32_t pins1Mask, uint32_t delay1,
+										volatile uint32_t *pTrigger, uint32_t trigger)
+{
+	uint32_t pddr0 = pGpio0->PDDR;
+	uint32_t pddr1 = pGpio1->PDDR;
+
+	// PDDR addresses
+	pKernel->pddr0Ptr = &(pGpio0->PDDR);
+	pKernel->pddr1Ptr = &(pGpio1->PDDR);
+
+	// Both stages on the same port?
+	if (pGpio0 == pGpio1)
+	{
+		// Second stage keeps first stage pins outputs, first stage redistribution keeps second stage pins outputs
+		pKernel->pddr0Distribute = pddr0 | pins0Mask;
+		pKernel->pddr1Distribute = pddr0 | pins0Mask | pins1Mask;
+		pKernel->pddr0Redistribute = (pddr0 | pins1Mask) & ~pins0Mask;
+		pKernel->pddr1Redistribute = pddr0 & ~(pins0Mask | pins1Mask);
+	}
+	else
+	{
+		// Each stage on its own port
+		pKernel->pddr0Distribute = pddr0 | pins0Mask;
+		pKernel->pddr1Distribute = pddr1 | pins1Mask;
+		pKernel->pddr0Redistribute = pddr0 & ~pins0Mask;
+		pKernel->pddr1Redistribute = pddr1 & ~pins1Mask;
+	}
+
+	// Conversion trigger
+	pKernel->triggerPtr = pTrigger;
+	pKernel->trigger = trigger;
+
+	// Charge distribution delays
+	pKernel->delay0 = delay0;
+	pKernel->delay1 = delay1;
+}
+
+/*****************************************************************************
+*
+* Function: static inline void ConversionKernelRun(tConvKernel *pKernel)
+*
+* Input: Kernel parameters set by ConversionKernelSet()
+*
+* Description: Hand-scheduled charge distribution, delay, conversion start and charge redistribution
+*
+* Note: All registers are loaded before the first PDDR write, the critical window from the first
+* 		PDDR write to the last one is a fixed instruction sequence, independent of the compiler
+* 		optimization level. Delay loop runs (delay + 1) iterations of subs + taken branch.
+*
+*****************************************************************************/
+static inline void ConversionKernelRun(tConvKernel *pKernel)
+{
+	asm volatile (
+			/***** ASSEMBLY TEMPLATE ****************************************/
+			// Load kernel parameters
+			"ldr r0, [%0, #0]\n\t"     // first stage PDDR address
+			"ldr r1, [%0, #4]\n\t"     // first stage distribute
+			"ldr r2, [%0, #12]\n\t"    // second stage PDDR address
+			"ldr r3, [%0, #16]\n\t"    // second stage distribute
+			"ldr r4, [%0, #24]\n\t"    // trigger register address
+			"ldr r5, [%0, #28]\n\t"    // trigger value
+			"ldr r6, [%0, #32]\n\t"    // first delay
+			"ldr r12, [%0, #36]\n\t"   // second delay
+			"ldr lr, [%0, #8]\n\t"     // first stage redistribute
+			// Distribute first stage Electrode and Cext charge
+			"str r1, [r0, #0]\n\t"
+			"ldr r1, [%0, #20]\n\t"    // second stage redistribute
+			// Delay to distribute charge
+			"1:\n\t"
+			"subs r6, r6, #1\n\t"
+			"bcs 1b\n\t"
+			// Distribute second stage Electrode and Cext charge
+			"str r3, [r2, #0]\n\t"
+			// Delay to distribute charge
+			"2:\n\t"
+			"subs r12, r12, #1\n\t"
+			"bcs 2b\n\t"
+			// Start Cext voltage ADC conversion
+			"str r5, [r4, #0]\n\t"
+			// Redistribute Electrode and Cext charge of both stages
+			"str lr, [r0, #0]\n\t"
+			"str r1, [r2, #0]"
+			/***** LIST OF OUTPUT OPERANDS **********************************/
+			:
+			/***** LIST OF INPUT OPERANDS ***********************************/
+			:  "r" (pKernel)                   // operand %0
+			/***** LIST OF CLOBBERED REGISTERS ******************************/
+			:  "r0", "r1", "r2", "r3", "r4", "r5", "r6", "r12", "lr", "cc", "memory"
+	);
+}
+#endif
 
 /*****************************************************************************
 *
@@ -31,9 +222,32 @@
 *****************************************************************************/
 static inline int16_t EquivalentVoltageDigitalization(tElecStruct *pElectrodeStruct)
 {
+#ifdef DEBUG_SCAN_TIMING
+	uint32_t waitStart = DWT_CYCCNT_REG;
+#endif
+
+#if (ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP)
+	// Clear ADC interrupts pending flags
+	ConversionCompletePendingClear();
+
+	// Sleep until conversion complete flag
+	while(pElectrodeStruct->adcBasePtr->SC1[0] < 0x80)
+	{
+		asm volatile ("wfe");
+#ifdef DEBUG_SCAN_TIMING
+		scanTimingWakeups++;
+#endif
+	}
+#else
 	// Wait for conversion complete flag
 	while(pElectrodeStruct->adcBasePtr->SC1[0] < 0x80)
 	{}
+#endif
+
+#ifdef DEBUG_SCAN_TIMING
+	// Accumulate conversion complete wait cycles
+	scanTimingWaitCycles += DWT_CYCCNT_REG - waitStart;
+#endif
 	// Store result, clear COCO flag
 	return pElectrodeStruct->adcBasePtr->R[0];
 }
@@ -42,23 +256,46 @@ static inline int16_t EquivalentVoltageDigitalization(tElecStruct *pElectrodeStr
 *
 * Function: static inline void SimultaneousEquivalentVoltageDigitalization(tElecStruct *pElectrode0Struct, tElecStruct *pElectrode1Struct)
 *
-* Input: Addresses of a pair of slider electrodes structures in electrodes structure array
+* Input: Addresses of a pair of electrodes structures (slider or touch button electrodes pair)
 *
 * Description: Simultaneous Equivalent voltage conversion
 *
 *****************************************************************************/
 static inline void SimultaneousEquivalentVoltageDigitalization(tElecStruct *pElectrode0Struct, tElecStruct *pElectrode1Struct)
 {
-	// Configure both slider electrodes pins as analog input
+	// Configure both electrodes Cext pins as analog input
 	pElectrode0Struct->portBasePtr->PCR[pElectrode0Struct->pinNumberCext]= PCR_ANA;
 	pElectrode1Struct->portBasePtr->PCR[pElectrode1Struct->pinNumberCext] = PCR_ANA;
 
 	// Clear the SIM_SW_trigger flag to TRGMUX
 	SIM->MISCTRL1 = 0;
 
+#ifdef DEBUG_SCAN_TIMING
+	uint32_t waitStart = DWT_CYCCNT_REG;
+#endif
+
+#if (ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP)
+	// Clear ADC interrupts pending flags
+	ConversionCompletePendingClear();
+
+	// Sleep until conversion complete flag for both ADCs
+	while(pElectrode0Struct->adcBasePtr->SC1[0] < 0x80 || pElectrode1Struct->adcBasePtr->SC1[0] < 0x80)
+	{
+		asm volatile ("wfe");
+#ifdef DEBUG_SCAN_TIMING
+		scanTimingWakeups++;
+#endif
+	}
+#else
 	// Wait for conversion complete flag for both ADCs
-	while(pElectrode0Struct->adcBasePtr->SC1[0] < 0x80 && pElectrode1Struct->adcBasePtr->SC1[0] < 0x80)
+	while(pElectrode0Struct->adcBasePtr->SC1[0] < 0x80 || pElectrode1Struct->adcBasePtr->SC1[0] < 0x80)
 	{}
+#endif
+
+#ifdef DEBUG_SCAN_TIMING
+	// Accumulate conversion complete wait cycles
+	scanTimingWaitCycles += DWT_CYCCNT_REG - waitStart;
+#endif
 }
 
 #endif /* __ADC_INLINE_FCN1_H */
@@ -0,0 +1,196 @@
+/****************************************************************************//*!
+*
+* @file     dma.c
+*
+* @version  1.0.0.0
+*
+* @date     September-2017
+*
+* @brief    DMA routines
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include "S32K144.h"
+#include "S32K144_features.h"
+#include "dma.h"
+#include "main.h"
+#include "ets.h"
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+// Electrode sensing cycle sequence software TCDs (32-byte aligned for scatter/gather)
+tDmaTcd dmaSequenceTcd[DMA_SEQUENCE_STEPS] __attribute__((aligned(32)));
+// Register values written by the sequence steps
+uint32_t dmaSequenceValue[DMA_SEQUENCE_STEPS];
+// Delay step destination
+uint32_t dmaDelayDummy;
+
+/*****************************************************************************
+*
+* Function: void DMA_Init(void)
+*
+* Description: Init eDMA and DMAMUX for electrodes sensing cycles acquisition
+*
+*****************************************************************************/
+void DMA_Init(void)
+{
+	// Disable channels requests
+	DMA->CERQ = DMA_CH_SEQUENCE;
+	DMA->CERQ = DMA_CH_RESULT;
+
+	// Fixed priority arbitration, minor loop mapping disabled
+	DMA->CR = 0x00000000;
+
+	// Sequence channel started by SW and by channel link only
+	DMAMUX->CHCFG[DMA_CH_SEQUENCE] = 0;
+	// Result channel source selected for each electrode (ADC0 or ADC1)
+	DMAMUX->CHCFG[DMA_CH_RESULT] = 0;
+}
+
+/*****************************************************************************
+*
+* Function: void DMA_SequenceStepSet(uint32_t step, volatile uint32_t *regPtr, uint32_t value, uint32_t count)
+*
+* Input: Sequence step, register to write, value to write, number of writes
+*
+* Description: Set single sequence step TCD, chained to the next step by scatter/gather
+*
+*****************************************************************************/
+void DMA_SequenceStepSet(uint32_t step, volatile uint32_t *regPtr, uint32_t value, uint32_t count)
+{
+	// Value to write
+	dmaSequenceValue[step] = value;
+
+	// Source: step value, no offset, 32-bit
+	dmaSequenceTcd[step].SADDR = (uint32_t)&dmaSequenceValue[step];
+	dmaSequenceTcd[step].SOFF = 0;
+	dmaSequenceTcd[step].ATTR = DMA_TCD_ATTR_SSIZE(2) | DMA_TCD_ATTR_DSIZE(2);
+	dmaSequenceTcd[step].SLAST = 0;
+
+	// Destination: register, no offset
+	dmaSequenceTcd[step].DADDR = (uint32_t)regPtr;
+	dmaSequenceTcd[step].DOFF = 0;
+
+	// All writes in a single minor loop, single major loop iteration
+	dmaSequenceTcd[step].NBYTES = DMA_TCD_NBYTES_MLNO_NBYTES(4 * count);
+	dmaSequenceTcd[step].CITER = DMA_TCD_CITER_ELINKNO_CITER(1);
+	dmaSequenceTcd[step].BITER = DMA_TCD_BITER_ELINKNO_BITER(1);
+
+	// Load the next step TCD when done
+	dmaSequenceTcd[step].DLASTSGA = (uint32_t)&dmaSequenceTcd[(step + 1) % DMA_SEQUENCE_STEPS];
+
+	// First step waits for the result channel link, other steps start as soon as loaded
+	dmaSequenceTcd[step].CSR = (step == 0) ? DMA_TCD_CSR_ESG_MASK : (DMA_TCD_CSR_ESG_MASK | DMA_TCD_CSR_START_MASK);
+}
+
+/*****************************************************************************
+*
+* Function: void DMA_ElectrodeSequenceSet(tElecStruct *pElectrodeStruct, uint32_t delay, int16_t *samplesPtr, uint32_t samplesNum)
+*
+* Input: Address of a single electrode structure, charge distribution delay,
+* 		 samples array, number of samples (pre-cycles included)
+*
+* Description: Build electrode sensing cycle sequence in the same order as
+* 				ChargeDistribution(), delay, conversion start and ChargeRedistribution()
+*
+* Note: Other pins of the electrode port keep their PDDR state during the samples burst
+*
+*****************************************************************************/
+void DMA_ElectrodeSequenceSet(tElecStruct *pElectrodeStruct, uint32_t delay, int16_t *samplesPtr, uint32_t samplesNum)
+{
+	uint32_t portDirection;
+
+	// Port direction without the electrode pins
+	portDirection = pElectrodeStruct->gpioBasePtr->PDDR & ~(pElectrodeStruct->portMask);
+
+	// Charge distribution: drive electrode GPIO low
+	DMA_SequenceStepSet(0, &pElectrodeStruct->gpioBasePtr->PCOR, 1 << pElectrodeStruct->pinNumberElec, 1);
+	// Charge distribution: configure electrode pin as GPIO
+	DMA_SequenceStepSet(1, &pElectrodeStruct->portBasePtr->PCR[pElectrodeStruct->pinNumberElec], PCR_GPIO, 1);
+	// Charge distribution: drive Cext GPIO high
+	DMA_SequenceStepSet(2, &pElectrodeStruct->gpioBasePtr->PSOR, 1 << pElectrodeStruct->pinNumberCext, 1);
+	// Charge distribution: configure Cext pin as GPIO
+	DMA_SequenceStepSet(3, &pElectrodeStruct->portBasePtr->PCR[pElectrodeStruct->pinNumberCext], PCR_GPIO, 1);
+	// Charge distribution: configure Electrode and Cext pins as outputs at the same time
+	DMA_SequenceStepSet(4, &pElectrodeStruct->gpioBasePtr->PDDR, portDirection | pElectrodeStruct->portMask, 1);
+
+	// Delay to distribute charge: repeated writes to the dummy variable
+	DMA_SequenceStepSet(5, &dmaDelayDummy, 0, (delay > 0) ? delay : 1);
+
+	// Start Cext voltage ADC conversion
+	DMA_SequenceStepSet(6, &pElectrodeStruct->adcBasePtr->SC1[0], pElectrodeStruct->adcChNum, 1);
+	// Charge redistribution: configure Electrode and Cext pins as inputs at the same time
+	DMA_SequenceStepSet(7, &pElectrodeStruct->gpioBasePtr->PDDR, portDirection, 1);
+
+	// Result source: conversion result register, 16-bit
+	DMA->TCD[DMA_CH_RESULT].SADDR = (uint32_t)&pElectrodeStruct->adcBasePtr->R[0];
+	DMA->TCD[DMA_CH_RESULT].SOFF = 0;
+	DMA->TCD[DMA_CH_RESULT].ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);
+	DMA->TCD[DMA_CH_RESULT].SLAST = 0;
+
+	// Result destination: samples array
+	DMA->TCD[DMA_CH_RESULT].DADDR = (uint32_t)samplesPtr;
+	DMA->TCD[DMA_CH_RESULT].DOFF = 2;
+	DMA->TCD[DMA_CH_RESULT].DLASTSGA = 0;
+
+	// One sample per conversion complete, start the next sensing cycle sequence after each sample
+	DMA->TCD[DMA_CH_RESULT].NBYTES.MLNO = DMA_TCD_NBYTES_MLNO_NBYTES(2);
+	DMA->TCD[DMA_CH_RESULT].CITER.ELINKYES = DMA_TCD_CITER_ELINKYES_ELINK_MASK | DMA_TCD_CITER_ELINKYES_LINKCH(DMA_CH_SEQUENCE) | DMA_TCD_CITER_ELINKYES_CITER_LE(samplesNum);
+	DMA->TCD[DMA_CH_RESULT].BITER.ELINKYES = DMA_TCD_BITER_ELINKYES_ELINK_MASK | DMA_TCD_BITER_ELINKYES_LINKCH(DMA_CH_SEQUENCE) | DMA_TCD_BITER_ELINKYES_BITER(samplesNum);
+
+	// Disable result channel request after the last sample
+	DMA->TCD[DMA_CH_RESULT].CSR = DMA_TCD_CSR_DREQ_MASK;
+
+	// Result channel triggered by electrode ADC conversion complete
+	DMAMUX->CHCFG[DMA_CH_RESULT] = 0;
+	DMAMUX->CHCFG[DMA_CH_RESULT] = DMAMUX_CHCFG_ENBL_MASK | DMAMUX_CHCFG_SOURCE((pElectrodeStruct->adcBasePtr == ADC0) ? EDMA_REQ_ADC0 : EDMA_REQ_ADC1);
+}
+
+/*****************************************************************************
+*
+* Function: void DMA_ElectrodeSequenceRun(tElecStruct *pElectrodeStruct)
+*
+* Input: Address of a single electrode structure
+*
+* Description: Run the electrode samples burst set by DMA_ElectrodeSequenceSet(),
+* 				wait until all samples are stored
+*
+*****************************************************************************/
+void DMA_ElectrodeSequenceRun(tElecStruct *pElectrodeStruct)
+{
+	// Load the first step to the sequence channel
+	DMA->TCD[DMA_CH_SEQUENCE].SADDR = dmaSequenceTcd[0].SADDR;
+	DMA->TCD[DMA_CH_SEQUENCE].SOFF = dmaSequenceTcd[0].SOFF;
+	DMA->TCD[DMA_CH_SEQUENCE].ATTR = dmaSequenceTcd[0].ATTR;
+	DMA->TCD[DMA_CH_SEQUENCE].NBYTES.MLNO = dmaSequenceTcd[0].NBYTES;
+	DMA->TCD[DMA_CH_SEQUENCE].SLAST = dmaSequenceTcd[0].SLAST;
+	DMA->TCD[DMA_CH_SEQUENCE].DADDR = dmaSequenceTcd[0].DADDR;
+	DMA->TCD[DMA_CH_SEQUENCE].DOFF = dmaSequenceTcd[0].DOFF;
+	DMA->TCD[DMA_CH_SEQUENCE].CITER.ELINKNO = dmaSequenceTcd[0].CITER;
+	DMA->TCD[DMA_CH_SEQUENCE].DLASTSGA = dmaSequenceTcd[0].DLASTSGA;
+	DMA->TCD[DMA_CH_SEQUENCE].BITER.ELINKNO = dmaSequenceTcd[0].BITER;
+	DMA->TCD[DMA_CH_SEQUENCE].CSR = dmaSequenceTcd[0].CSR;
+
+	// ADC conversion complete generates DMA request
+	pElectrodeStruct->adcBasePtr->SC2 |= ADC_SC2_DMAEN_MASK;
+
+	// Enable result channel request
+	DMA->SERQ = DMA_CH_RESULT;
+
+	// Start the first sensing cycle
+	DMA->SSRT = DMA_CH_SEQUENCE;
+
+	// Wait for the last sample stored
+	while (0 == (DMA->TCD[DMA_CH_RESULT].CSR & DMA_TCD_CSR_DONE_MASK)) {}
+
+	// Clear DONE flags
+	DMA->CDNE = DMA_CH_RESULT;
+	DMA->CDNE = DMA_CH_SEQUENCE;
+
+	// ADC back to CPU polled conversion complete
+	pElectrodeStruct->adcBasePtr->SC2 &= ~ADC_SC2_DMAEN_MASK;
+}
@@ -0,0 +1,63 @@
+/****************************************************************************//*!
+*
+* @file     dma.h
+*
+* @version  1.0.0.0
+*
+* @date     September-2017
+*
+* @brief    DMA routines header file
+*
+*******************************************************************************/
+#ifndef __DMA_H
+#define __DMA_H
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include "S32K144.h"
+#include "ets.h"
+
+/*******************************************************************************
+* DMA channels
+******************************************************************************/
+// Electrode sensing cycle sequence, started by SW and by result channel link
+#define DMA_CH_SEQUENCE   0
+// ADC result store, triggered by ADC conversion complete
+#define DMA_CH_RESULT     1
+
+/*******************************************************************************
+* Electrode sensing cycle sequence steps
+* 5x charge distribution, 1x delay, 1x conversion start, 1x charge redistribution
+******************************************************************************/
+#define DMA_SEQUENCE_STEPS   8
+
+/*******************************************************************************
+* Type defines
+******************************************************************************/
+// Software TCD, loaded by scatter/gather (same layout as DMA->TCD[n])
+typedef struct
+{
+	uint32_t  SADDR;
+	uint16_t  SOFF;
+	uint16_t  ATTR;
+	uint32_t  NBYTES;
+	uint32_t  SLAST;
+	uint32_t  DADDR;
+	uint16_t  DOFF;
+	uint16_t  CITER;
+	uint32_t  DLASTSGA;
+	uint16_t  CSR;
+	uint16_t  BITER;
+}
+tDmaTcd;
+
+/*******************************************************************************
+* Function prototypes
+******************************************************************************/
+void DMA_Init(void);
+void DMA_SequenceStepSet(uint32_t step, volatile uint32_t *regPtr, uint32_t value, uint32_t count);
+void DMA_ElectrodeSequenceSet(tElecStruct *pElectrodeStruct, uint32_t delay, int16_t *samplesPtr, uint32_t samplesNum);
+void DMA_ElectrodeSequenceRun(tElecStruct *pElectrodeStruct);
+
+#endif /* __DMA_H */
@@ -0,0 +1,117 @@
+/****************************************************************************//*!
+*
+* @file     flash.c
+*
+* @version  1.0.0.0
+*
+* @date     September-2017
+*
+* @brief    FlexNVM data flash routines
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include "flash.h"
+
+/*****************************************************************************
+*
+* Function: uint8_t FLASH_CommandLaunch(void)
+*
+* Description: Launch FTFC command loaded in FCCOB and wait for its completion.
+* 			   Code runs from program flash, FlexNVM is a separate block (read-while-write).
+*
+*****************************************************************************/
+static uint8_t FLASH_CommandLaunch(void)
+{
+	// Launch command
+	FTFC->FSTAT = FTFC_FSTAT_CCIF_MASK;
+
+	// Wait for command complete
+	while ((FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) == 0)
+	{}
+
+	// Access error, protection violation or command failed?
+	if (FTFC->FSTAT & (FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK | FTFC_FSTAT_MGSTAT0_MASK))
+	{
+		return FLASH_ERROR;
+	}
+
+	return FLASH_OK;
+}
+
+/*****************************************************************************
+*
+* Function: void FLASH_CommandInit(uint8_t command, uint32_t address)
+*
+* Description: Wait for previous command, clear error flags, load command and FlexNVM address
+*
+*****************************************************************************/
+static void FLASH_CommandInit(uint8_t command, uint32_t address)
+{
+	// Wait for previous command complete
+	while ((FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) == 0)
+	{}
+
+	// Clear access error and protection violation flags
+	FTFC->FSTAT = FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK;
+
+	// FCCOB0 command, FCCOB1..3 address
+	FTFC->FCCOB[3] = command;
+	FTFC->FCCOB[2] = (uint8_t)(FTFC_DFLASH_CMD_ADDRESS(address) >> 16);
+	FTFC->FCCOB[1] = (uint8_t)(FTFC_DFLASH_CMD_ADDRESS(address) >> 8);
+	FTFC->FCCOB[0] = (uint8_t)(FTFC_DFLASH_CMD_ADDRESS(address));
+}
+
+/*****************************************************************************
+*
+* Function: uint8_t FLASH_DFlashSectorErase(uint32_t address)
+*
+* Description: Erase FlexNVM data flash sector
+*
+*****************************************************************************/
+uint8_t FLASH_DFlashSectorErase(uint32_t address)
+{
+	// Erase flash sector command
+	FLASH_CommandInit(FTFC_CMD_ERASE_SECTOR, address);
+
+	return FLASH_CommandLaunch();
+}
+
+/*****************************************************************************
+*
+* Function: uint8_t FLASH_DFlashProgram(uint32_t address, const uint32_t *dataPtr, uint32_t wordsNum)
+*
+* Description: Program FlexNVM data flash phrase by phrase, wordsNum even, address phrase aligned
+*
+*****************************************************************************/
+uint8_t FLASH_DFlashProgram(uint32_t address, const uint32_t *dataPtr, uint32_t wordsNum)
+{
+	uint32_t  wordNum;
+
+	// All phrases
+	for (wordNum = 0; wordNum < wordsNum; wordNum += 2)
+	{
+		// Program phrase command
+		FLASH_CommandInit(FTFC_CMD_PROGRAM_PHRASE, address + (wordNum << 2));
+
+		// FCCOB4..7 first word, FCCOB8..B second word (little endian)
+		FTFC->FCCOB[7] = (uint8_t)(dataPtr[wordNum]);
+		FTFC->FCCOB[6] = (uint8_t)(dataPtr[wordNum] >> 8);
+		FTFC->FCCOB[5] = (uint8_t)(dataPtr[wordNum] >> 16);
+		FTFC->FCCOB[4] = (uint8_t)(dataPtr[wordNum] >> 24);
+		FTFC->FCCOB[11] = (uint8_t)(dataPtr[wordNum + 1]);
+		FTFC->FCCOB[10] = (uint8_t)(dataPtr[wordNum + 1] >> 8);
+		FTFC->FCCOB[9] = (uint8_t)(dataPtr[wordNum + 1] >> 16);
+		FTFC->FCCOB[8] = (uint8_t)(dataPtr[wordNum + 1] >> 24);
+
+		// Phrase programmed?
+		if (FLASH_CommandLaunch() == FLASH_ERROR)
+		{
+			return FLASH_ERROR;
+		}
+	}
+
+	return FLASH_OK;
+}
@@ -18,16 +18,24 @@
 #include "ets.h"
 #include "S32K144.h"
 
+/*******************************************************************************
+* Number of GPIO ports (PTA - PTE)
+******************************************************************************/
+#define NUMBER_OF_GPIO_PORTS   5
+
+// All electrodes (touch button, EGS and slider) pins masks per GPIO port
+extern uint32_t electrodesPortMask[NUMBER_OF_GPIO_PORTS];
+
 /*****************************************************************************
 *
-* Function: static inline void ChargeDistribution(tElecStruct *pElectrodeStruct)
+* Function: static inline void ChargeDistributionPinsSet(tElecStruct *pElectrodeStruct)
 *
 * Input: Address of a single electrode structure in electrodes structure array
 *
-* Description: Charge distribution
+* Description: Prepare electrode and Cext pins for charge distribution, pins stay inputs
 *
 *****************************************************************************/
-static inline void ChargeDistribution(tElecStruct *pElectrodeStruct)
+static inline void ChargeDistributionPinsSet(tElecStruct *pElectrodeStruct)
 {
    // Drive electrode GPIO low
 	pElectrodeStruct->gpioBasePtr->PCOR = 1 << pElectrodeStruct->pinNumberElec;
@@ -40,6 +48,21 @@ static inline void ChargeDistribution(tElecStruct *pElectrodeStruct)
     //REG_RMW32(&(pElectrodeStruct->gpioBasePtr->PSOR), 1 << pElectrodeStruct->pinNumberCext, 1 << pElectrodeStruct->pinNumberCext);
     // Configure Cext pin as GPIO to precharge Cext
     pElectrodeStruct->portBasePtr->PCR[pElectrodeStruct->pinNumberCext] = PCR_GPIO;
+}
+
+/*****************************************************************************
+*
+* Function: static inline void ChargeDistribution(tElecStruct *pElectrodeStruct)
+*
+* Input: Address of a single electrode structure in electrodes structure array
+*
+* Description: Charge distribution
+*
+*****************************************************************************/
+static inline void ChargeDistribution(tElecStruct *pElectrodeStruct)
+{
+	// Electrode low, Cext high, both pins GPIO
+	ChargeDistributionPinsSet(pElectrodeStruct);
 
     // Configure Electrode and Cext pins as outputs at the same time
     //pElectrodeStruct->gpioBasePtr->PDDR |= pElectrodeStruct->portMask;
@@ -49,14 +72,14 @@ static inline void ChargeDistribution(tElecStruct *pElectrodeStruct)
 
 /*****************************************************************************
  *
- * Function: static inline void SimultaneousChargeDistribution(tElecStruct *pElectrode0Struct, tElecStruct *pElectrode1Struct)
+ * Function: static inline void SimultaneousChargeDistributionPinsSet(tElecStruct *pElectrode0Struct, tElecStruct *pElectrode1Struct)
  *
  * Input: Addresses of a pair of slider electrodes structures in electrodes structure array
  *
- * Description: Simultaneous Charge distribution for two slider electrodes at once
+ * Description: Prepare pins of two slider electrodes for charge distribution, pins stay inputs
  *
  *****************************************************************************/
-static inline void SimultaneousChargeDistribution(tElecStruct *pElectrode0Struct, tElecStruct *pElectrode1Struct)
+static inline void SimultaneousChargeDistributionPinsSet(tElecStruct *pElectrode0Struct, tElecStruct *pElectrode1Struct)
 {
 	// Drive both electrode pins GPIO low
 	pElectrode0Struct->gpioBasePtr->PCOR = (1 << pElectrode0Struct->pinNumberElec) | (1 << pElectrode1Struct->pinNumberElec);
@@ -71,9 +94,25 @@ static inline void SimultaneousChargeDistribution(tElecStruct *pElectrode0Struct
 	// Configure Cexts pins as GPIO to precharge Cexts
 	pElectrode0Struct->portBasePtr->PCR[pElectrode0Struct->pinNumberCext] = PCR_GPIO;
 	pElectrode1Struct->portBasePtr->PCR[pElectrode1Struct->pinNumberCext] = PCR_GPIO;
+}
 
-	// Configure both Electrodes and Cext pins as outputs at the same time
-	pElectrode0Struct->gpioBasePtr->PDDR = (pElectrode0Struct->portMask + pElectrode1Struct->portMask);
+/*****************************************************************************
+ *
+ * Function: static inline void SimultaneousChargeDistribution(tElecStruct *pElectrode0Struct, tElecStruct *pElectrode1Struct)
+ *
+ * Input: Addresses of a pair of slider electrodes structures in electrodes structure array
+ *
+ * Description: Simultaneous Charge distribution for two slider electrodes at once
+ *
+ *****************************************************************************/
+static inline void SimultaneousChargeDistribution(tElecStruct *pElectrode0Struct, tElecStruct *pElectrode1Struct)
+{
+	// Electrodes low, Cexts high, all pins GPIO
+	SimultaneousChargeDistributionPinsSet(pElectrode0Struct, pElectrode1Struct);
+
+	// Configure both Electrodes and Cext pins as outputs at the same time, other pins of the port
+	// (disabled electrodes held at GND, non electrode pins) keep their direction
+	pElectrode0Struct->gpioBasePtr->PDDR |= (pElectrode0Struct->portMask | pElectrode1Struct->portMask);
 
 }
 
@@ -147,5 +186,67 @@ static inline void ElectrodeFloat(tElecStruct *pElectrodeStruct)
 	REG_WRITE32(&(pElectrodeStruct->gpioBasePtr->PDDR), ((REG_READ32(&(pElectrodeStruct->gpioBasePtr->PDDR))) & (~(pElectrodeStruct->portMask))));
 }
 
+/*****************************************************************************
+*
+* Function: static inline void PortPinsGnd(PORT_Type *pPortStruct, GPIO_Type *pGpioStruct, uint32_t pinsMask)
+*
+* Input: PORT and GPIO of a single port, port pins mask
+*
+* Description: Drive port pins low level at once
+*
+*****************************************************************************/
+static inline void PortPinsGnd(PORT_Type *pPortStruct, GPIO_Type *pGpioStruct, uint32_t pinsMask)
+{
+	// Drive pins GPIO low
+	pGpioStruct->PCOR = pinsMask;
+
+	// Any pin 0-15?
+	if (pinsMask & 0x0000FFFF)
+	{
+		// Configure pins 0-15 as GPIO at once
+		pPortStruct->GPCLR = (pinsMask << 16) | (PCR_GPIO & 0x0000FFFF);
+	}
+	// Any pin 16-31?
+	if (pinsMask & 0xFFFF0000)
+	{
+		// Configure pins 16-31 as GPIO at once
+		pPortStruct->GPCHR = (pinsMask & 0xFFFF0000) | (PCR_GPIO & 0x0000FFFF);
+	}
+
+	// Configure pins as outputs at the same time
+	pGpioStruct->PDDR |= pinsMask;
+}
+
+/*****************************************************************************
+*
+* Function: static inline void ElectrodesGndAll(void)
+*
+* Description: Drive all electrodes pins low level, port by port
+*
+*****************************************************************************/
+static inline void ElectrodesGndAll(void)
+{
+	if (electrodesPortMask[0]) {PortPinsGnd(PORTA, PTA, electrodesPortMask[0]);}
+	if (electrodesPortMask[1]) {PortPinsGnd(PORTB, PTB, electrodesPortMask[1]);}
+	if (electrodesPortMask[2]) {PortPinsGnd(PORTC, PTC, electrodesPortMask[2]);}
+	if (electrodesPortMask[3]) {PortPinsGnd(PORTD, PTD, electrodesPortMask[3]);}
+	if (electrodesPortMask[4]) {PortPinsGnd(PORTE, PTE, electrodesPortMask[4]);}
+}
+
+/*****************************************************************************
+*
+* Function: static inline void ElectrodesFloatAll(void)
+*
+* Description: Configure all electrodes pins as an inputs (high impedance), port by port
+*
+*****************************************************************************/
+static inline void ElectrodesFloatAll(void)
+{
+	if (electrodesPortMask[0]) {PTA->PDDR &= ~electrodesPortMask[0];}
+	if (electrodesPortMask[1]) {PTB->PDDR &= ~electrodesPortMask[1];}
+	if (electrodesPortMask[2]) {PTC->PDDR &= ~electrodesPortMask[2];}
+	if (electrodesPortMask[3]) {PTD->PDDR &= ~electrodesPortMask[3];}
+	if (electrodesPortMask[4]) {PTE->PDDR &= ~electrodesPortMask[4];}
+}
 
 #endif /* __GPIO_INLINE_FCN1_H */
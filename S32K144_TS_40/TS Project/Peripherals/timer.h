@@ -16,6 +16,7 @@
 * Includes
 *******************************************************************************/
 #include "ts_cfg.h"
+#include "ets.h"
 
 /*******************************************************************************
 * Defines LPTMR
@@ -27,11 +28,51 @@
 #if DECIMATION_FILTER
 #define LPTMR_ELEC_SENSE_DF   (ELECTRODES_SENSE_PERIOD_DF - 1)
 #endif
+/*******************************************************************************
+* Defines sensor groups
+******************************************************************************/
+// Sensor groups (bit per group in the groups masks)
+#define SENSOR_GROUP_KEYPAD   0
+#define SENSOR_GROUP_SLIDER   1
+
+#if SLIDER_ENABLE
+#define NUMBER_OF_SENSOR_GROUPS   2
+#else
+#define NUMBER_OF_SENSOR_GROUPS   1
+#endif
+
+// All sensor groups mask
+#define SENSOR_GROUPS_ALL   ((1 << NUMBER_OF_SENSOR_GROUPS) - 1)
+
+#if TS_SENSOR_GROUPS
+// Sensor group scan schedule
+typedef struct
+{
+	// Scan period while idle and while active [electrodes sensing cycles]
+	uint8_t   scanPeriodIdle;
+	uint8_t   scanPeriodActive;
+	// Sensing cycles to the next group scan
+	uint8_t   scanCounter;
+}
+tSensorGroup;
+#endif
+
 /*******************************************************************************
 * Function prototypes
 ******************************************************************************/
 void LPTMR0_Init(uint32_t timeout);
 void Jitter(int32_t jitter);
+void BacklightCtrl(void);
+#ifndef WAKE_UP_ELECTRODE
+uint8_t SensorGroupsSchedule(void);
+void SensorGroupsTouchElecSense(uint8_t sensorGroups);
+void SensorGroupsSensingCyclesChange(uint8_t sensorGroups, uint8_t scanFrequencyID);
+#endif
+
+#if TS_DEFERRED_PROCESSING
+void ElectrodesScanAcquire(uint8_t scanFrequencyID);
+void ElectrodesScanProcess(tAcqFrame *framePtr);
+#endif
 
 void LPIT_Init(uint32_t timeout);
 void LPIT_Enable(void);
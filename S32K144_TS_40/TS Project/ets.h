@@ -17,6 +17,8 @@
 *******************************************************************************/
 #include "S32K144.h"
 #include "ts_cfg.h"
+#include "filter.h"
+#include "adc.h"
 
 /*******************************************************************************
 * Calibration after power-up and reset
@@ -38,6 +40,41 @@
 #else
 	#define ELEC_WAKEUP_ACTIVATE_COUNTER    (1000 / ELECTRODES_SENSE_PERIOD)
 #endif
+/*******************************************************************************
+* Self-trim convergence detection, samples spread and trend accumulated around the first sample
+******************************************************************************/
+typedef struct
+{
+	int32_t   firstSample;
+	int64_t   sumSquare;
+	int64_t   sumIndexed;
+}
+tSelfTrimVar;
+
+/*******************************************************************************
+* Dual ADC conversion - touch button electrode without pair
+******************************************************************************/
+#define ELEC_PAIR_NONE  0xFF
+
+/*******************************************************************************
+* Acquisition timing auto-tuning
+* Candidates ordered by sensing cycle duration, each evaluated on a number of scans
+* Reference candidate is the default timing the touch thresholds are set up with,
+* it is evaluated first, the other candidates in order
+******************************************************************************/
+#define NUMBER_OF_TIMING_TUNE_CANDIDATES   9
+#define NUMBER_OF_TIMING_TUNE_SCANS        4
+#define TIMING_TUNE_REFERENCE_CANDIDATE    2
+#define TIMING_TUNE_CHARGE_DISTRIBUTION_PERIODS   {0, 8, 0, 8, 32, 32, 0, 8, 32}
+#define TIMING_TUNE_ADC_SAMPLE_TIMES              {6, 6, 14, 14, 6, 14, 30, 30, 30}
+
+/*******************************************************************************
+* Noise-adaptive sensing cycles per sample
+* Noise variance filter shift and hysteresis of the cycles decrease
+******************************************************************************/
+#define ADAPTIVE_SENSING_NOISE_FILTER_SHIFT   4
+#define ADAPTIVE_SENSING_HYSTERESIS           2
+
 /*******************************************************************************
 * PCR defines
 ******************************************************************************/
@@ -55,7 +92,8 @@ typedef union
     struct
     {
     	uint8_t selfTrimDone:1;                // LSB
-    	uint8_t na:7;                          // MSB
+    	uint8_t timingTuneDone:1;
+    	uint8_t na:6;                          // MSB
     }bit;
 }tElecStatus;
 
@@ -72,13 +110,156 @@ typedef struct
 }
 tElecStruct;
 
+// Electrode configuration, hardware and application parameters stored in flash
+typedef struct
+{
+	tElecStruct  hw;
+	int16_t   touchThresholdDelta;
+	int16_t   releaseThresholdDelta;
+	uint8_t   DCTrackerFilterFactor;
+	uint8_t   LPFilterType;
+	// Neighbour electrodes scanned together with the touched electrode (bit per electrode)
+	uint32_t  roiNeighbours;
+}
+tElecCfg;
+
+// Electrode configuration table entry built from the board configuration ELECn_... defines
+#define ELEC_CFG(n)  {{ELEC##n##_ADC, ELEC##n##_ADC_CHANNEL, ELEC##n##_PORT, ELEC##n##_GPIO, ELEC##n##_ELEC_GPIO_PIN, ELEC##n##_CEXT_GPIO_PIN, ELEC##n##_PORT_MASK}, \
+                      ELEC##n##_TOUCH_THRESHOLD_DELTA, ELEC##n##_RELEASE_THRESHOLD_DELTA, ELEC##n##_DCTRACKER_FILTER_FACTOR, ELEC##n##_LPFILTER_TYPE, \
+                      ELEC##n##_ROI_NEIGHBOURS}
+
+// Temperature compensation coefficient fractional bits
+#define TEMP_COMP_COEF_SHIFT   8
+
+// All touch button electrodes scan mask (bit per electrode)
+#define ELEC_SCAN_MASK_ALL   (0xFFFFFFFF >> (32 - NUMBER_OF_TOUCH_ELECTRODES))
+
+// Electrode processing state, everything the per-scan pipeline reads and writes for one electrode
+typedef struct
+{
+	// Capacitance to equivalent voltage conversion
+	int32_t   adcDataElectrodeDischargeRaw[NUMBER_OF_HOPPING_FREQUENCIES];
+#if DECIMATION_FILTER
+	int32_t   adcDataElectrodeDischargeRawDF[NUMBER_OF_HOPPING_FREQUENCIES];
+#endif
+	// DC Tracker
+	int32_t   DCTrackerDataBufferRaw;
+	int32_t   DCTrackerDataBuffer;
+	// DC tracker consecutive samples above baseline (release direction)
+	int16_t   DCTrackerSlewRun;
+	// LP Filter
+	tFrac32   LPFilterData[NUMBER_OF_HOPPING_FREQUENCIES];
+	tFilterIIR1Buffer LPFilterBuffer[NUMBER_OF_HOPPING_FREQUENCIES];
+	// Detector
+	int32_t   detectorThresholdTouch;
+	int32_t   detectorThresholdRelease;
+	int16_t   detectorThresholdTouchDelta;
+	int16_t   detectorThresholdReleaseDelta;
+#if TS_ADAPTIVE_SENSING_CYCLES
+	// Noise-adaptive sensing cycles per sample
+	uint32_t  elecNoiseVariance;
+	int16_t   elecSensingCyclesPerSample;
+#endif
+	// Acquisition timing
+	uint16_t  elecChargeDistributionPeriod;
+	uint8_t   elecAdcSampleTime;
+	uint8_t   DCTrackerDataShift;
+	uint8_t   LPFilterType;
+	uint8_t   electrodeTouch[NUMBER_OF_HOPPING_FREQUENCIES];
+#if TS_TEMP_COMPENSATION
+	// Temperature compensation: coefficient [baseline per temperature << TEMP_COMP_COEF_SHIFT],
+	// feed-forward fraction left, learning window start baseline and window invalidated by touch
+	int32_t   tempCompCoef;
+	int32_t   tempCompFrac;
+	int32_t   tempCompWindowBaseline;
+	uint8_t   tempCompTouched;
+#endif
+	// Baseline re-seed on the next scan, electrode re-enabled
+	uint8_t   baselineReseed;
+}
+tElecData;
+
+// Warm start snapshot signature, board and number of electrodes
+#define WARM_START_SIGNATURE   (0x57530000 | (REFERENCE_DESIGN_BOARD << 8) | NUMBER_OF_ELECTRODES)
+
+// Warm start snapshot of one touch button (or EGS) electrode
+typedef struct
+{
+	int32_t   DCTrackerDataBuffer;
+	int16_t   detectorThresholdTouchDelta;
+	int16_t   detectorThresholdReleaseDelta;
+	uint16_t  elecChargeDistributionPeriod;
+	uint8_t   elecAdcSampleTime;
+	uint8_t   DCTrackerDataShift;
+}
+tWarmStartElec;
+
+// Warm start snapshot stored in FlexNVM data flash, checksum over all words before it
+typedef struct
+{
+	uint32_t  signature;
+	tAdcCal   adcCal[2];
+	tWarmStartElec  elec[NUMBER_OF_ELECTRODES];
+	uint32_t  checksum;
+}
+tWarmStart;
+
+// Warm start snapshot words covered by the checksum (checksum is the last word)
+#define WARM_START_CHECKSUM_WORDS   ((sizeof(tWarmStart) / 4) - 1)
+
+// Warm start snapshot padded to whole flash phrases
+typedef union
+{
+	tWarmStart  data;
+	uint32_t  word[((sizeof(tWarmStart) + 7) / 8) * 2];
+}
+tWarmStartImage;
+
+// Sensing context of one touch button electrodes scan, passed by pointer through the processing
+typedef struct
+{
+	// Electrodes processing state
+	tElecData  *elecDataPtr;
+	// Touch button electrodes scanned (bit per electrode)
+	uint32_t  scanMask;
+	// Scanning period/frequency ID of the scan
+	uint8_t   frequencyID;
+}
+tSenseCtx;
+
+#if TS_DEFERRED_PROCESSING
+// Acquisition frame, raw data of one electrodes scan handed over from the acquisition ISR to the deferred processing
+typedef struct
+{
+	int32_t   elecRaw[NUMBER_OF_ELECTRODES];
+#if SLIDER_ENABLE
+	int32_t   sliderRaw[NUMBER_OF_SLIDER_ELECTRODES];
+#endif
+	// Touch button electrodes scanned (bit per electrode)
+	uint32_t  elecScanMask;
+#if SLIDER_ENABLE
+	// Slider electrodes scanned
+	uint8_t   sliderScanned;
+#endif
+	// Sensor groups acquired (bit per group)
+	uint8_t   sensorGroups;
+	// Scanning period/frequency ID of the scan
+	uint8_t   frequencyID;
+	// Frame acquired, waiting for processing
+	volatile uint8_t  ready;
+}
+tAcqFrame;
+#endif
+
 /*******************************************************************************
 * Function prototypes
 ******************************************************************************/
 void ElectrodeTouchSenseInit(void);
 void ElectodeBufferInitVal(int32_t inputSignal, int32_t *outputSignalPtr, uint16_t *sumCounterPtr);
 void ElectodeCalInitVal(int32_t *outputSignalPtr, uint16_t *sumCounterPtr);
-int32_t DCTracker(int32_t inputSignal, int32_t *outputSignalRawPtr, uint8_t shift);
+void ElectodeVarAcc(int32_t inputSignal, tSelfTrimVar *varPtr, uint16_t sumCounter);
+uint8_t ElectodeVarSettled(int32_t inputSignal, int32_t *sumPtr, tSelfTrimVar *varPtr, uint16_t *sumCounterPtr, int16_t touchDelta);
+int32_t DCTracker(int32_t inputSignal, int32_t *outputSignalRawPtr, uint8_t shift, int16_t *slewRunPtr);
 void DCTrackerShiftDecrease(void);
 void DCTrackerShiftIncrease(void);
 
@@ -86,15 +267,40 @@ void ElectrodeSelfTrimSense(void);
 void ElectrodeWakeElecSense(void);
 void ElectrodeWakeAndTouchElecSense(void);
 void ElectrodeTouchElecSense(void);
+void ElectrodeTouchElecAcquire(void);
+void ElectrodeTouchProcess(tSenseCtx *ctxPtr);
 void ElectrodeADCchannelOffset(void);
+void ElectrodesPortMaskInit(void);
+void ElectrodeTimingSet(uint32_t electrode0Num, uint32_t electrode1Num);
+void ElectrodeTimingReset(void);
+void ElectrodeTimingTune(void);
+void ElectrodeRawDataCalc(uint32_t electrodeNum, tTrimAcc *accPtr);
+uint8_t ElectrodeSequentialTest(uint32_t electrodeNum, int16_t sample, uint32_t samplesNum);
+void ElectrodeDualADCPairInit(void);
+void ElectrodeCapToVoltConvELCH(uint32_t electrodeNum);
+void ElectrodeSimultaneousCapToVoltConvELCH(uint32_t electrode0Num, uint32_t electrode1Num);
+void ElectrodePipelinedCapToVoltConvELCH(uint32_t electrode0Num, uint32_t electrode1Num);
+void ElectrodesCapToVoltConv(void);
 
-void ElectrodeSensingCyclesChange(void);
+void ElectrodeSensingCyclesChange(uint8_t scanFrequencyID);
 void ElectrodeSensingCyclesChangeEGS(void);
-void ElectrodeTouchDetect(uint32_t electrodeNum);
+void ElectrodeSensingCyclesAdapt(uint32_t electrodeNum, tSenseCtx *ctxPtr);
+void ElectrodeTouchDetect(uint32_t electrodeNum, tSenseCtx *ctxPtr);
+void ElectrodeRoiScanUpdate(tSenseCtx *ctxPtr);
+void ElectrodeEnableUpdate(void);
+void ElectrodeBaselineReseed(uint32_t electrodeNum, tSenseCtx *ctxPtr);
+void ElectrodeTempSensorAcquire(void);
+void ElectrodeTempCompUpdate(void);
+void ElectrodeCommonModeReject(tSenseCtx *ctxPtr);
+uint8_t ElectrodeWarmStartCheck(void);
+void ElectrodeWarmStartAdcRestore(void);
+void ElectrodeWarmStartRestore(void);
+void ElectrodeWarmStartSelfTrimDone(void);
+void ElectrodeWarmStartSave(void);
 
 void FrequencyHop(void);
 
-void DecimationFilter(uint32_t electrodeNum);
+void DecimationFilter(uint32_t electrodeNum, tSenseCtx *ctxPtr);
 void DecimationFilterCMRchange(void);
 
 void ElecOversamplingActivation(void);
@@ -31,12 +31,14 @@
 #include "gpio_inline_fcn2.h"
 #include "flextimer.h"
 #include "slider.h"
+#if TS_DMA_ACQUISITION
+#include "dma.h"
+#endif
 
 /*******************************************************************************
  * Variables
  ******************************************************************************/
 extern uint8_t   electrodeTouchQualified[NUMBER_OF_ELECTRODES];
-extern uint8_t   elecNum;
 extern uint8_t   sliderElectrodeTouchQualified;
 uint8_t  clockMode;
 
@@ -45,6 +47,8 @@ extern uint8_t  lowPowerModeCtrl, lowPowerModeEnable;
 
 // RGB LED display
 uint8_t  electrodeTouchQualifiedDisplay;
+const uint8_t  electrodeLedColor[NUMBER_OF_LED_COLORS] = {LED_COLOR_RED | LED_COLOR_GREEN | LED_COLOR_BLUE, LED_COLOR_RED, LED_COLOR_GREEN, LED_COLOR_BLUE,
+                                                          LED_COLOR_RED | LED_COLOR_GREEN, LED_COLOR_GREEN | LED_COLOR_BLUE, LED_COLOR_RED | LED_COLOR_BLUE};
 uint8_t  sliderElectrodeTouchQualifiedDisplay;
 
 // Backlight PWM duty cycle from 0 to 100
@@ -54,6 +58,16 @@ extern uint16_t  backlightPWMDutyCycle;
 int16_t calibrationGainADC0;
 int16_t calibrationGainADC1;
 
+#ifdef DEBUG_SCAN_TIMING
+// ADC0 and ADC1 calibration duration [core clock cycles]
+uint32_t startupTimingAdcCalCycles;
+#endif
+
+#if TS_WARM_START
+// Warm start snapshot store requested by the self-trim
+extern volatile uint8_t  warmStartSaveRequest;
+#endif
+
 // Datalog synchronization, PTD1, 4k7 pull-up
 //uint8_t datalogON;
 
@@ -69,6 +83,14 @@ void NVIC_Init(void)
 	// Enable LPTMR0 interrupts in NVIC
 	NVIC_IRQ_ENABLE(LPTMR0_IRQn);
 
+#if TS_DEFERRED_PROCESSING
+	// PendSV (deferred electrodes scan processing) at the lowest priority
+	S32_SCB->SHPR3 = (S32_SCB->SHPR3 & ~0x00FF0000) | (0xF0 << 16);
+#if FREQUENCY_HOPPING
+	// Enable LPIT0 channel 0 interrupts in NVIC (second period/frequency acquisition)
+	NVIC_IRQ_ENABLE(LPIT0_Ch0_IRQn);
+#endif
+#endif
 }
 
 /*****************************************************************************
@@ -130,6 +152,9 @@ void GPIO_Init(void)
  *****************************************************************************/
 void RGBLED_Ctrl(void)
 {
+	uint32_t  elecNum;
+	uint8_t   ledColor;
+
 	// No touch event
 	electrodeTouchQualifiedDisplay = 0xFF;
 
@@ -145,108 +170,20 @@ void RGBLED_Ctrl(void)
 		}
 	}
 
-	// Display touch event
-	switch(electrodeTouchQualifiedDisplay)
-	{
-#ifdef ELEC0
-	case 0:
-	{
-		// Turn ON RED LED
-		LedRedON();
-		// Turn ON GREEN LED
-		LedGreenON();
-		// Turn ON BLUE LED
-		LedBlueON();
-
-		break;
-	}
-#endif
-
-#ifdef ELEC1
-	case 1:
-	{
-		// Turn ON RED LED
-		LedRedON();
-		// Turn OFF GREEN LED
-		LedGreenOFF();
-		// Turn OFF BLUE LED
-		LedBlueOFF();
-
-		break;
-	}
-#endif
-
-#ifdef ELEC2
-	case 2:
-	{
-		// Turn OFF RED LED
-		LedRedOFF();
-		// Turn ON GREEN LED
-		LedGreenON();
-		// Turn OFF BLUE LED
-		LedBlueOFF();
-
-		break;
-	}
-#endif
-
-#ifdef ELEC3
-	case 3:
-	{
-		// Turn OFF RED LED
-		LedRedOFF();
-		// Turn OFF GREEN LED
-		LedGreenOFF();
-		// Turn ON BLUE LED
-		LedBlueON();
-
-		break;
-	}
-#endif
-
-#ifdef ELEC4
-	case 4:
+	// Touch button touched?
+	if (electrodeTouchQualifiedDisplay != 0xFF)
 	{
-		// Turn ON RED LED
-		LedRedON();
-		// Turn ON GREEN LED
-		LedGreenON();
-		// Turn OFF BLUE LED
-		LedBlueOFF();
-
-		break;
+		// Electrode color
+		ledColor = electrodeLedColor[electrodeTouchQualifiedDisplay % NUMBER_OF_LED_COLORS];
+
+		// Turn ON/OFF RED LED
+		if (ledColor & LED_COLOR_RED) {LedRedON();} else {LedRedOFF();}
+		// Turn ON/OFF GREEN LED
+		if (ledColor & LED_COLOR_GREEN) {LedGreenON();} else {LedGreenOFF();}
+		// Turn ON/OFF BLUE LED
+		if (ledColor & LED_COLOR_BLUE) {LedBlueON();} else {LedBlueOFF();}
 	}
-#endif
-
-#ifdef ELEC5
-	case 5:
-	{
-		// Turn OFF RED LED
-		LedRedOFF();
-		// Turn ON GREEN LED
-		LedGreenON();
-		// Turn ON BLUE LED
-		LedBlueON();
-
-		break;
-	}
-#endif
-
-#ifdef ELEC6
-	case 6:
-	{
-		// Turn ON RED LED
-		LedRedON();
-		// Turn OFF GREEN LED
-		LedGreenOFF();
-		// Turn ON BLUE LED
-		LedBlueON();
-
-		break;
-	}
-#endif
-
-	case 0xFF:
+	else
 	{
 #if SLIDER_ENABLE
 		// Display slider touch position if no touch button was touched as they have priority over slider
@@ -264,9 +201,6 @@ void RGBLED_Ctrl(void)
 			// Turn OFF BLUE LED
 			LedBlueOFF();
 		}
-
-		break;
-	}
 	}
 }
 /*****************************************************************************
@@ -422,6 +356,12 @@ void Slider_RGBLED_Ctrl(void)
  *****************************************************************************/
 void main(void)
 { 
+#ifdef DEBUG_SCAN_TIMING
+	// Start DWT cycle counter to measure startup and electrodes scan time,
+	// startup time counts from here, not from reset
+	DWT_CYCCNT_ENABLE
+#endif
+
 	// Set clock mode
 	clockMode = RUN_FIRC;
 
@@ -443,17 +383,35 @@ void main(void)
 	LPIT_Init(ELECTRODES_SENSE_PERIOD_FH);
 #endif
 
-	// ADC0 calibration init
-	calibrationGainADC0 = ADC0_Calibration();
-
-	// ADC1 calibration init
-	calibrationGainADC1 = ADC1_Calibration();
+#if TS_WARM_START
+	// Valid warm start snapshot in data flash?
+	if (ElectrodeWarmStartCheck() == YES)
+	{
+		// ADC0 and ADC1 calibration from the snapshot
+		ElectrodeWarmStartAdcRestore();
+	}
+	else
+#endif
+	{
+#ifdef DEBUG_SCAN_TIMING
+		uint32_t adcCalStart = DWT_CYCCNT_REG;
+#endif
+		// ADC0 and ADC1 calibration init, both at the same time
+		ADC_CalibrationStart(ADC0);
+		ADC_CalibrationStart(ADC1);
+		calibrationGainADC0 = ADC_CalibrationWait(ADC0);
+		calibrationGainADC1 = ADC_CalibrationWait(ADC1);
+#ifdef DEBUG_SCAN_TIMING
+		// ADC calibration duration
+		startupTimingAdcCalCycles = DWT_CYCCNT_REG - adcCalStart;
+#endif
+	}
 
 	// ADC0 init (sample time, samples number to average)
-	ADC0_Init(14, 0, clockMode);
+	ADC0_Init(ADC_SAMPLE_TIME_SW, 0, clockMode);
 
 	// ADC1 init (sample time, samples number to average)
-	ADC1_Init(14, 0, clockMode);
+	ADC1_Init(ADC_SAMPLE_TIME_SW, 0, clockMode);
 
 	// FTM2 init
 	FTM2_Init();
@@ -461,6 +419,11 @@ void main(void)
 	// GPIO init
 	GPIO_Init();
 
+#if TS_DMA_ACQUISITION
+	// DMA init for electrodes acquisition
+	DMA_Init();
+#endif
+
 	// Low power mode control disabled
 	lowPowerModeCtrl = OFF;
 
@@ -486,6 +449,9 @@ void main(void)
 	SliderElectrodeTouchSenseInit();
 #endif
 
+	// Gather all electrodes pins per GPIO port
+	ElectrodesPortMaskInit();
+
 	// Init backlight PWM dutycycle
 	backlightPWMDutyCycle = BACKLIGHT_PWM_DUTYCYCLE;
 
@@ -501,13 +467,27 @@ void main(void)
 		// Control RGB LED - touch events display
 		RGBLED_Ctrl();
 
+#if TS_WARM_START
+		// Warm start snapshot store requested by the self-trim?
+		if (warmStartSaveRequest == YES)
+		{
+			// Store the snapshot to data flash
+			ElectrodeWarmStartSave();
+		}
+#endif
+
 		// Enable FreeMASTER poll, when low power mode disabled
 		if (lowPowerModeEnable == NO)
 		{
 			FMSTR_Poll();
 		}
 		// Run low power mode?
+#if (TS_DEFERRED_PROCESSING && FREQUENCY_HOPPING)
+		// Not before second period/frequency acquisition, LPIT stops in VLPS
+		if ((lowPowerModeCtrl == ON) && (lowPowerModeEnable == YES) && ((LPIT0->TMR[0].TCTRL & LPIT_TMR_TCTRL_T_EN_MASK) == 0))
+#else
 		if ((lowPowerModeCtrl == ON) && (lowPowerModeEnable == YES))
+#endif
 		{
 			// S32K144EVB Q100 board
 			// RUN_FIRC mode typ. 20mA
@@ -23,6 +23,14 @@
 // This function disables IRQ interrupts by setting the I-bit in the CPSR.
 #define DisableInterrupts asm(" CPSID i");
 
+/*!< Macro to save the interrupt mask and disable all interrupts. */
+// Saves PRIMASK to the variable, then sets the I-bit. Use with RestoreInterrupts for short critical sections.
+#define SaveAndDisableInterrupts(primask) asm volatile (" MRS %0, primask\n CPSID i" : "=r" (primask) :: "memory");
+
+/*!< Macro to restore the interrupt mask. */
+// Writes PRIMASK saved by SaveAndDisableInterrupts, interrupts stay disabled if they were before.
+#define RestoreInterrupts(primask) asm volatile (" MSR primask, %0" :: "r" (primask) : "memory");
+
 /* Set IRQ priority */
 /* Accepts NVIC IRQ number (not the Cortex-M4F vector number) */
 #define NVIC_SET_IRQ_PRIORITY_LEVEL(IrqNum,Priority)    (S32_NVIC->IP[IrqNum] = ((Priority & 0x0F) << 4))
@@ -35,9 +43,23 @@
 /* Accepts NVIC IRQ number (not the Cortex-M4F vector number) */
 #define NVIC_IRQ_DISABLE(IrqNum)                        (S32_NVIC->ICER[IrqNum / 32] |= (1 << (IrqNum % 32)))
 
+/* Clear IRQ pending flag */
+/* Accepts NVIC IRQ number (not the Cortex-M4F vector number) */
+#define NVIC_IRQ_CLEAR_PENDING(IrqNum)                  (S32_NVIC->ICPR[IrqNum / 32] = (1 << (IrqNum % 32)))
+
 /* Modify 32bit register bit: Read, Modify, Write */
 #define R_RMW32(address, bit, value)   (REG_WRITE32((address), ((REG_READ32(address)& ((uint32_t)~((uint32_t)(1 << bit))))| ((uint32_t)(value << bit)))))
 
+/*******************************************************************************
+* DWT cycle counter (Cortex-M4 debug unit, not included in S32K144.h)
+*******************************************************************************/
+#define DWT_CTRL_REG     (*(volatile uint32_t *)0xE0001000)
+#define DWT_CYCCNT_REG   (*(volatile uint32_t *)0xE0001004)
+#define DEMCR_REG        (*(volatile uint32_t *)0xE000EDFC)
+
+/* Enable trace, clear and start DWT cycle counter */
+#define DWT_CYCCNT_ENABLE   {DEMCR_REG |= (1 << 24); DWT_CYCCNT_REG = 0; DWT_CTRL_REG |= 1;}
+
 /*******************************************************************************
 * Defines
 *******************************************************************************/
@@ -46,6 +68,12 @@
 #define ON    1
 #define OFF   0
 
+// RGB LED colors of touched electrodes, repeated every NUMBER_OF_LED_COLORS electrodes
+#define LED_COLOR_RED         0x01
+#define LED_COLOR_GREEN       0x02
+#define LED_COLOR_BLUE        0x04
+#define NUMBER_OF_LED_COLORS  7
+
 /*******************************************************************************
 * Function Prototypes
 *******************************************************************************/
@@ -26,6 +26,31 @@ typedef unsigned char       tBool;          /*!< basic boolean type */
 #define TRUE ((tBool)1)                     /*!< Boolean type TRUE constant */
 #endif
 
+// Slider electrode processing state, everything the per-scan pipeline reads and writes for one slider electrode
+typedef struct
+{
+	// Capacitance to equivalent voltage conversion
+	int32_t   adcDataElectrodeDischargeRaw[NUMBER_OF_HOPPING_FREQUENCIES];
+#if DECIMATION_FILTER
+	int32_t   adcDataElectrodeDischargeRawDF[NUMBER_OF_HOPPING_FREQUENCIES];
+#endif
+	// DC Tracker
+	int32_t   DCTrackerDataBufferRaw;
+	int32_t   DCTrackerDataBuffer;
+	// DC tracker consecutive samples above baseline (release direction)
+	int16_t   DCTrackerSlewRun;
+	// LP Filter
+	tFrac32   LPFilterData[NUMBER_OF_HOPPING_FREQUENCIES];
+	tFilterIIR1Buffer LPFilterBuffer[NUMBER_OF_HOPPING_FREQUENCIES];
+	// Detector
+	int32_t   detectorThresholdTouch;
+	int16_t   detectorThresholdTouchDelta;
+	uint8_t   DCTrackerDataShift;
+	uint8_t   LPFilterType;
+	uint8_t   electrodeTouch[NUMBER_OF_HOPPING_FREQUENCIES];
+}
+tSliderElecData;
+
 /*******************************************************************************
 * Function prototypes
 ******************************************************************************/
@@ -41,27 +66,30 @@ void SliderDifferenceDataHelperThresholds(void);
 void SliderElectrodeCapToVoltConvELCH(uint32_t sliderElectrodeNum);
 void SliderSimultaneousElectrodeCapToVoltConvELCH(uint32_t sliderElectrode0Num,uint32_t sliderElectrode1Num);
 void SliderElectrodesTouchElecSense(void);
-void SliderDataCalculation(uint32_t sliderElectrode0Num,uint32_t sliderElectrode1Num);
-void SliderDifferenceDataElectrodeTouchQualify (uint32_t sliderElectrode0Num,uint32_t sliderElectrode1Num);
+void SliderElectrodesTouchElecAcquire(void);
+void SliderElectrodesTouchProcess(uint8_t scanFrequencyID);
+void SliderEnableUpdate(void);
+void SliderBaselineReseed(uint8_t scanFrequencyID);
+void SliderDataCalculation(uint32_t sliderElectrode0Num,uint32_t sliderElectrode1Num, uint8_t scanFrequencyID);
+void SliderDifferenceDataElectrodeTouchQualify (uint32_t sliderElectrode0Num,uint32_t sliderElectrode1Num, uint8_t scanFrequencyID);
 
 void SliderelectrodeWakeElecSense(void);
 void SliderelectrodeWakeAndTouchElecSense(void);
 
-void FindMinimumAndDeleteIt(int16_t sliderInputSamplesArray[]);
-void FindMaximumAndDeleteIt(int16_t sliderInputSamplesArray[]);
-void SliderSensingCyclesChange(void);
+void SliderTrimAccInit(void);
+void SliderRawDataCalc(uint32_t sliderElectrodeNum, tTrimAcc *accPtr);
+void SliderSensingCyclesChange(uint8_t scanFrequencyID);
 void SliderSensingCyclesChangeEGS(void);
 
 void SliderElectrodeWakeElecFilterLoad(void);
-void SliderNoiseCanceling(void);
 void SliderElectrodeCapToVoltConvELCHGuard(uint32_t sliderElectrode0Num,uint32_t sliderElectrode1Num);
 
 void SliderElecOversamplingActivation(void);
 void SliderElecOversamplingDeactivation(void);
 
-void SliderElectrodeTouchDetect(uint32_t electrodeNum);
+void SliderElectrodeTouchDetect(uint32_t electrodeNum, uint8_t scanFrequencyID);
 
-void SliderDecimationFilter(uint32_t electrodeNum);
+void SliderDecimationFilter(uint32_t electrodeNum, uint8_t scanFrequencyID);
 
 
 #endif /* SLIDER_H_ */
@@ -0,0 +1,24 @@
+/****************************************************************************//*!
+*
+* @file     host_asm.h
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Cortex-M4 instructions used by the firmware inline assembly, assembled
+*           as no operation on the x86-64 host (force-included by the Makefile)
+*
+*******************************************************************************/
+#ifndef __HOST_ASM_H
+#define __HOST_ASM_H
+
+// Interrupts enable/disable and sleep - no operation, MRS reads zero, MSR ignored
+__asm__(".macro cpsid f\n.endm\n"
+		".macro cpsie f\n.endm\n"
+		".macro wfi\n.endm\n"
+		".macro wfe\n.endm\n"
+		".macro mrs r, s\n xorl \\r, \\r\n.endm\n"
+		".macro msr s, r\n.endm\n");
+
+#endif /* __HOST_ASM_H */
@@ -0,0 +1,122 @@
+/****************************************************************************//*!
+*
+* @file     host_fw.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Touch sense firmware startup and electrodes sensing period on the host
+*
+* @note     Same startup sequence as main(), clock (SCG, PCC), FreeMASTER and low
+*           power mode left out. Every LPTMR0 interrupt is one sensing period.
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include "host_test.h"
+#include "S32K144.h"
+#include "main.h"
+#include "ts_cfg.h"
+#include "ets.h"
+#include "slider.h"
+#include "adc.h"
+#include "timer.h"
+#include "power_mode.h"
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+extern tElecStatus  electrodesStatus;
+#if SLIDER_ENABLE
+extern tElecStatus  sliderElectrodesStatus;
+#endif
+extern int16_t  calibrationGainADC0, calibrationGainADC1;
+extern uint8_t  clockMode;
+
+void LPTMR0_IRQHandler(void);
+
+/*****************************************************************************
+*
+* Function: void HostTouchSenseInit(void)
+*
+* Description: Touch sense startup as in main() - ADC calibration (or warm start
+* 				restore), ADC init, touch button and slider electrodes init
+*
+*****************************************************************************/
+void HostTouchSenseInit(void)
+{
+	clockMode = RUN_FIRC;
+
+#if TS_WARM_START
+	// Valid warm start snapshot in data flash?
+	if (ElectrodeWarmStartCheck() == YES)
+	{
+		// ADC0 and ADC1 calibration from the snapshot
+		ElectrodeWarmStartAdcRestore();
+	}
+	else
+#endif
+	{
+		// ADC0 and ADC1 calibration
+		ADC_CalibrationStart(ADC0);
+		ADC_CalibrationStart(ADC1);
+		calibrationGainADC0 = ADC_CalibrationWait(ADC0);
+		calibrationGainADC1 = ADC_CalibrationWait(ADC1);
+	}
+
+	ADC0_Init(ADC_SAMPLE_TIME_SW, 0, clockMode);
+	ADC1_Init(ADC_SAMPLE_TIME_SW, 0, clockMode);
+
+	ElectrodeTouchSenseInit();
+#if SLIDER_ENABLE
+	SliderElectrodeTouchSenseInit();
+#endif
+	ElectrodesPortMaskInit();
+}
+
+/*****************************************************************************
+*
+* Function: void HostTouchSensePeriods(uint32_t periodsNum)
+*
+* Description: Run electrodes sensing periods (LPTMR0 interrupts)
+*
+*****************************************************************************/
+void HostTouchSensePeriods(uint32_t periodsNum)
+{
+	while (periodsNum--)
+	{
+		LPTMR0_IRQHandler();
+	}
+}
+
+/*****************************************************************************
+*
+* Function: uint32_t HostTouchSenseSelfTrim(uint32_t periodsMax)
+*
+* Description: Run sensing periods until touch button (and slider) electrodes self-trim done
+*
+* Output: Sensing periods of the self-trim, periodsMax when not done
+*
+*****************************************************************************/
+uint32_t HostTouchSenseSelfTrim(uint32_t periodsMax)
+{
+	uint32_t  periodNum;
+
+	for (periodNum = 0; periodNum < periodsMax; periodNum++)
+	{
+#if SLIDER_ENABLE
+		if ((electrodesStatus.bit.selfTrimDone == YES) && (sliderElectrodesStatus.bit.selfTrimDone == YES))
+#else
+		if (electrodesStatus.bit.selfTrimDone == YES)
+#endif
+		{
+			break;
+		}
+		LPTMR0_IRQHandler();
+	}
+
+	return periodNum;
+}
@@ -0,0 +1,866 @@
+/****************************************************************************//*!
+*
+* @file     host_hw.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Host register model of the S32K144 peripherals used by the touch sense
+*
+* @note     x86-64 Linux only. Protected register pages trap every access (SIGSEGV),
+*           the access is single-stepped with the page unprotected (SIGTRAP) and the
+*           peripheral behaviour is applied after it. The model reads and writes the
+*           registers through a second, unprotected mapping of the same memory.
+*
+*******************************************************************************/
+#define _GNU_SOURCE
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <signal.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include "host_test.h"
+#include "S32K144.h"
+#include "S32K144_features.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+#define HOST_PAGE_SIZE   0x1000u
+
+// x86 page fault error code - write access, EFLAGS trap flag
+#define HOST_PF_WRITE    0x2
+#define HOST_EFLAGS_TF   0x100
+
+// Number of GPIO ports
+#define HOST_GPIO_PORTS  5
+
+// eDMA channels
+#define HOST_DMA_CHANNELS  16
+
+// eDMA and DMAMUX registers in the unprotected mapping
+#define HOST_DMA     ((DMA_Type *)HostReg(DMA_BASE))
+#define HOST_DMAMUX  ((DMAMUX_Type *)HostReg(DMAMUX_BASE))
+
+// FTFC commands used on the data flash
+#define HOST_FTFC_PROGRAM_PHRASE   0x07
+#define HOST_FTFC_ERASE_SECTOR     0x09
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+// Register accesses recorded
+tHostRegAccess  hostRegTrace[HOST_REG_TRACE_SIZE];
+uint32_t  hostRegTraceNum;
+uint8_t   hostRegTraceOn;
+
+// ADC model
+int32_t (*hostAdcModel)(uint32_t adcNum, uint32_t channel);
+uint32_t  hostAdcConversions[2];
+uint32_t  hostAdcSimultaneousConversions;
+
+// eDMA model
+uint32_t  hostDmaMinorLoops;
+
+// Emulated data flash
+uint32_t  hostFlashErases, hostFlashPhrases;
+int32_t   hostFlashPhraseLimit = -1;
+
+// Checks failed
+static uint32_t  hostTestChecks, hostTestFailures;
+
+// Unprotected mapping of the peripheral bridge
+static uint8_t  *hostPeriphAlias;
+
+// Pages trapping every access
+static const uint32_t  hostRegPages[] =
+{
+	ADC0_BASE, ADC1_BASE, SIM_BASE, FTFC_BASE, DMA_BASE,
+	PORTA_BASE, PORTB_BASE, PORTC_BASE, PORTD_BASE, PORTE_BASE,
+	PTA_BASE & ~(HOST_PAGE_SIZE - 1)
+};
+
+// Access being single-stepped
+static uint32_t  hostRegPendingAddress, hostRegPendingPage;
+static uint8_t   hostRegPendingWrite;
+
+// eDMA channels requested (bit per channel), requests being served
+static uint32_t  hostDmaPending;
+static uint8_t   hostDmaActive;
+
+// FTFC status, command complete
+static uint8_t   hostFtfcStatus = FTFC_FSTAT_CCIF_MASK;
+
+// Random generator state
+static uint32_t  hostRandomState = 1;
+
+/*******************************************************************************
+* Stubs of the application (main.c) and FreeMASTER
+*******************************************************************************/
+int16_t   calibrationGainADC0;
+int16_t   calibrationGainADC1;
+uint8_t   clockMode;
+uint8_t   electrodeTouchQualifiedDisplay;
+uint8_t   sliderElectrodeTouchQualifiedDisplay;
+#ifdef DEBUG_SCAN_TIMING
+uint32_t  startupTimingAdcCalCycles;
+#endif
+
+void FMSTR_Recorder(void)
+{
+}
+
+static void HostRegAccess(uint32_t byteAddress, uint8_t write);
+static void HostDmaService(void);
+
+/*****************************************************************************
+*
+* Function: uint32_t *HostReg(uint32_t address)
+*
+* Description: Register in the unprotected mapping
+*
+*****************************************************************************/
+static volatile uint32_t *HostReg(uint32_t address)
+{
+	return (volatile uint32_t *)(hostPeriphAlias + ((address & ~3u) - HOST_PERIPH_BASE));
+}
+
+/*****************************************************************************
+*
+* Function: uint32_t HostRegRead(uint32_t address)
+*
+* Description: Read register without an access to the model (not traced)
+*
+*****************************************************************************/
+uint32_t HostRegRead(uint32_t address)
+{
+	return *HostReg(address);
+}
+
+/*****************************************************************************
+*
+* Function: void HostRegWrite(uint32_t address, uint32_t value)
+*
+* Description: Write register without an access to the model (not traced)
+*
+*****************************************************************************/
+void HostRegWrite(uint32_t address, uint32_t value)
+{
+	*HostReg(address) = value;
+}
+
+/*****************************************************************************
+*
+* Function: uint8_t HostRegTrapped(uint32_t address)
+*
+* Description: Register on a page trapping every access?
+*
+*****************************************************************************/
+static uint8_t HostRegTrapped(uint32_t address)
+{
+	uint32_t  pageNum;
+
+	for (pageNum = 0; pageNum < sizeof(hostRegPages) / sizeof(hostRegPages[0]); pageNum++)
+	{
+		if ((address & ~(HOST_PAGE_SIZE - 1)) == hostRegPages[pageNum])
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+/*****************************************************************************
+*
+* Function: uint32_t HostBusRead(uint32_t address, uint32_t size), void HostBusWrite(uint32_t address, uint32_t value, uint32_t size)
+*
+* Description: Bus master (eDMA) access of memory or register, register accesses
+* 				go to the model as CPU accesses do
+*
+*****************************************************************************/
+static uint32_t HostBusRead(uint32_t address, uint32_t size)
+{
+	uint32_t  value = 0;
+
+	if ((address >= HOST_PERIPH_BASE) && (address < HOST_PERIPH_BASE + HOST_PERIPH_SIZE))
+	{
+		memcpy(&value, hostPeriphAlias + (address - HOST_PERIPH_BASE), size);
+		if (HostRegTrapped(address))
+		{
+			HostRegAccess(address, 0);
+		}
+	}
+	else
+	{
+		memcpy(&value, (void *)(uintptr_t)address, size);
+	}
+
+	return value;
+}
+
+static void HostBusWrite(uint32_t address, uint32_t value, uint32_t size)
+{
+	if ((address >= HOST_PERIPH_BASE) && (address < HOST_PERIPH_BASE + HOST_PERIPH_SIZE))
+	{
+		memcpy(hostPeriphAlias + (address - HOST_PERIPH_BASE), &value, size);
+		if (HostRegTrapped(address))
+		{
+			HostRegAccess(address, 1);
+		}
+	}
+	else
+	{
+		memcpy((void *)(uintptr_t)address, &value, size);
+	}
+}
+
+/*****************************************************************************
+*
+* Function: void HostDmaChannelService(uint32_t channel)
+*
+* Description: One minor loop of the eDMA channel, major loop completion with
+* 				scatter/gather, minor and major loop channel linking
+*
+* Note: Source and destination size equal, minor loop mapping disabled
+*
+*****************************************************************************/
+static void HostDmaChannelService(uint32_t channel)
+{
+	volatile DMA_Type  *dmaPtr = HOST_DMA;
+	uint32_t  size, byteNum, citer, citerMask, linkChannel;
+	uint16_t  csr;
+
+	dmaPtr->TCD[channel].CSR = (dmaPtr->TCD[channel].CSR & ~(DMA_TCD_CSR_START_MASK | DMA_TCD_CSR_DONE_MASK)) | DMA_TCD_CSR_ACTIVE_MASK;
+
+	// Minor loop
+	size = 1u << (dmaPtr->TCD[channel].ATTR & DMA_TCD_ATTR_DSIZE_MASK);
+	for (byteNum = 0; byteNum < dmaPtr->TCD[channel].NBYTES.MLNO; byteNum += size)
+	{
+		HostBusWrite(dmaPtr->TCD[channel].DADDR, HostBusRead(dmaPtr->TCD[channel].SADDR, size), size);
+		dmaPtr->TCD[channel].SADDR += (int16_t)dmaPtr->TCD[channel].SOFF;
+		dmaPtr->TCD[channel].DADDR += (int16_t)dmaPtr->TCD[channel].DOFF;
+	}
+	hostDmaMinorLoops++;
+
+	// Major loop iterations left, minor loop link channel
+	if (dmaPtr->TCD[channel].CITER.ELINKYES & DMA_TCD_CITER_ELINKYES_ELINK_MASK)
+	{
+		citerMask = DMA_TCD_CITER_ELINKYES_CITER_LE_MASK;
+		linkChannel = (dmaPtr->TCD[channel].CITER.ELINKYES & DMA_TCD_CITER_ELINKYES_LINKCH_MASK) >> DMA_TCD_CITER_ELINKYES_LINKCH_SHIFT;
+	}
+	else
+	{
+		citerMask = DMA_TCD_CITER_ELINKNO_CITER_MASK;
+		linkChannel = HOST_DMA_CHANNELS;
+	}
+	citer = (dmaPtr->TCD[channel].CITER.ELINKNO & citerMask) - 1;
+	csr = dmaPtr->TCD[channel].CSR & ~DMA_TCD_CSR_ACTIVE_MASK;
+
+	if (citer > 0)
+	{
+		dmaPtr->TCD[channel].CITER.ELINKNO = (dmaPtr->TCD[channel].CITER.ELINKNO & ~citerMask) | citer;
+		dmaPtr->TCD[channel].CSR = csr;
+		// Minor loop link (not on the last iteration)
+		if (linkChannel < HOST_DMA_CHANNELS)
+		{
+			hostDmaPending |= 1u << linkChannel;
+		}
+		return;
+	}
+
+	// Major loop done
+	dmaPtr->TCD[channel].SADDR += dmaPtr->TCD[channel].SLAST;
+	if (csr & DMA_TCD_CSR_DREQ_MASK)
+	{
+		dmaPtr->ERQ &= ~(1u << channel);
+	}
+	if (csr & DMA_TCD_CSR_MAJORELINK_MASK)
+	{
+		hostDmaPending |= 1u << ((csr & DMA_TCD_CSR_MAJORLINKCH_MASK) >> DMA_TCD_CSR_MAJORLINKCH_SHIFT);
+	}
+	if (csr & DMA_TCD_CSR_ESG_MASK)
+	{
+		// Scatter/gather - load the next TCD, started at once if its START set
+		memcpy((void *)&dmaPtr->TCD[channel], (void *)(uintptr_t)dmaPtr->TCD[channel].DLASTSGA, sizeof(dmaPtr->TCD[channel]));
+		if (dmaPtr->TCD[channel].CSR & DMA_TCD_CSR_START_MASK)
+		{
+			hostDmaPending |= 1u << channel;
+		}
+	}
+	else
+	{
+		dmaPtr->TCD[channel].DADDR += dmaPtr->TCD[channel].DLASTSGA;
+		dmaPtr->TCD[channel].CITER.ELINKNO = dmaPtr->TCD[channel].BITER.ELINKNO;
+		dmaPtr->TCD[channel].CSR = csr | DMA_TCD_CSR_DONE_MASK;
+	}
+}
+
+/*****************************************************************************
+*
+* Function: void HostDmaService(void)
+*
+* Description: Serve requested eDMA channels until none is left
+*
+* Note: Lowest channel first - the ADC conversion outlasts the sequence steps
+* 		queued behind its start, the result is read after them as on the target
+*
+*****************************************************************************/
+static void HostDmaService(void)
+{
+	uint32_t  channel;
+
+	// Already serving (request from a register access of a channel)?
+	if (hostDmaActive)
+	{
+		return;
+	}
+	hostDmaActive = 1;
+
+	while (hostDmaPending)
+	{
+		channel = __builtin_ctz(hostDmaPending);
+		hostDmaPending &= ~(1u << channel);
+		HostDmaChannelService(channel);
+	}
+
+	hostDmaActive = 0;
+}
+
+/*****************************************************************************
+*
+* Function: void HostAdcConvert(uint32_t adcNum)
+*
+* Description: Complete the conversion of the ADC SC1[0] channel
+*
+*****************************************************************************/
+static void HostAdcConvert(uint32_t adcNum)
+{
+	uint32_t  adcBase = (adcNum == 0) ? ADC0_BASE : ADC1_BASE;
+	uint32_t  adcChannel, mode, resolution, channel;
+	int32_t   result;
+
+	adcChannel = *HostReg(adcBase + offsetof(ADC_Type, SC1[0])) & 0x3F;
+
+	// Module disabled?
+	if (adcChannel == 0x3F)
+	{
+		return;
+	}
+
+	// Conversion result, 12-bit
+	result = (hostAdcModel != 0) ? hostAdcModel(adcNum, adcChannel) : 0;
+	if (result < 0)
+	{
+		result = 0;
+	}
+	if (result > 4095)
+	{
+		result = 4095;
+	}
+
+	// Scaled to the CFG1 MODE resolution (8-bit 0, 12-bit 1, 10-bit 2)
+	mode = (*HostReg(adcBase + offsetof(ADC_Type, CFG1)) & ADC_CFG1_MODE_MASK) >> ADC_CFG1_MODE_SHIFT;
+	resolution = (mode == 0) ? 8 : ((mode == 2) ? 10 : 12);
+
+	*HostReg(adcBase + offsetof(ADC_Type, R[0])) = result >> (12 - resolution);
+	*HostReg(adcBase + offsetof(ADC_Type, SC1[0])) |= ADC_SC1_COCO_MASK;
+
+	hostAdcConversions[adcNum]++;
+
+	// Conversion complete DMA request, channels enabled with the ADC source
+	if (*HostReg(adcBase + offsetof(ADC_Type, SC2)) & ADC_SC2_DMAEN_MASK)
+	{
+		for (channel = 0; channel < HOST_DMA_CHANNELS; channel++)
+		{
+			if ((HOST_DMAMUX->CHCFG[channel] & DMAMUX_CHCFG_ENBL_MASK) && (HOST_DMA->ERQ & (1u << channel)) && \
+					((HOST_DMAMUX->CHCFG[channel] & DMAMUX_CHCFG_SOURCE_MASK) == ((adcNum == 0) ? EDMA_REQ_ADC0 : EDMA_REQ_ADC1)))
+			{
+				hostDmaPending |= 1u << channel;
+			}
+		}
+		HostDmaService();
+	}
+}
+
+/*****************************************************************************
+*
+* Function: uint8_t HostFtfcCommand(void)
+*
+* Description: Execute the FTFC command loaded in FCCOB on the data flash, NOR flash:
+* 				erase sets the sector to 0xFF, program clears bits only
+*
+* Output: FSTAT error flags
+*
+*****************************************************************************/
+static uint8_t HostFtfcCommand(void)
+{
+	volatile uint8_t  *fccobPtr = (volatile uint8_t *)HostReg(FTFC_BASE + offsetof(FTFC_Type, FCCOB));
+	uint32_t  address, word0, word1;
+	uint32_t  *flashPtr;
+
+	// FCCOB1..3 address, bit 23 selects FlexNVM
+	address = ((uint32_t)fccobPtr[2] << 16) | ((uint32_t)fccobPtr[1] << 8) | fccobPtr[0];
+	if ((address & 0x00800000) == 0)
+	{
+		return FTFC_FSTAT_ACCERR_MASK;
+	}
+	address = (address & 0x007FFFFF) + HOST_DFLASH_BASE;
+	if (address >= HOST_DFLASH_BASE + HOST_DFLASH_SIZE)
+	{
+		return FTFC_FSTAT_ACCERR_MASK;
+	}
+
+	switch (fccobPtr[3])
+	{
+	case HOST_FTFC_ERASE_SECTOR:
+	{
+		// Sector aligned
+		if (address & (HOST_DFLASH_SECTOR - 1))
+		{
+			return FTFC_FSTAT_ACCERR_MASK;
+		}
+		memset((void *)(uintptr_t)address, 0xFF, HOST_DFLASH_SECTOR);
+		hostFlashErases++;
+		return 0;
+	}
+	case HOST_FTFC_PROGRAM_PHRASE:
+	{
+		// Phrase aligned
+		if (address & 7)
+		{
+			return FTFC_FSTAT_ACCERR_MASK;
+		}
+		// Reset during programming simulated, phrase left unprogrammed
+		if ((hostFlashPhraseLimit >= 0) && (hostFlashPhrases >= (uint32_t)hostFlashPhraseLimit))
+		{
+			return 0;
+		}
+		// FCCOB4..7 first word, FCCOB8..B second word (little endian)
+		word0 = fccobPtr[7] | ((uint32_t)fccobPtr[6] << 8) | ((uint32_t)fccobPtr[5] << 16) | ((uint32_t)fccobPtr[4] << 24);
+		word1 = fccobPtr[11] | ((uint32_t)fccobPtr[10] << 8) | ((uint32_t)fccobPtr[9] << 16) | ((uint32_t)fccobPtr[8] << 24);
+		// Bits cleared only
+		flashPtr = (uint32_t *)(uintptr_t)address;
+		flashPtr[0] &= word0;
+		flashPtr[1] &= word1;
+		hostFlashPhrases++;
+		return 0;
+	}
+	default:
+		return FTFC_FSTAT_ACCERR_MASK;
+	}
+}
+
+/*****************************************************************************
+*
+* Function: void HostRegAccess(uint32_t address, uint8_t write)
+*
+* Description: Record the access and apply the peripheral behaviour
+*
+*****************************************************************************/
+static void HostRegAccess(uint32_t byteAddress, uint8_t write)
+{
+	uint32_t  address, adcNum, adcBase, portBase, offset, value, pinBase, pinNum, channel;
+	volatile uint32_t  *pcrPtr;
+	volatile uint8_t  *fstatPtr;
+	uint8_t   fstat;
+
+	address = byteAddress & ~3u;
+	value = *HostReg(address);
+
+	// Record the access
+	if (hostRegTraceOn && (hostRegTraceNum < HOST_REG_TRACE_SIZE))
+	{
+		hostRegTrace[hostRegTraceNum].address = address;
+		hostRegTrace[hostRegTraceNum].value = value;
+		hostRegTrace[hostRegTraceNum].write = write;
+		hostRegTraceNum++;
+	}
+
+	// ADC0 and ADC1
+	for (adcNum = 0; adcNum < 2; adcNum++)
+	{
+		adcBase = (adcNum == 0) ? ADC0_BASE : ADC1_BASE;
+		if ((address & ~(HOST_PAGE_SIZE - 1)) != adcBase)
+		{
+			continue;
+		}
+		offset = address - adcBase;
+
+		// Conversion started by software trigger?
+		if (write && (offset == offsetof(ADC_Type, SC1[0])) && \
+				((*HostReg(adcBase + offsetof(ADC_Type, SC2)) & ADC_SC2_ADTRG_MASK) == 0))
+		{
+			HostAdcConvert(adcNum);
+		}
+		// Result read, COCO cleared
+		else if (!write && (offset == offsetof(ADC_Type, R[0])))
+		{
+			*HostReg(adcBase + offsetof(ADC_Type, SC1[0])) &= ~ADC_SC1_COCO_MASK;
+		}
+		// Calibration started? Completes at once
+		else if (write && (offset == offsetof(ADC_Type, SC3)) && (value & ADC_SC3_CAL_MASK))
+		{
+			*HostReg(adcBase + offsetof(ADC_Type, SC3)) &= ~ADC_SC3_CAL_MASK;
+			*HostReg(adcBase + offsetof(ADC_Type, G)) = 0x2F0 + adcNum;
+			*HostReg(adcBase + offsetof(ADC_Type, CLPS)) = 0x2A + adcNum;
+			*HostReg(adcBase + offsetof(ADC_Type, CLP0)) = 0x15 + adcNum;
+			*HostReg(adcBase + offsetof(ADC_Type, SC1[0])) |= ADC_SC1_COCO_MASK;
+		}
+	}
+
+	// SIM software trigger of the hardware triggered ADCs
+	if (write && (address == SIM_BASE + offsetof(SIM_Type, MISCTRL1)) && (value & SIM_MISCTRL1_SW_TRG_MASK))
+	{
+		if ((*HostReg(ADC0_BASE + offsetof(ADC_Type, SC2)) & ADC_SC2_ADTRG_MASK) && \
+				(*HostReg(ADC1_BASE + offsetof(ADC_Type, SC2)) & ADC_SC2_ADTRG_MASK))
+		{
+			hostAdcSimultaneousConversions++;
+		}
+		for (adcNum = 0; adcNum < 2; adcNum++)
+		{
+			adcBase = (adcNum == 0) ? ADC0_BASE : ADC1_BASE;
+			if (*HostReg(adcBase + offsetof(ADC_Type, SC2)) & ADC_SC2_ADTRG_MASK)
+			{
+				HostAdcConvert(adcNum);
+			}
+		}
+	}
+
+	// GPIO set, clear and toggle registers
+	if (write && (address >= PTA_BASE) && (address < PTA_BASE + HOST_GPIO_PORTS * (PTB_BASE - PTA_BASE)))
+	{
+		portBase = PTA_BASE + ((address - PTA_BASE) / (PTB_BASE - PTA_BASE)) * (PTB_BASE - PTA_BASE);
+		offset = address - portBase;
+
+		if (offset == offsetof(GPIO_Type, PSOR))
+		{
+			*HostReg(portBase + offsetof(GPIO_Type, PDOR)) |= value;
+			*HostReg(address) = 0;
+		}
+		else if (offset == offsetof(GPIO_Type, PCOR))
+		{
+			*HostReg(portBase + offsetof(GPIO_Type, PDOR)) &= ~value;
+			*HostReg(address) = 0;
+		}
+		else if (offset == offsetof(GPIO_Type, PTOR))
+		{
+			*HostReg(portBase + offsetof(GPIO_Type, PDOR)) ^= value;
+			*HostReg(address) = 0;
+		}
+	}
+
+	// eDMA channel request enable/disable, DONE clear and software start
+	if (write && (byteAddress >= DMA_BASE + offsetof(DMA_Type, CEEI)) && (byteAddress <= DMA_BASE + offsetof(DMA_Type, CINT)))
+	{
+		channel = *((volatile uint8_t *)HostReg(DMA_BASE) + (byteAddress - DMA_BASE)) & (HOST_DMA_CHANNELS - 1);
+		switch (byteAddress - DMA_BASE)
+		{
+		case offsetof(DMA_Type, CERQ):
+			HOST_DMA->ERQ &= ~(1u << channel);
+			break;
+		case offsetof(DMA_Type, SERQ):
+			HOST_DMA->ERQ |= 1u << channel;
+			break;
+		case offsetof(DMA_Type, CDNE):
+			HOST_DMA->TCD[channel].CSR &= ~DMA_TCD_CSR_DONE_MASK;
+			break;
+		case offsetof(DMA_Type, SSRT):
+			hostDmaPending |= 1u << channel;
+			HostDmaService();
+			break;
+		default:
+			break;
+		}
+	}
+
+	// FTFC status write, flags cleared by writing 1, CCIF launches the command (completes at once)
+	if (write && (byteAddress == FTFC_BASE + offsetof(FTFC_Type, FSTAT)))
+	{
+		fstatPtr = (volatile uint8_t *)HostReg(FTFC_BASE + offsetof(FTFC_Type, FSTAT));
+		fstat = *fstatPtr;
+		hostFtfcStatus &= ~(fstat & (FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK));
+		if (fstat & FTFC_FSTAT_CCIF_MASK)
+		{
+			hostFtfcStatus = (hostFtfcStatus & ~FTFC_FSTAT_MGSTAT0_MASK) | HostFtfcCommand();
+		}
+		*fstatPtr = hostFtfcStatus;
+	}
+
+	// PORT global pin control, pins mask in the upper half, PCR[15:0] value in the lower half
+	if (write && (address >= PORTA_BASE) && (address < PORTE_BASE + HOST_PAGE_SIZE))
+	{
+		portBase = address & ~(HOST_PAGE_SIZE - 1);
+		offset = address - portBase;
+
+		if ((offset == offsetof(PORT_Type, GPCLR)) || (offset == offsetof(PORT_Type, GPCHR)))
+		{
+			// Pins 0-15 or 16-31
+			pinBase = (offset == offsetof(PORT_Type, GPCLR)) ? 0 : 16;
+			for (pinNum = 0; pinNum < 16; pinNum++)
+			{
+				if (value & (1u << (pinNum + 16)))
+				{
+					pcrPtr = HostReg(portBase + offsetof(PORT_Type, PCR) + 4 * (pinBase + pinNum));
+					*pcrPtr = (*pcrPtr & 0xFFFF0000) | (value & 0x0000FFFF);
+				}
+			}
+			*HostReg(address) = 0;
+		}
+	}
+}
+
+/*****************************************************************************
+*
+* Function: void HostRegFault(int sig, siginfo_t *info, void *context)
+*
+* Description: Protected register page accessed - unprotect it and single-step the access
+*
+*****************************************************************************/
+static void HostRegFault(int sig, siginfo_t *info, void *context)
+{
+	ucontext_t  *uc = (ucontext_t *)context;
+	uintptr_t  address = (uintptr_t)info->si_addr;
+	uint32_t  pageNum;
+
+	(void)sig;
+
+	// Register page?
+	for (pageNum = 0; pageNum < sizeof(hostRegPages) / sizeof(hostRegPages[0]); pageNum++)
+	{
+		if ((address & ~(uintptr_t)(HOST_PAGE_SIZE - 1)) == hostRegPages[pageNum])
+		{
+			break;
+		}
+	}
+	if (pageNum == sizeof(hostRegPages) / sizeof(hostRegPages[0]))
+	{
+		// Real fault
+		signal(SIGSEGV, SIG_DFL);
+		return;
+	}
+
+	hostRegPendingAddress = (uint32_t)address;
+	hostRegPendingPage = hostRegPages[pageNum];
+	hostRegPendingWrite = (uc->uc_mcontext.gregs[REG_ERR] & HOST_PF_WRITE) ? 1 : 0;
+
+	mprotect((void *)(uintptr_t)hostRegPendingPage, HOST_PAGE_SIZE, PROT_READ | PROT_WRITE);
+	uc->uc_mcontext.gregs[REG_EFL] |= HOST_EFLAGS_TF;
+}
+
+/*****************************************************************************
+*
+* Function: void HostRegStep(int sig, siginfo_t *info, void *context)
+*
+* Description: Register access done - apply the peripheral behaviour, protect the page again
+*
+*****************************************************************************/
+static void HostRegStep(int sig, siginfo_t *info, void *context)
+{
+	ucontext_t  *uc = (ucontext_t *)context;
+
+	(void)sig;
+	(void)info;
+
+	uc->uc_mcontext.gregs[REG_EFL] &= ~HOST_EFLAGS_TF;
+
+	HostRegAccess(hostRegPendingAddress, hostRegPendingWrite);
+
+	mprotect((void *)(uintptr_t)hostRegPendingPage, HOST_PAGE_SIZE, PROT_NONE);
+}
+
+/*****************************************************************************
+*
+* Function: void HostHwInit(void)
+*
+* Description: Map the peripherals and data flash at the S32K144 addresses before main()
+*
+*****************************************************************************/
+__attribute__((constructor)) static void HostHwInit(void)
+{
+	struct sigaction  action;
+	uint32_t  pageNum;
+	int  fd;
+	void *ptr;
+
+	// Peripheral bridge, mapped twice: firmware view with trapping pages, model view
+	fd = memfd_create("s32k144_periph", 0);
+	if ((fd < 0) || (ftruncate(fd, HOST_PERIPH_SIZE) != 0))
+	{
+		perror("host_hw: peripheral memory");
+		exit(2);
+	}
+	ptr = mmap((void *)(uintptr_t)HOST_PERIPH_BASE, HOST_PERIPH_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+	hostPeriphAlias = mmap(0, HOST_PERIPH_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if ((ptr == MAP_FAILED) || (hostPeriphAlias == MAP_FAILED))
+	{
+		perror("host_hw: peripheral mapping");
+		exit(2);
+	}
+
+	// Private peripheral bus (NVIC, SCB, DWT, LMEM)
+	ptr = mmap((void *)(uintptr_t)HOST_PPB_BASE, HOST_PPB_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+	if (ptr == MAP_FAILED)
+	{
+		perror("host_hw: private peripheral bus mapping");
+		exit(2);
+	}
+
+	// FlexNVM data flash, erased
+	ptr = mmap((void *)(uintptr_t)HOST_DFLASH_BASE, HOST_DFLASH_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+	if (ptr == MAP_FAILED)
+	{
+		perror("host_hw: data flash mapping");
+		exit(2);
+	}
+	HostFlashErase();
+	*HostReg(FTFC_BASE + offsetof(FTFC_Type, FSTAT)) = hostFtfcStatus;
+
+	// Register access trap and single-step
+	memset(&action, 0, sizeof(action));
+	action.sa_flags = SA_SIGINFO;
+	action.sa_sigaction = HostRegFault;
+	sigaction(SIGSEGV, &action, 0);
+	action.sa_sigaction = HostRegStep;
+	sigaction(SIGTRAP, &action, 0);
+
+	for (pageNum = 0; pageNum < sizeof(hostRegPages) / sizeof(hostRegPages[0]); pageNum++)
+	{
+		mprotect((void *)(uintptr_t)hostRegPages[pageNum], HOST_PAGE_SIZE, PROT_NONE);
+	}
+}
+
+/*****************************************************************************
+*
+* Function: void HostRegTraceStart(void)
+*
+* Description: Clear the register access trace and start recording
+*
+*****************************************************************************/
+void HostRegTraceStart(void)
+{
+	hostRegTraceNum = 0;
+	hostRegTraceOn = 1;
+}
+
+/*****************************************************************************
+*
+* Function: void HostRegTraceStop(void)
+*
+* Description: Stop recording register accesses
+*
+*****************************************************************************/
+void HostRegTraceStop(void)
+{
+	hostRegTraceOn = 0;
+}
+
+/*****************************************************************************
+*
+* Function: uint32_t HostRegTraceCount(uint32_t address, uint32_t size, uint8_t write)
+*
+* Description: Number of recorded reads (write 0) or writes (write 1) of the address range
+*
+*****************************************************************************/
+uint32_t HostRegTraceCount(uint32_t address, uint32_t size, uint8_t write)
+{
+	uint32_t  accessNum, count = 0;
+
+	for (accessNum = 0; accessNum < hostRegTraceNum; accessNum++)
+	{
+		if ((hostRegTrace[accessNum].address >= address) && (hostRegTrace[accessNum].address < address + size) && \
+				(hostRegTrace[accessNum].write == write))
+		{
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/*****************************************************************************
+*
+* Function: void HostFlashErase(void)
+*
+* Description: Erase the whole data flash, as delivered
+*
+*****************************************************************************/
+void HostFlashErase(void)
+{
+	memset((void *)(uintptr_t)HOST_DFLASH_BASE, 0xFF, HOST_DFLASH_SIZE);
+}
+
+/*****************************************************************************
+*
+* Function: void HostRandomSeed(uint32_t seed), uint32_t HostRandom(void), double HostGauss(void)
+*
+* Description: Reproducible random numbers - 32-bit xorshift, approximately normal
+* 				distribution with zero mean and unit variance (sum of 12 uniform)
+*
+*****************************************************************************/
+void HostRandomSeed(uint32_t seed)
+{
+	hostRandomState = (seed != 0) ? seed : 1;
+}
+
+uint32_t HostRandom(void)
+{
+	hostRandomState ^= hostRandomState << 13;
+	hostRandomState ^= hostRandomState >> 17;
+	hostRandomState ^= hostRandomState << 5;
+
+	return hostRandomState;
+}
+
+double HostGauss(void)
+{
+	double  sum = 0;
+	int  num;
+
+	for (num = 0; num < 12; num++)
+	{
+		sum += (double)HostRandom() / 4294967296.0;
+	}
+
+	return sum - 6.0;
+}
+
+/*****************************************************************************
+*
+* Function: void HostTestCheck(int condition, const char *text, const char *file, int line)
+*
+* Description: Count the check, report the failed one
+*
+*****************************************************************************/
+void HostTestCheck(int condition, const char *text, const char *file, int line)
+{
+	hostTestChecks++;
+
+	if (!condition)
+	{
+		hostTestFailures++;
+		printf("%s:%d: check failed: %s\n", file, line, text);
+	}
+}
+
+/*****************************************************************************
+*
+* Function: int HostTestResult(const char *testName)
+*
+* Description: Report the test result, process exit code
+*
+*****************************************************************************/
+int HostTestResult(const char *testName)
+{
+	printf("%s: %s (%u checks, %u failed)\n", testName, (hostTestFailures == 0) ? "PASS" : "FAIL", hostTestChecks, hostTestFailures);
+
+	return (hostTestFailures == 0) ? 0 : 1;
+}
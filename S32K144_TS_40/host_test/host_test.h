@@ -0,0 +1,111 @@
+/****************************************************************************//*!
+*
+* @file     host_test.h
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Host test harness - S32K144 register model, emulated data flash and checks
+*
+*******************************************************************************/
+#ifndef __HOST_TEST_H
+#define __HOST_TEST_H
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+
+/*******************************************************************************
+* Checks
+*******************************************************************************/
+// Check a condition, failure is reported with the source line and the test goes on
+#define TEST_CHECK(condition)   HostTestCheck((condition), #condition, __FILE__, __LINE__)
+
+/*******************************************************************************
+* Register model
+*
+* Peripheral bridge (0x40000000), private peripheral bus (0xE0000000) and data
+* flash (0x10000000) are host memory at the S32K144 addresses. ADC0, ADC1, SIM,
+* FTFC, PORTA-E and GPIO pages are protected, every access traps to the model:
+* - ADC SC1[0] write starts the conversion of the channel (software trigger), SIM
+*   MISCTRL1 SW_TRG write converts all ADCs with hardware trigger selected, result
+*   of hostAdcModel() is loaded to R[0] and COCO set, R[0] read clears COCO
+* - ADC SC3 CAL write completes the calibration at once
+* - GPIO PSOR, PCOR and PTOR update PDOR, PORT GPCLR and GPCHR update PCRs
+* - eDMA SSRT write and ADC conversion complete (SC2 DMAEN, DMAMUX source) request
+*   the channel, its minor loops run through the model with scatter/gather and
+*   channel linking, register accesses of the channel are recorded as well
+* Accesses are recorded to hostRegTrace[] while hostRegTraceOn.
+*******************************************************************************/
+// Peripheral bridge and data flash size mapped on the host
+#define HOST_PERIPH_BASE     0x40000000u
+#define HOST_PERIPH_SIZE     0x00100000u
+#define HOST_PPB_BASE        0xE0000000u
+#define HOST_PPB_SIZE        0x00100000u
+#define HOST_DFLASH_BASE     0x10000000u
+#define HOST_DFLASH_SIZE     0x00010000u
+#define HOST_DFLASH_SECTOR   0x00000800u
+
+// Register accesses recorded
+#define HOST_REG_TRACE_SIZE  8192
+
+typedef struct
+{
+	uint32_t  address;
+	// Register value after the access
+	uint32_t  value;
+	uint8_t   write;
+}
+tHostRegAccess;
+
+// Register accesses recorded
+extern tHostRegAccess  hostRegTrace[HOST_REG_TRACE_SIZE];
+extern uint32_t  hostRegTraceNum;
+extern uint8_t   hostRegTraceOn;
+
+// ADC conversion result of the channel, 12-bit (scaled to the ADC resolution by the model)
+extern int32_t (*hostAdcModel)(uint32_t adcNum, uint32_t channel);
+// Conversions per ADC, conversions of both ADCs started by one SIM trigger
+extern uint32_t  hostAdcConversions[2];
+extern uint32_t  hostAdcSimultaneousConversions;
+// eDMA minor loops done
+extern uint32_t  hostDmaMinorLoops;
+
+/*******************************************************************************
+* Emulated data flash
+*
+* FTFC commands launched by the FSTAT CCIF write complete at once: erase sector sets
+* the data flash sector to 0xFF, program phrase clears bits only (NOR flash), both
+* report ACCERR for a misaligned address.
+*******************************************************************************/
+// Sector erases and programmed phrases
+extern uint32_t  hostFlashErases, hostFlashPhrases;
+// Phrases programmed before a simulated reset (torn snapshot), negative for no limit
+extern int32_t   hostFlashPhraseLimit;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void HostTestCheck(int condition, const char *text, const char *file, int line);
+int HostTestResult(const char *testName);
+
+void HostRegTraceStart(void);
+void HostRegTraceStop(void);
+uint32_t HostRegTraceCount(uint32_t address, uint32_t size, uint8_t write);
+uint32_t HostRegRead(uint32_t address);
+void HostRegWrite(uint32_t address, uint32_t value);
+
+void HostRandomSeed(uint32_t seed);
+uint32_t HostRandom(void);
+double HostGauss(void);
+
+void HostFlashErase(void);
+
+void HostTouchSenseInit(void);
+void HostTouchSensePeriods(uint32_t periodsNum);
+uint32_t HostTouchSenseSelfTrim(uint32_t periodsMax);
+
+#endif /* __HOST_TEST_H */
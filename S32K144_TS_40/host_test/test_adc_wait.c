@@ -0,0 +1,174 @@
+/****************************************************************************//*!
+*
+* @file     test_adc_wait.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    ADC conversion complete wait benchmark - conversion waits of a sensing period,
+*           core cycles spent in RUN and in WAIT mode while the ADC converts and the
+*           estimated average current of the waits, ADC_WAIT_POLL against ADC_WAIT_SLEEP
+*
+* @note     Built twice: test_adc_wait_poll (ADC_CONVERSION_WAIT ADC_WAIT_POLL) and
+*           test_adc_wait (ADC_WAIT_SLEEP), 6 pad keypad with slider without wake-up
+*           electrode (all electrodes scanned every period). The register model
+*           completes a conversion at once, wait cycles are modelled: core clock and ADC
+*           clock 48 MHz (FIRC), (SMPLTS + 1) sample and (resolution + 1) compare ADCK
+*           cycles per conversion. Sleep wait runs TEST_SLEEP_OVERHEAD core cycles in RUN
+*           (NVIC pending clear, WFE, wake-up, COCO read). Currents are model parameters,
+*           replace them by the board measurement.
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stddef.h>
+#include "host_test.h"
+#include "S32K144.h"
+#include "main.h"
+#include "ts_cfg.h"
+#include "ets.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+#if (ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP)
+#define TEST_NAME               "test_adc_wait"
+#else
+#define TEST_NAME               "test_adc_wait_poll"
+#endif
+
+// Untouched electrode level [12-bit LSB]
+#define TEST_ELECTRODE_LEVEL    2000
+// Sensing periods measured
+#define TEST_PERIODS            100
+
+// Core and ADC clock [Hz]
+#define TEST_CORE_CLOCK         48000000.0
+// Core cycles of a sleep wait in RUN mode
+#define TEST_SLEEP_OVERHEAD     12
+// Core current in RUN and in WAIT mode at 48 MHz, ADC converting [uA]
+#define TEST_IDD_RUN            17000.0
+#define TEST_IDD_WAIT           7000.0
+
+// Average current quoted in the board application configuration [uA]
+#if (OPTIONAL_WAKE_UP_ELECTRODE == WAKE_ELEC_YES)
+#define TEST_APP_CURRENT        70.0
+#else
+#define TEST_APP_CURRENT        130.0
+#endif
+
+/*****************************************************************************
+*
+* Function: int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+*
+* Description: Electrode level without noise
+*
+*****************************************************************************/
+static int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+{
+	(void)adcNum;
+	(void)channel;
+
+	return TEST_ELECTRODE_LEVEL;
+}
+
+/*****************************************************************************
+*
+* Function: void TestSc1Writes(uint32_t *convWritesPtr, uint32_t *aienWritesPtr)
+*
+* Description: ADC0 and ADC1 SC1[0] channel writes of the trace, writes with AIEN
+*
+*****************************************************************************/
+static void TestSc1Writes(uint32_t *convWritesPtr, uint32_t *aienWritesPtr)
+{
+	uint32_t  accessNum, address;
+
+	*convWritesPtr = 0;
+	*aienWritesPtr = 0;
+	for (accessNum = 0; accessNum < hostRegTraceNum; accessNum++)
+	{
+		address = hostRegTrace[accessNum].address;
+		if (hostRegTrace[accessNum].write && ((hostRegTrace[accessNum].value & ADC_SC1_ADCH_MASK) != ADC_SC1_ADCH_MASK) && \
+				((address == ADC0_BASE + offsetof(ADC_Type, SC1[0])) || (address == ADC1_BASE + offsetof(ADC_Type, SC1[0]))))
+		{
+			(*convWritesPtr)++;
+			if (hostRegTrace[accessNum].value & ADC_SC1_AIEN_MASK)
+			{
+				(*aienWritesPtr)++;
+			}
+		}
+	}
+}
+
+int main(void)
+{
+	uint32_t  conversions, simultaneous, waits, convWrites, aienWrites, mode, resolution, convCycles;
+	double    waitsPerPeriod, waitCycles, runCycles, sleepCycles, currentPoll, current;
+
+	hostAdcModel = TestAdcModel;
+	HostTouchSenseInit();
+	TEST_CHECK(HostTouchSenseSelfTrim(5000) < 5000);
+
+	// Conversion waits of the sensing periods, simultaneous pair waits once
+	conversions = hostAdcConversions[0] + hostAdcConversions[1];
+	simultaneous = hostAdcSimultaneousConversions;
+	HostTouchSensePeriods(TEST_PERIODS);
+	waits = (hostAdcConversions[0] + hostAdcConversions[1] - conversions) - (hostAdcSimultaneousConversions - simultaneous);
+	waitsPerPeriod = (double)waits / TEST_PERIODS;
+
+	// Channel writes of one period
+	S32_NVIC->ICPR[ADC0_IRQn / 32] = 0;
+	HostRegTraceStart();
+	HostTouchSensePeriods(1);
+	HostRegTraceStop();
+	TestSc1Writes(&convWrites, &aienWrites);
+
+	// Conversion time in core cycles - sample and compare ADCK cycles
+	mode = (HostRegRead(ADC0_BASE + offsetof(ADC_Type, CFG1)) & ADC_CFG1_MODE_MASK) >> ADC_CFG1_MODE_SHIFT;
+	resolution = (mode == 0) ? 8 : ((mode == 2) ? 10 : 12);
+	convCycles = ((HostRegRead(ADC0_BASE + offsetof(ADC_Type, CFG2)) & ADC_CFG2_SMPLTS_MASK) + 1) + (resolution + 1);
+
+	// Wait cycles per period, RUN and WAIT mode share of the selected wait
+	waitCycles = waitsPerPeriod * convCycles;
+#if (ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP)
+	runCycles = waitsPerPeriod * TEST_SLEEP_OVERHEAD;
+	sleepCycles = waitCycles - runCycles;
+#else
+	runCycles = waitCycles;
+	sleepCycles = 0;
+#endif
+
+	// Average current of the waits over the sensing period [uA]
+	currentPoll = waitCycles / TEST_CORE_CLOCK * TEST_IDD_RUN / (ELECTRODES_SENSE_PERIOD / 1000.0);
+	current = (runCycles * TEST_IDD_RUN + sleepCycles * TEST_IDD_WAIT) / TEST_CORE_CLOCK / (ELECTRODES_SENSE_PERIOD / 1000.0);
+
+	printf("%s: %s wait, sensing period %u ms, %u-bit, %u core cycles per conversion\n", TEST_NAME, \
+			(ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP) ? "sleep" : "poll", ELECTRODES_SENSE_PERIOD, resolution, convCycles);
+	printf("  conversion waits per period  %10.1f (%u channel writes, %u with AIEN)\n", waitsPerPeriod, convWrites, aienWrites);
+	printf("  wait cycles per period       %10.0f (RUN %.0f, WAIT %.0f)\n", waitCycles, runCycles, sleepCycles);
+	printf("  average current of the waits %10.2f uA (poll %.2f uA), saving %.2f uA of %.0f uA\n", current, currentPoll, \
+			currentPoll - current, TEST_APP_CURRENT);
+
+	TEST_CHECK(waits > 0);
+	TEST_CHECK(convWrites > 0);
+#if (ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP)
+	// Every conversion wakes the core, pending flag cleared before the sleep, back to deep sleep after the period
+	TEST_CHECK(aienWrites == convWrites);
+	TEST_CHECK(S32_NVIC->ICPR[ADC0_IRQn / 32] != 0);
+	TEST_CHECK(S32_SCB->SCR & S32_SCB_SCR_SEVONPEND_MASK);
+	TEST_CHECK(S32_SCB->SCR & S32_SCB_SCR_SLEEPDEEP_MASK);
+	// Core sleeps for the most of the wait, waits current below the polling one
+	TEST_CHECK(sleepCycles > runCycles);
+	TEST_CHECK(current < currentPoll);
+#else
+	// No conversion complete interrupt, no pending flags cleared, core polls the whole wait
+	TEST_CHECK(aienWrites == 0);
+	TEST_CHECK(S32_NVIC->ICPR[ADC0_IRQn / 32] == 0);
+	TEST_CHECK(current == currentPoll);
+#endif
+
+	return HostTestResult(TEST_NAME);
+}
@@ -0,0 +1,220 @@
+/****************************************************************************//*!
+*
+* @file     test_cds.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Correlated double sampling - sensing cycles per sample needed for the SNR
+*           of the single sampling at NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE
+*
+* @note     Cext reference level and equivalent voltage conversions share the low
+*           frequency supply noise of the sensing cycle, white noise is independent.
+*           Single sampling raw data is the average of the same equivalent voltage
+*           conversions the firmware CDS path subtracts the reference level from.
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <math.h>
+#include <string.h>
+#include "host_test.h"
+#include "S32K144.h"
+#include "main.h"
+#include "ts_cfg.h"
+#include "ets.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+// Cext reference level and equivalent voltage (untouched, touched) [12-bit LSB]
+#define TEST_REFERENCE_LEVEL     3900
+#define TEST_EQUIVALENT_LEVEL    1800
+#define TEST_TOUCH_DELTA         40
+// White noise RMS, low frequency supply noise amplitude [12-bit LSB] and frequency [Hz]
+#define TEST_WHITE_NOISE         6.0
+#define TEST_LF_NOISE            10.0
+#define TEST_LF_FREQUENCY        100.0
+// Conversion time, electrodes sensing period [s]
+#define TEST_CONVERSION_TIME     2e-6
+#define TEST_SENSE_PERIOD        1e-3
+// Bursts per electrode state
+#define TEST_BURSTS              300
+// Sensing cycles per sample evaluated
+#define TEST_CYCLES              {1, 2, 3, 4, 6, 8, 12, 16}
+#define TEST_CYCLES_NUM          8
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+extern int16_t  numberOfElectrodeSensingCyclesPerSample;
+extern tElecData  elecData[NUMBER_OF_ELECTRODES];
+
+// Burst state - time, conversions, touch, low frequency noise on
+static double    testTime, testLfNoise;
+static uint32_t  testConversionNum;
+static uint8_t   testTouch;
+// Equivalent voltage conversions sum of the burst (pre-cycles excluded)
+static int32_t   testEquivalentSum;
+
+/*****************************************************************************
+*
+* Function: int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+*
+* Description: Even conversion of the sensing cycle is the Cext reference level,
+* 				odd one the equivalent voltage after charge redistribution
+*
+*****************************************************************************/
+static int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+{
+	double  level;
+	int32_t  result;
+
+	(void)adcNum;
+	(void)channel;
+
+	// Low frequency noise common to both conversions of the sensing cycle
+	if ((testConversionNum & 1) == 0)
+	{
+		testTime += 2 * TEST_CONVERSION_TIME;
+	}
+	level = testLfNoise * sin(2 * M_PI * TEST_LF_FREQUENCY * testTime) + TEST_WHITE_NOISE * HostGauss();
+
+	if ((testConversionNum & 1) == 0)
+	{
+		result = (int32_t)lround(TEST_REFERENCE_LEVEL + level);
+	}
+	else
+	{
+		result = (int32_t)lround(TEST_EQUIVALENT_LEVEL - (testTouch ? TEST_TOUCH_DELTA : 0) + level);
+		if ((testConversionNum >> 1) >= NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE)
+		{
+			testEquivalentSum += result;
+		}
+	}
+	testConversionNum++;
+
+	return result;
+}
+
+/*****************************************************************************
+*
+* Function: void TestSnr(uint32_t cyclesNum, double *snrCdsPtr, double *snrSinglePtr)
+*
+* Description: SNR of CDS and single sampling raw data, touch delta over noise RMS
+*
+*****************************************************************************/
+static void TestSnr(uint32_t cyclesNum, double *snrCdsPtr, double *snrSinglePtr)
+{
+	double  sum[2][2], sumSquare[2][2], mean[2][2], variance[2];
+	int32_t  raw[2];
+	uint32_t  burstNum, mode;
+
+	memset(sum, 0, sizeof(sum));
+	memset(sumSquare, 0, sizeof(sumSquare));
+	HostRandomSeed(cyclesNum);
+
+	for (burstNum = 0; burstNum < 2 * TEST_BURSTS; burstNum++)
+	{
+		// Touched every other period
+		testTouch = burstNum & 1;
+		testTime = burstNum * TEST_SENSE_PERIOD;
+		testConversionNum = 0;
+		testEquivalentSum = 0;
+
+		numberOfElectrodeSensingCyclesPerSample = cyclesNum;
+		ElectrodeCapToVoltConvELCH(0);
+
+		raw[0] = elecData[0].adcDataElectrodeDischargeRaw[0];
+		raw[1] = testEquivalentSum / (int32_t)cyclesNum;
+
+		for (mode = 0; mode < 2; mode++)
+		{
+			sum[mode][testTouch] += raw[mode];
+			sumSquare[mode][testTouch] += (double)raw[mode] * raw[mode];
+		}
+	}
+
+	for (mode = 0; mode < 2; mode++)
+	{
+		mean[mode][0] = sum[mode][0] / TEST_BURSTS;
+		mean[mode][1] = sum[mode][1] / TEST_BURSTS;
+		// Pooled variance of both states
+		variance[mode] = (sumSquare[mode][0] / TEST_BURSTS - mean[mode][0] * mean[mode][0] + \
+				sumSquare[mode][1] / TEST_BURSTS - mean[mode][1] * mean[mode][1]) / 2;
+		if (variance[mode] < 1.0 / 12)
+		{
+			// Quantization noise
+			variance[mode] = 1.0 / 12;
+		}
+	}
+
+	*snrCdsPtr = fabs(mean[0][0] - mean[0][1]) / sqrt(variance[0]);
+	*snrSinglePtr = fabs(mean[1][0] - mean[1][1]) / sqrt(variance[1]);
+}
+
+/*****************************************************************************
+*
+* Function: uint32_t TestScenario(const char *name, double lfNoise)
+*
+* Description: SNR table over TEST_CYCLES sensing cycles, fewest CDS cycles reaching
+* 				the single sampling SNR of NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE
+*
+*****************************************************************************/
+static uint32_t TestScenario(const char *name, double lfNoise)
+{
+	const uint32_t  cycles[TEST_CYCLES_NUM] = TEST_CYCLES;
+	double  snrCds[TEST_CYCLES_NUM], snrSingle[TEST_CYCLES_NUM];
+	uint32_t  cyclesIdx, cyclesCds;
+
+	testLfNoise = lfNoise;
+	printf("test_cds: %s\n  cycles  SNR single  SNR CDS\n", name);
+	for (cyclesIdx = 0; cyclesIdx < TEST_CYCLES_NUM; cyclesIdx++)
+	{
+		TestSnr(cycles[cyclesIdx], &snrCds[cyclesIdx], &snrSingle[cyclesIdx]);
+		printf("  %6u  %10.2f  %7.2f\n", cycles[cyclesIdx], snrSingle[cyclesIdx], snrCds[cyclesIdx]);
+	}
+
+	// Fewest CDS cycles with the single sampling SNR of all active cycles (last in the table)
+	cyclesCds = NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE + 1;
+	for (cyclesIdx = 0; cyclesIdx < TEST_CYCLES_NUM; cyclesIdx++)
+	{
+		if (snrCds[cyclesIdx] >= snrSingle[TEST_CYCLES_NUM - 1])
+		{
+			cyclesCds = cycles[cyclesIdx];
+			break;
+		}
+	}
+	printf("  single sampling SNR %.2f at %u cycles, ", snrSingle[TEST_CYCLES_NUM - 1], NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE);
+	if (cyclesCds <= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE)
+	{
+		printf("CDS reaches it at %u cycles\n", cyclesCds);
+	}
+	else
+	{
+		printf("CDS does not reach it within %u cycles\n", NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE);
+	}
+
+	return cyclesCds;
+}
+
+int main(void)
+{
+	uint32_t  cyclesLf, cyclesWhite;
+
+	hostAdcModel = TestAdcModel;
+	HostTouchSenseInit();
+
+	// Low frequency supply noise - CDS cancels it, single sampling averages white noise only
+	cyclesLf = TestScenario("white and low frequency supply noise", TEST_LF_NOISE);
+	TEST_CHECK(cyclesLf < NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE / 2);
+
+	// White noise only - the reference conversion adds its white noise, CDS needs more cycles
+	cyclesWhite = TestScenario("white noise only", 0);
+	TEST_CHECK(cyclesWhite > NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE);
+
+	return HostTestResult("test_cds");
+}
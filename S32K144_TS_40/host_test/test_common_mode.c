@@ -0,0 +1,183 @@
+/****************************************************************************//*!
+*
+* @file     test_common_mode.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Common-mode noise rejection - conducted noise injected into all touch button
+*           electrodes, false touches and touch detection latency of the board IIR filter
+*           and of a faster (lower order of smoothing) IIR filter
+*
+* @note     Built twice: test_common_mode_off (TS_COMMON_MODE_REJECTION 0) and
+*           test_common_mode (TS_COMMON_MODE_REJECTION 1). Without the rejection only the
+*           board filter is free of false touches, with it the faster filter is too and
+*           detects the touch in fewer scans than the board filter.
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <math.h>
+#include "host_test.h"
+#include "S32K144.h"
+#include "main.h"
+#include "ts_cfg.h"
+#include "ets.h"
+#include "filter.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+#if TS_COMMON_MODE_REJECTION
+#define TEST_NAME               "test_common_mode"
+#else
+#define TEST_NAME               "test_common_mode_off"
+#endif
+
+// Untouched electrode level, white noise RMS of a sample, touch delta [12-bit LSB]
+#define TEST_ELECTRODE_LEVEL    2000
+#define TEST_NOISE              2.0
+#define TEST_TOUCH_DELTA        35
+// Conducted noise - square wave amplitude [12-bit LSB] and half period [scans]
+#define TEST_CM_AMPLITUDE       30
+#define TEST_CM_HALF_PERIOD     4
+// Scenario cycle [scans] - noise burst and touch of one electrode within the cycle, electrodes touched in turn
+#define TEST_CYCLE              140
+#define TEST_CM_END             80
+#define TEST_TOUCH_START        40
+#define TEST_TOUCH_END          90
+#define TEST_CYCLES             4
+// Quiet scans after the filter change
+#define TEST_SETTLE             50
+
+// Faster IIR filter coefficients (pole 0.5, unity DC gain)
+#define TEST_FAST_COEF_B0       0.25
+#define TEST_FAST_COEF_B1       0.25
+#define TEST_FAST_COEF_A0       -0.5
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+extern tElecStruct  elecStruct[NUMBER_OF_ELECTRODES];
+extern tElecData  elecData[NUMBER_OF_ELECTRODES];
+extern tFrac32  FilterIIR1CoeffB0[], FilterIIR1CoeffB1[], FilterIIR1CoeffA1[];
+
+// Common-mode noise of the scan, touched electrode (NUMBER_OF_TOUCH_ELECTRODES none)
+static int32_t   testCommonMode;
+static uint32_t  testTouchElec = NUMBER_OF_TOUCH_ELECTRODES;
+
+/*****************************************************************************
+*
+* Function: int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+*
+* Description: Electrode level with the common-mode noise of the scan, touched electrode lower
+*
+*****************************************************************************/
+static int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+{
+	double  level;
+
+	level = TEST_ELECTRODE_LEVEL + testCommonMode + TEST_NOISE * HostGauss();
+	if ((testTouchElec < NUMBER_OF_TOUCH_ELECTRODES) && (elecStruct[testTouchElec].adcBasePtr == (adcNum ? ADC1 : ADC0)) && \
+			((elecStruct[testTouchElec].adcChNum & 0x3F) == channel))
+	{
+		level -= TEST_TOUCH_DELTA;
+	}
+
+	return (int32_t)lround(level);
+}
+
+/*****************************************************************************
+*
+* Function: void TestFilter(const char *name, double b0, double b1, double a0, uint32_t *falseTouchPtr, double *latencyPtr)
+*
+* Description: Noise bursts and touches of electrodes in turn with the IIR filter,
+* 				scans with false touch of an untouched electrode, average touch latency [scans]
+*
+*****************************************************************************/
+static void TestFilter(const char *name, double b0, double b1, double a0, uint32_t *falseTouchPtr, double *latencyPtr)
+{
+	uint32_t  cycleNum, scanNum, elecNum, latency, latencySum, missed;
+
+	// Touch button electrodes IIR filter
+	FilterIIR1CoeffB0[FILTER_1] = FRAC32(b0);
+	FilterIIR1CoeffB1[FILTER_1] = FRAC32(b1);
+	FilterIIR1CoeffA1[FILTER_1] = FRAC32(a0);
+	testCommonMode = 0;
+	testTouchElec = NUMBER_OF_TOUCH_ELECTRODES;
+	HostTouchSensePeriods(TEST_SETTLE);
+
+	*falseTouchPtr = 0;
+	latencySum = 0;
+	missed = 0;
+	for (cycleNum = 0; cycleNum < TEST_CYCLES; cycleNum++)
+	{
+		latency = TEST_CYCLE;
+		for (scanNum = 0; scanNum < TEST_CYCLE; scanNum++)
+		{
+			testCommonMode = (scanNum < TEST_CM_END) ? (((scanNum / TEST_CM_HALF_PERIOD) & 1) ? -TEST_CM_AMPLITUDE : TEST_CM_AMPLITUDE) : 0;
+			testTouchElec = ((scanNum >= TEST_TOUCH_START) && (scanNum < TEST_TOUCH_END)) ? cycleNum : NUMBER_OF_TOUCH_ELECTRODES;
+			HostTouchSensePeriods(1);
+
+			// Touch detected - scans from the touch start
+			if ((testTouchElec == cycleNum) && (latency == TEST_CYCLE) && (elecData[cycleNum].electrodeTouch[0] == YES))
+			{
+				latency = scanNum - TEST_TOUCH_START + 1;
+			}
+			// False touch of other electrodes (release of the touched one excluded)
+			for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+			{
+				if ((elecNum != cycleNum) && (elecData[elecNum].electrodeTouch[0] == YES))
+				{
+					(*falseTouchPtr)++;
+					break;
+				}
+			}
+		}
+
+		if (latency == TEST_CYCLE)
+		{
+			missed++;
+		}
+		else
+		{
+			latencySum += latency;
+		}
+	}
+
+	*latencyPtr = (missed < TEST_CYCLES) ? (double)latencySum / (TEST_CYCLES - missed) : TEST_CYCLE;
+	printf("  %-26s %12u %14.1f %8u\n", name, *falseTouchPtr, *latencyPtr, missed);
+	TEST_CHECK(missed == 0);
+}
+
+int main(void)
+{
+	uint32_t  falseTouchBoard, falseTouchFast;
+	double    latencyBoard, latencyFast;
+
+	hostAdcModel = TestAdcModel;
+	HostTouchSenseInit();
+	TEST_CHECK(HostTouchSenseSelfTrim(5000) < 5000);
+
+	printf("%s: common-mode rejection %s, noise %d LSB square wave, touch %d LSB, threshold %d LSB\n", TEST_NAME, \
+			TS_COMMON_MODE_REJECTION ? "on" : "off", TEST_CM_AMPLITUDE, TEST_TOUCH_DELTA, ELEC_TOUCH_THRESHOLD_DELTA);
+	printf("  %-26s %12s %14s %8s\n", "IIR filter", "false touch", "latency [scans]", "missed");
+	TestFilter("board (pole 0.827)", FILTER_1_COEF_B0, FILTER_1_COEF_B1, FILTER_1_COEF_A0, &falseTouchBoard, &latencyBoard);
+	TestFilter("fast (pole 0.5)", TEST_FAST_COEF_B0, TEST_FAST_COEF_B1, TEST_FAST_COEF_A0, &falseTouchFast, &latencyFast);
+
+	// Faster filter needs fewer scans to detect the touch
+	TEST_CHECK(latencyFast < latencyBoard);
+	TEST_CHECK(falseTouchBoard == 0);
+#if TS_COMMON_MODE_REJECTION
+	// Rejection - faster filter without false touches
+	TEST_CHECK(falseTouchFast == 0);
+#else
+	// No rejection - faster filter passes the conducted noise
+	TEST_CHECK(falseTouchFast > 0);
+#endif
+
+	return HostTestResult(TEST_NAME);
+}
@@ -0,0 +1,268 @@
+/****************************************************************************//*!
+*
+* @file     test_conv_kernel.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Hand-scheduled conversion kernel (TS_ASM_OPTIMIZE) - instructions and
+*           Cortex-M4 cycles of the critical window from the first charge distribution
+*           PDDR write to the last charge redistribution PDDR write
+*
+* @note     The Makefile extracts the ConversionKernelRun() assembly template, assembles
+*           it for Cortex-M4 (llvm-mc) and passes the disassembly (llvm-objdump) as the
+*           argument. Cycles of the Cortex-M4 TRM at zero wait states: load/store 2, 1
+*           after a load/store (pipelined), data processing 1, branch not taken 1, taken
+*           1 + P with P = 1. Peripheral bus wait states add the same cycles to every
+*           store, not modelled.
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include "host_test.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+// Expected kernel - all instructions, instructions of the window (delay loops counted once)
+#define TEST_KERNEL_INSTRUCTIONS    19
+#define TEST_WINDOW_INSTRUCTIONS    10
+// Expected window cycles - fixed part, per delay loop iteration (subs + taken bcs)
+#define TEST_WINDOW_CYCLES_FIXED    8
+#define TEST_WINDOW_CYCLES_LOOP     3
+// Delay loop runs (delay + 1) iterations, the last branch not taken
+#define TEST_WINDOW_CYCLES(delay0, delay1)   (TEST_WINDOW_CYCLES_FIXED + TEST_WINDOW_CYCLES_LOOP * ((delay0) + 1) - 1 + \
+		TEST_WINDOW_CYCLES_LOOP * ((delay1) + 1) - 1)
+
+// Charge distribution periods of the timing auto-tuning candidates
+#define TEST_DELAYS                 {0, 8, 32}
+#define TEST_DELAYS_NUM             3
+
+// Kernel instructions limit
+#define TEST_INSTRUCTIONS_MAX       64
+// Delay counter registers of the kernel
+#define TEST_DELAY0_REG             "r6"
+#define TEST_DELAY1_REG             "r12"
+
+// Instruction classes
+#define TEST_CLASS_LOAD_STORE       0
+#define TEST_CLASS_DATA             1
+#define TEST_CLASS_BRANCH           2
+#define TEST_CLASS_OTHER            3
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+// Disassembled instruction - address, mnemonic, operands, class, branch target
+typedef struct
+{
+	uint32_t  address;
+	char      mnemonic[16];
+	char      operands[64];
+	uint32_t  instrClass;
+	uint32_t  target;
+}
+tTestInstr;
+
+static tTestInstr  testInstr[TEST_INSTRUCTIONS_MAX];
+static uint32_t  testInstrNum;
+
+/*****************************************************************************
+*
+* Function: uint32_t TestListingRead(const char *fileName)
+*
+* Description: Instructions of the llvm-objdump disassembly, 0 - listing not read
+*
+*****************************************************************************/
+static uint32_t TestListingRead(const char *fileName)
+{
+	FILE  *file;
+	char  line[256];
+	tTestInstr  *instrPtr;
+
+	file = fopen(fileName, "r");
+	if (file == NULL)
+	{
+		return 0;
+	}
+
+	testInstrNum = 0;
+	while ((fgets(line, sizeof(line), file) != NULL) && (testInstrNum < TEST_INSTRUCTIONS_MAX))
+	{
+		instrPtr = &testInstr[testInstrNum];
+		instrPtr->operands[0] = 0;
+		// "   address:   mnemonic   operands", label and header lines skipped
+		if (sscanf(line, " %x: %15s %63[^\n]", &instrPtr->address, instrPtr->mnemonic, instrPtr->operands) < 2)
+		{
+			continue;
+		}
+
+		if (!strncmp(instrPtr->mnemonic, "ldr", 3) || !strncmp(instrPtr->mnemonic, "str", 3))
+		{
+			instrPtr->instrClass = TEST_CLASS_LOAD_STORE;
+		}
+		else if (!strncmp(instrPtr->mnemonic, "subs", 4))
+		{
+			instrPtr->instrClass = TEST_CLASS_DATA;
+		}
+		else if (!strncmp(instrPtr->mnemonic, "bhs", 3) || !strncmp(instrPtr->mnemonic, "bcs", 3))
+		{
+			instrPtr->instrClass = TEST_CLASS_BRANCH;
+			instrPtr->target = (uint32_t)strtoul(instrPtr->operands, NULL, 16);
+		}
+		else
+		{
+			instrPtr->instrClass = TEST_CLASS_OTHER;
+		}
+		testInstrNum++;
+	}
+	fclose(file);
+
+	return testInstrNum;
+}
+
+/*****************************************************************************
+*
+* Function: uint32_t TestInstrIndex(uint32_t address)
+*
+* Description: Instruction index of the address, testInstrNum if none
+*
+*****************************************************************************/
+static uint32_t TestInstrIndex(uint32_t address)
+{
+	uint32_t  instrNum;
+
+	for (instrNum = 0; instrNum < testInstrNum; instrNum++)
+	{
+		if (testInstr[instrNum].address == address)
+		{
+			break;
+		}
+	}
+
+	return instrNum;
+}
+
+/*****************************************************************************
+*
+* Function: uint32_t TestWindowCycles(uint32_t first, uint32_t last, uint32_t delay0, uint32_t delay1)
+*
+* Description: Cycles of the window executed with the delays, delay counters decremented
+* 				by subs, bcs taken while no borrow
+*
+*****************************************************************************/
+static uint32_t TestWindowCycles(uint32_t first, uint32_t last, uint32_t delay0, uint32_t delay1)
+{
+	uint32_t  instrNum, cycles, carry, instrClass, previousClass;
+	uint32_t  *counterPtr;
+
+	cycles = 0;
+	carry = 0;
+	// Window entered after the kernel parameters loads
+	previousClass = TEST_CLASS_LOAD_STORE;
+
+	for (instrNum = first; instrNum <= last; instrNum++)
+	{
+		instrClass = testInstr[instrNum].instrClass;
+		switch (instrClass)
+		{
+		case TEST_CLASS_LOAD_STORE:
+			cycles += (previousClass == TEST_CLASS_LOAD_STORE) ? 1 : 2;
+			break;
+		case TEST_CLASS_DATA:
+			if (!strncmp(testInstr[instrNum].operands, TEST_DELAY0_REG ",", strlen(TEST_DELAY0_REG ",")))
+			{
+				counterPtr = &delay0;
+			}
+			else if (!strncmp(testInstr[instrNum].operands, TEST_DELAY1_REG ",", strlen(TEST_DELAY1_REG ",")))
+			{
+				counterPtr = &delay1;
+			}
+			else
+			{
+				return 0;
+			}
+			carry = (*counterPtr >= 1);
+			(*counterPtr)--;
+			cycles += 1;
+			break;
+		case TEST_CLASS_BRANCH:
+			if (carry)
+			{
+				cycles += 2;
+				// Next instruction the branch target
+				instrNum = TestInstrIndex(testInstr[instrNum].target) - 1;
+			}
+			else
+			{
+				cycles += 1;
+			}
+			break;
+		default:
+			return 0;
+		}
+		previousClass = instrClass;
+	}
+
+	return cycles;
+}
+
+int main(int argc, char *argv[])
+{
+	const uint32_t  delays[TEST_DELAYS_NUM] = TEST_DELAYS;
+	uint32_t  instrNum, first, last, otherNum, delay0Idx, delay1Idx, cycles;
+
+	TEST_CHECK(argc == 2);
+	TEST_CHECK(TestListingRead((argc == 2) ? argv[1] : "") > 0);
+
+	// Window from the first to the last store, no other instruction classes in the kernel
+	first = testInstrNum;
+	last = 0;
+	otherNum = 0;
+	for (instrNum = 0; instrNum < testInstrNum; instrNum++)
+	{
+		if (!strncmp(testInstr[instrNum].mnemonic, "str", 3))
+		{
+			first = (instrNum < first) ? instrNum : first;
+			last = instrNum;
+		}
+		if (testInstr[instrNum].instrClass == TEST_CLASS_OTHER)
+		{
+			otherNum++;
+		}
+	}
+
+	printf("test_conv_kernel: %u instructions, window %u..%u\n", testInstrNum, first, last);
+	for (instrNum = first; (instrNum <= last) && (instrNum < testInstrNum); instrNum++)
+	{
+		printf("  %4x:  %-6s %s\n", testInstr[instrNum].address, testInstr[instrNum].mnemonic, testInstr[instrNum].operands);
+	}
+
+	TEST_CHECK(testInstrNum == TEST_KERNEL_INSTRUCTIONS);
+	TEST_CHECK(last - first + 1 == TEST_WINDOW_INSTRUCTIONS);
+	TEST_CHECK(otherNum == 0);
+	if ((otherNum != 0) || (first >= last))
+	{
+		return HostTestResult("test_conv_kernel");
+	}
+
+	// Window cycles of the delays, first stage delay of single conversions, both of the two stage ones
+	printf("  %8s %8s %14s %10s\n", "delay0", "delay1", "window cycles", "expected");
+	for (delay0Idx = 0; delay0Idx < TEST_DELAYS_NUM; delay0Idx++)
+	{
+		for (delay1Idx = 0; delay1Idx < TEST_DELAYS_NUM; delay1Idx++)
+		{
+			cycles = TestWindowCycles(first, last, delays[delay0Idx], delays[delay1Idx]);
+			printf("  %8u %8u %14u %10u\n", delays[delay0Idx], delays[delay1Idx], cycles, TEST_WINDOW_CYCLES(delays[delay0Idx], delays[delay1Idx]));
+
+			TEST_CHECK(cycles == TEST_WINDOW_CYCLES(delays[delay0Idx], delays[delay1Idx]));
+		}
+	}
+
+	return HostTestResult("test_conv_kernel");
+}
@@ -0,0 +1,216 @@
+/****************************************************************************//*!
+*
+* @file     test_dctracker.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Adaptive slew DC tracker - time to recover after step, ramp and drift of the
+*           electrode raw data, fixed step DC tracker as the reference
+*
+* @note     DCTracker() simulated at the 2 pad board idle filter factor, fixed step by the
+*           null slew run pointer (same as TS_DCTRACKER_ADAPTIVE_SLEW 0). Recovered is the
+*           baseline within TEST_RECOVERED_ERROR of the noiseless raw data. The firmware
+*           part runs the release step and a held touch through the sensing periods.
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <math.h>
+#include <stddef.h>
+#include "host_test.h"
+#include "S32K144.h"
+#include "main.h"
+#include "ts_cfg.h"
+#include "ets.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+// Raw data baseline, white noise RMS [12-bit LSB]
+#define TEST_BASELINE          2000
+#define TEST_NOISE             3.0
+// Step and ramp size, ramp length, drift rate per period, hover depth and length
+#define TEST_STEP              300
+#define TEST_RAMP_PERIODS      300
+#define TEST_DRIFT_RATE        0.05
+#define TEST_HOVER             15
+#define TEST_HOVER_PERIODS     2000
+// Simulated periods, baseline error of the recovered DC tracker
+#define TEST_PERIODS           20000
+#define TEST_RECOVERED_ERROR   10
+
+// Scenarios
+#define TEST_NOISE_ONLY        0
+#define TEST_STEP_UP           1
+#define TEST_STEP_DOWN         2
+#define TEST_RAMP_UP           3
+#define TEST_DRIFT_UP          4
+#define TEST_HOVER_DOWN        5
+#define TEST_SCENARIOS_NUM     6
+
+// Touch of the firmware part [12-bit LSB below the baseline], sensing periods
+#define TEST_FW_TOUCH          60
+#define TEST_FW_PERIODS        500
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+extern tElecData  elecData[NUMBER_OF_ELECTRODES];
+
+static const char  *testScenarioName[TEST_SCENARIOS_NUM] = {"noise only [max error]", "step +300 [periods]", "step -300 [periods]", \
+		"ramp +1/period, 300 [periods]", "drift +0.05/period [max error]", "hover -15, 2000 [absorbed]"};
+
+// Electrode level of the firmware part
+static double  testLevel;
+
+/*****************************************************************************
+*
+* Function: double TestInput(uint32_t scenario, uint32_t periodNum)
+*
+* Description: Noiseless raw data of the scenario
+*
+*****************************************************************************/
+static double TestInput(uint32_t scenario, uint32_t periodNum)
+{
+	switch (scenario)
+	{
+	case TEST_STEP_UP:
+		return TEST_BASELINE + TEST_STEP;
+	case TEST_STEP_DOWN:
+		return TEST_BASELINE - TEST_STEP;
+	case TEST_RAMP_UP:
+		return TEST_BASELINE + ((periodNum < TEST_RAMP_PERIODS) ? periodNum : TEST_RAMP_PERIODS);
+	case TEST_DRIFT_UP:
+		return TEST_BASELINE + TEST_DRIFT_RATE * periodNum;
+	case TEST_HOVER_DOWN:
+		return TEST_BASELINE - ((periodNum < TEST_HOVER_PERIODS) ? TEST_HOVER : 0);
+	default:
+		return TEST_BASELINE;
+	}
+}
+
+/*****************************************************************************
+*
+* Function: double TestScenario(uint32_t scenario, uint8_t adaptive)
+*
+* Description: DC tracker through the scenario
+*
+* Output: Periods to recover after the step or ramp end, absorbed baseline drop at
+* 		  the hover end, max baseline error (noise, drift - second half)
+*
+*****************************************************************************/
+static double TestScenario(uint32_t scenario, uint8_t adaptive)
+{
+	int32_t   baselineRaw, baseline;
+	int16_t   slewRun;
+	uint32_t  periodNum, recovered;
+	double    input, error, errorMax;
+
+	HostRandomSeed(scenario + 1);
+	baselineRaw = TEST_BASELINE << ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
+	slewRun = 0;
+	recovered = TEST_PERIODS;
+	errorMax = 0;
+
+	for (periodNum = 0; periodNum < TEST_PERIODS; periodNum++)
+	{
+		input = TestInput(scenario, periodNum);
+		baseline = DCTracker((int32_t)lround(input + TEST_NOISE * HostGauss()), &baselineRaw, ELEC_DCTRACKER_FILTER_FACTOR_IDLE, adaptive ? &slewRun : NULL);
+		error = fabs(baseline - input);
+
+		if ((scenario == TEST_HOVER_DOWN) && (periodNum == TEST_HOVER_PERIODS - 1))
+		{
+			return TEST_BASELINE - baseline;
+		}
+		if ((periodNum >= TEST_PERIODS / 2) && (error > errorMax))
+		{
+			errorMax = error;
+		}
+		if ((error <= TEST_RECOVERED_ERROR) && (recovered == TEST_PERIODS) && \
+				((scenario != TEST_RAMP_UP) || (periodNum >= TEST_RAMP_PERIODS)))
+		{
+			recovered = periodNum - ((scenario == TEST_RAMP_UP) ? TEST_RAMP_PERIODS : 0);
+		}
+	}
+
+	if ((scenario == TEST_NOISE_ONLY) || (scenario == TEST_DRIFT_UP))
+	{
+		return errorMax;
+	}
+	return recovered;
+}
+
+/*****************************************************************************
+*
+* Function: int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+*
+* Description: Electrode level with white noise
+*
+*****************************************************************************/
+static int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+{
+	(void)adcNum;
+	(void)channel;
+
+	return (int32_t)lround(testLevel + TEST_NOISE * HostGauss());
+}
+
+int main(void)
+{
+	double    result[TEST_SCENARIOS_NUM][2];
+	uint32_t  scenario, periodNum;
+	int32_t   baseline;
+
+	// DC tracker simulation, fixed and adaptive step
+	printf("test_dctracker: shift %u, noise %.1f LSB, recovered within %u LSB\n", ELEC_DCTRACKER_FILTER_FACTOR_IDLE, TEST_NOISE, TEST_RECOVERED_ERROR);
+	printf("  %-32s %10s %10s\n", "scenario", "fixed", "adaptive");
+	for (scenario = 0; scenario < TEST_SCENARIOS_NUM; scenario++)
+	{
+		result[scenario][0] = TestScenario(scenario, NO);
+		result[scenario][1] = TestScenario(scenario, YES);
+		printf("  %-32s %10.0f %10.0f\n", testScenarioName[scenario], result[scenario][0], result[scenario][1]);
+	}
+
+	// Release direction recovered ten times faster, drift followed closer
+	TEST_CHECK(result[TEST_STEP_UP][1] * 10 < result[TEST_STEP_UP][0]);
+	TEST_CHECK(result[TEST_RAMP_UP][1] * 10 < result[TEST_RAMP_UP][0]);
+	TEST_CHECK(result[TEST_DRIFT_UP][1] < result[TEST_DRIFT_UP][0]);
+	TEST_CHECK(result[TEST_DRIFT_UP][1] <= TEST_RECOVERED_ERROR);
+	// Noise not amplified, touch direction (step down, hover) as slow as the fixed step
+	TEST_CHECK(result[TEST_NOISE_ONLY][1] <= result[TEST_NOISE_ONLY][0] + 1);
+	TEST_CHECK(result[TEST_STEP_DOWN][1] == result[TEST_STEP_DOWN][0]);
+	TEST_CHECK(result[TEST_HOVER_DOWN][1] <= result[TEST_HOVER_DOWN][0]);
+
+	// Firmware - release step after self-trim recovered by the sensing periods
+	hostAdcModel = TestAdcModel;
+	HostTouchSenseInit();
+	testLevel = TEST_BASELINE;
+	TEST_CHECK(HostTouchSenseSelfTrim(5000) < 5000);
+
+	testLevel = elecData[0].DCTrackerDataBuffer + TEST_STEP;
+	for (periodNum = 0; periodNum < TEST_FW_PERIODS; periodNum++)
+	{
+		if (fabs(elecData[0].DCTrackerDataBuffer - testLevel) <= TEST_RECOVERED_ERROR)
+		{
+			break;
+		}
+		HostTouchSensePeriods(1);
+	}
+	printf("  firmware step +%u recovered in %u periods\n", TEST_STEP, periodNum);
+	TEST_CHECK(periodNum < TEST_FW_PERIODS);
+
+	// Firmware - held touch, DC tracker frozen
+	HostTouchSensePeriods(50);
+	baseline = elecData[0].DCTrackerDataBuffer;
+	testLevel = baseline - TEST_FW_TOUCH;
+	HostTouchSensePeriods(TEST_FW_PERIODS);
+	printf("  firmware touch held %u periods, baseline moved %d\n", TEST_FW_PERIODS, elecData[0].DCTrackerDataBuffer - baseline);
+	TEST_CHECK(elecData[0].electrodeTouch[0] == YES);
+	TEST_CHECK(elecData[0].DCTrackerDataBuffer == baseline);
+
+	return HostTestResult("test_dctracker");
+}
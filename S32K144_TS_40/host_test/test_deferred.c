@@ -0,0 +1,191 @@
+/****************************************************************************//*!
+*
+* @file     test_deferred.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Deferred processing with frequency hopping - PendSV processes every frame on
+*           its own period/frequency ID, the scanning frequencyID changed by the acquisition
+*           interrupts only, touches qualified on both periods/frequencies
+*
+* @note     7 pad keypad without wake-up electrode. Interrupts run in two orders every
+*           period: LPTMR0, PendSV, LPIT0 (processing of the first frame before the second
+*           acquisition) and LPTMR0, LPIT0, PendSV (both frames processed at once).
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <math.h>
+#include "host_test.h"
+#include "S32K144.h"
+#include "main.h"
+#include "ts_cfg.h"
+#include "ets.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+// Untouched electrode level, white noise RMS, touch delta [12-bit LSB]
+#define TEST_ELECTRODE_LEVEL    2000
+#define TEST_NOISE              2.0
+#define TEST_TOUCH_DELTA        60
+// Periods of a touch and of the release after it, touch qualified after TEST_TOUCH_SETTLE periods
+#define TEST_TOUCH_PERIODS      40
+#define TEST_RELEASE_PERIODS    40
+#define TEST_TOUCH_SETTLE       20
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+extern tElecStruct  elecStruct[NUMBER_OF_ELECTRODES];
+extern tElecData  elecData[NUMBER_OF_ELECTRODES];
+extern uint8_t   frequencyID;
+extern uint8_t   electrodeTouchQualified[NUMBER_OF_ELECTRODES];
+extern uint32_t  acqFrameOverruns;
+
+void LPTMR0_IRQHandler(void);
+void LPIT0_Ch0_IRQHandler(void);
+void PendSV_Handler(void);
+
+// Touched electrode (NUMBER_OF_TOUCH_ELECTRODES none), PendSV runs with frequencyID changed
+static uint32_t  testTouchElec = NUMBER_OF_TOUCH_ELECTRODES;
+static uint32_t  testFrequencyIDChanged;
+
+/*****************************************************************************
+*
+* Function: int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+*
+* Description: Electrode level with white noise, touched electrode lower
+*
+*****************************************************************************/
+static int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+{
+	double  level;
+
+	level = TEST_ELECTRODE_LEVEL + TEST_NOISE * HostGauss();
+	if ((testTouchElec < NUMBER_OF_TOUCH_ELECTRODES) && (elecStruct[testTouchElec].adcBasePtr == (adcNum ? ADC1 : ADC0)) && \
+			((elecStruct[testTouchElec].adcChNum & 0x3F) == channel))
+	{
+		level -= TEST_TOUCH_DELTA;
+	}
+
+	return (int32_t)lround(level);
+}
+
+/*****************************************************************************
+*
+* Function: void TestPendSV(void)
+*
+* Description: Deferred processing, scanning frequencyID of the acquisition kept
+*
+*****************************************************************************/
+static void TestPendSV(void)
+{
+	uint8_t  frequencyIDBefore = frequencyID;
+
+	PendSV_Handler();
+
+	if (frequencyID != frequencyIDBefore)
+	{
+		testFrequencyIDChanged++;
+	}
+}
+
+/*****************************************************************************
+*
+* Function: void TestPeriod(uint32_t periodNum)
+*
+* Description: One sensing period - acquisition of both periods/frequencies and their
+* 				processing, interrupts order alternating every period
+*
+*****************************************************************************/
+static void TestPeriod(uint32_t periodNum)
+{
+	// First period/frequency acquired
+	TEST_CHECK(frequencyID == 0);
+	LPTMR0_IRQHandler();
+	TEST_CHECK(frequencyID == 1);
+
+	if (periodNum & 1)
+	{
+		// First frame processed before the second acquisition
+		TestPendSV();
+		LPIT0_Ch0_IRQHandler();
+	}
+	else
+	{
+		// Second period/frequency acquired, both frames processed
+		LPIT0_Ch0_IRQHandler();
+	}
+	TestPendSV();
+}
+
+int main(void)
+{
+	uint32_t  elecNum, periodNum, touchMissed, releaseMissed, falseTouch, otherNum;
+
+	hostAdcModel = TestAdcModel;
+	HostRandomSeed(1);
+	HostTouchSenseInit();
+	TEST_CHECK(HostTouchSenseSelfTrim(5000) < 5000);
+
+	touchMissed = releaseMissed = falseTouch = 0;
+	periodNum = 0;
+
+	// Touch button electrodes touched in turn
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+		testTouchElec = elecNum;
+		for (; periodNum < (elecNum * (TEST_TOUCH_PERIODS + TEST_RELEASE_PERIODS) + TEST_TOUCH_PERIODS); periodNum++)
+		{
+			TestPeriod(periodNum);
+			if ((periodNum % (TEST_TOUCH_PERIODS + TEST_RELEASE_PERIODS)) >= TEST_TOUCH_SETTLE)
+			{
+				// Touched on both periods/frequencies and qualified
+				if ((elecData[elecNum].electrodeTouch[0] != 1) || (elecData[elecNum].electrodeTouch[1] != 1) || (electrodeTouchQualified[elecNum] != 1))
+				{
+					touchMissed++;
+				}
+			}
+			for (otherNum = 0; otherNum < NUMBER_OF_TOUCH_ELECTRODES; otherNum++)
+			{
+				if ((otherNum != elecNum) && (electrodeTouchQualified[otherNum] != 0))
+				{
+					falseTouch++;
+				}
+			}
+		}
+
+		testTouchElec = NUMBER_OF_TOUCH_ELECTRODES;
+		for (; periodNum < ((elecNum + 1) * (TEST_TOUCH_PERIODS + TEST_RELEASE_PERIODS)); periodNum++)
+		{
+			TestPeriod(periodNum);
+			if ((periodNum % (TEST_TOUCH_PERIODS + TEST_RELEASE_PERIODS)) >= (TEST_TOUCH_PERIODS + TEST_TOUCH_SETTLE))
+			{
+				// Released
+				if ((elecData[elecNum].electrodeTouch[0] != 0) || (elecData[elecNum].electrodeTouch[1] != 0) || (electrodeTouchQualified[elecNum] != 0))
+				{
+					releaseMissed++;
+				}
+			}
+		}
+	}
+
+	printf("test_deferred: %u touch button electrodes, %u periods, PendSV with frequencyID changed %u, overruns %u\n", \
+			NUMBER_OF_TOUCH_ELECTRODES, periodNum, testFrequencyIDChanged, acqFrameOverruns);
+	printf("  touch missed %u, release missed %u, false touch %u\n", touchMissed, releaseMissed, falseTouch);
+
+	// Processing never changes the scanning frequencyID, every frame processed
+	TEST_CHECK(testFrequencyIDChanged == 0);
+	TEST_CHECK(acqFrameOverruns == 0);
+	// Touches qualified and released on both periods/frequencies, no other electrode
+	TEST_CHECK(touchMissed == 0);
+	TEST_CHECK(releaseMissed == 0);
+	TEST_CHECK(falseTouch == 0);
+
+	return HostTestResult("test_deferred");
+}
@@ -0,0 +1,154 @@
+/****************************************************************************//*!
+*
+* @file     test_dma_sequence.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    DMA acquisition - descriptor chain walked by the eDMA model writes the same
+*           registers in the same order as the CPU ChargeDistribution(), conversion
+*           start and ChargeRedistribution() loop, samples stored in the same order
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "host_test.h"
+#include "S32K144.h"
+#include "main.h"
+#include "ts_cfg.h"
+#include "ets.h"
+#include "dma.h"
+#include "gpio_inline_fcn1.h"
+#include "adc_inline_fcn1.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+// Samples of the burst, all sensing cycles
+#define TEST_SAMPLES_MAX   (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE)
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+extern tElecStruct  elecStruct[NUMBER_OF_ELECTRODES];
+extern int16_t  electrodeSensingCyclesPerSample;
+extern int16_t  adcDataElectrodeDischargeRawSample[TEST_SAMPLES_MAX];
+extern tDmaTcd  dmaSequenceTcd[DMA_SEQUENCE_STEPS];
+
+// Pin and conversion start writes of a burst
+static tHostRegAccess  testWrites[2][HOST_REG_TRACE_SIZE];
+static uint32_t  testWritesNum[2];
+
+// Conversions since the burst start
+static uint32_t  testConversions;
+
+/*****************************************************************************
+*
+* Function: int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+*
+* Description: Cext voltage of the channel changing with every conversion
+*
+*****************************************************************************/
+static int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+{
+	return 1500 + 60 * channel + 300 * adcNum + 7 * (testConversions++ % 11);
+}
+
+/*****************************************************************************
+*
+* Function: void TestWritesGet(uint32_t run)
+*
+* Description: GPIO, PORT and ADC SC1[0] writes of the recorded burst
+*
+*****************************************************************************/
+static void TestWritesGet(uint32_t run)
+{
+	uint32_t  accessNum, address;
+
+	testWritesNum[run] = 0;
+	for (accessNum = 0; accessNum < hostRegTraceNum; accessNum++)
+	{
+		address = hostRegTrace[accessNum].address;
+		if (hostRegTrace[accessNum].write && \
+				(((address >= PORTA_BASE) && (address < PORTE_BASE + 0x1000)) || \
+				 ((address >= PTA_BASE) && (address < PTE_BASE + sizeof(GPIO_Type))) || \
+				 (address == ADC0_BASE + offsetof(ADC_Type, SC1[0])) || (address == ADC1_BASE + offsetof(ADC_Type, SC1[0]))))
+		{
+			testWrites[run][testWritesNum[run]++] = hostRegTrace[accessNum];
+		}
+	}
+}
+
+int main(void)
+{
+	int16_t   samplesCpu[TEST_SAMPLES_MAX];
+	uint32_t  elecNum, sampleNum, samplesNum, step, accessNum, minorLoops;
+	uint8_t   writesEqual;
+
+	hostAdcModel = TestAdcModel;
+	HostTouchSenseInit();
+	DMA_Init();
+	ElectrodesGndAll();
+
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+		samplesNum = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + electrodeSensingCyclesPerSample;
+
+		// CPU driven sensing cycles (TS_DMA_ACQUISITION 0, TS_ASM_OPTIMIZE 0)
+		testConversions = 0;
+		HostRegTraceStart();
+		for (sampleNum = 0; sampleNum < samplesNum; sampleNum++)
+		{
+			ChargeDistribution(&elecStruct[elecNum]);
+			ConversionStartChargeRedistribution(&elecStruct[elecNum]);
+			samplesCpu[sampleNum] = EquivalentVoltageDigitalization(&elecStruct[elecNum]);
+		}
+		HostRegTraceStop();
+		TestWritesGet(0);
+		ElectrodesGndAll();
+
+		// DMA driven sensing cycles
+		testConversions = 0;
+		minorLoops = hostDmaMinorLoops;
+		memset(adcDataElectrodeDischargeRawSample, 0, sizeof(adcDataElectrodeDischargeRawSample));
+		HostRegTraceStart();
+		ElectrodeCapToVoltConvELCH(elecNum);
+		HostRegTraceStop();
+		TestWritesGet(1);
+		ElectrodesGndAll();
+
+		// Sequence steps chained by scatter/gather into a loop, first step started by the result channel link
+		for (step = 0; step < DMA_SEQUENCE_STEPS; step++)
+		{
+			TEST_CHECK(dmaSequenceTcd[step].DLASTSGA == (uint32_t)(uintptr_t)&dmaSequenceTcd[(step + 1) % DMA_SEQUENCE_STEPS]);
+			TEST_CHECK(dmaSequenceTcd[step].CSR & DMA_TCD_CSR_ESG_MASK);
+			TEST_CHECK(((dmaSequenceTcd[step].CSR & DMA_TCD_CSR_START_MASK) == 0) == (step == 0));
+		}
+
+		// Same register writes in the same order
+		writesEqual = (testWritesNum[0] == testWritesNum[1]);
+		for (accessNum = 0; writesEqual && (accessNum < testWritesNum[0]); accessNum++)
+		{
+			writesEqual = (testWrites[0][accessNum].address == testWrites[1][accessNum].address) && \
+					(testWrites[0][accessNum].value == testWrites[1][accessNum].value);
+		}
+		TEST_CHECK(writesEqual);
+
+		// Same samples stored in order, one sequence (8 steps) and one result store per sample
+		TEST_CHECK(memcmp(samplesCpu, adcDataElectrodeDischargeRawSample, samplesNum * sizeof(int16_t)) == 0);
+		TEST_CHECK(hostDmaMinorLoops - minorLoops == samplesNum * (DMA_SEQUENCE_STEPS + 1));
+		TEST_CHECK(testConversions == samplesNum);
+
+		printf("test_dma_sequence: electrode %u, %u samples, %u pin/conversion writes\n", elecNum, samplesNum, testWritesNum[1]);
+	}
+
+	// Whole firmware on DMA acquisition - self-trim done
+	TEST_CHECK(HostTouchSenseSelfTrim(5000) < 5000);
+
+	return HostTestResult("test_dma_sequence");
+}
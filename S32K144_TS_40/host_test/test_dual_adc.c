@@ -0,0 +1,118 @@
+/****************************************************************************//*!
+*
+* @file     test_dual_adc.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Dual ADC conversion - pairs with Cext on ADC0 and ADC1 converted by one SIM
+*           trigger, every result lands in the raw data of its own electrode
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include "host_test.h"
+#include "S32K144.h"
+#include "main.h"
+#include "ts_cfg.h"
+#include "ets.h"
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+extern tElecStruct  elecStruct[NUMBER_OF_ELECTRODES];
+extern tElecData  elecData[NUMBER_OF_ELECTRODES];
+extern uint8_t  elecPairPartner[NUMBER_OF_TOUCH_ELECTRODES];
+extern int16_t  electrodeSensingCyclesPerSample;
+extern tElecStatus  electrodesStatus;
+
+/*****************************************************************************
+*
+* Function: int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+*
+* Description: Distinct Cext voltage per ADC channel
+*
+*****************************************************************************/
+static int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+{
+	return 1000 + 40 * channel + 700 * adcNum;
+}
+
+int main(void)
+{
+	uint32_t  elecNum, adcNum, pairsNum, selfTrimPeriods;
+#ifdef WAKE_UP_ELECTRODE
+	uint32_t  periodNum, convertedNum;
+#endif
+
+	hostAdcModel = TestAdcModel;
+	HostTouchSenseInit();
+
+	// Pairs - partners each other, Cext on the other ADC
+	pairsNum = 0;
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+		if (elecPairPartner[elecNum] == ELEC_PAIR_NONE)
+		{
+			continue;
+		}
+		TEST_CHECK(elecPairPartner[elecPairPartner[elecNum]] == elecNum);
+		TEST_CHECK(elecStruct[elecNum].adcBasePtr != elecStruct[elecPairPartner[elecNum]].adcBasePtr);
+		if (elecStruct[elecNum].adcBasePtr == ADC0)
+		{
+			pairsNum++;
+		}
+	}
+	TEST_CHECK(pairsNum > 0);
+
+	// One scan of all touch button electrodes
+	hostAdcConversions[0] = hostAdcConversions[1] = hostAdcSimultaneousConversions = 0;
+	ElectrodesCapToVoltConv();
+
+	// Both ADCs of a pair converted by one trigger, every sensing cycle
+	TEST_CHECK(hostAdcSimultaneousConversions == pairsNum * (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + electrodeSensingCyclesPerSample));
+
+	// Raw data of every electrode from its own ADC channel
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+		adcNum = (elecStruct[elecNum].adcBasePtr == ADC0) ? 0 : 1;
+		TEST_CHECK(elecData[elecNum].adcDataElectrodeDischargeRaw[0] == TestAdcModel(adcNum, elecStruct[elecNum].adcChNum & 0x3F));
+	}
+
+	// Whole firmware - self-trim done, no touch reported
+	selfTrimPeriods = HostTouchSenseSelfTrim(5000);
+	TEST_CHECK(selfTrimPeriods < 5000);
+	HostTouchSensePeriods(200);
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+		TEST_CHECK(elecData[elecNum].electrodeTouch[0] == NO);
+	}
+	printf("test_dual_adc: %u pairs, self-trim %u periods\n", pairsNum, selfTrimPeriods);
+
+#ifdef WAKE_UP_ELECTRODE
+	// Idle, wake-up electrode scanned - slow baseline update converts one touch button electrode per period, pair partner not
+	for (periodNum = 0; periodNum < 2 * NUMBER_OF_TOUCH_ELECTRODES; periodNum++)
+	{
+		for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+		{
+			elecData[elecNum].adcDataElectrodeDischargeRaw[0] = -1;
+		}
+		HostTouchSensePeriods(1);
+
+		convertedNum = 0;
+		for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+		{
+			if (elecData[elecNum].adcDataElectrodeDischargeRaw[0] != -1)
+			{
+				convertedNum++;
+			}
+		}
+		TEST_CHECK(convertedNum <= 1);
+	}
+#endif
+
+	return HostTestResult("test_dual_adc");
+}
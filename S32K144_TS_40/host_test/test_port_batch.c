@@ -0,0 +1,177 @@
+/****************************************************************************//*!
+*
+* @file     test_port_batch.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Port-batched float/ground of all electrodes - same pins state as the
+*           per-electrode ElectrodeFloat()/ElectrodeGnd() loop, register accesses counted
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "host_test.h"
+#include "S32K144.h"
+#include "main.h"
+#include "ts_cfg.h"
+#include "ets.h"
+#include "gpio_inline_fcn1.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+// GPIO ports and PORT modules registers range
+#define TEST_GPIO_SIZE   (NUMBER_OF_GPIO_PORTS * (PTB_BASE - PTA_BASE))
+#define TEST_PORT_SIZE   (PORTE_BASE + 0x1000 - PORTA_BASE)
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+extern tElecStruct  elecStruct[NUMBER_OF_ELECTRODES];
+#if SLIDER_ENABLE
+extern tElecStruct  sliderElecStruct[NUMBER_OF_SLIDER_ELECTRODES];
+#endif
+
+// Pins state - PDDR, PDOR and PCR[15:0] of all ports
+typedef struct
+{
+	uint32_t  pddr[NUMBER_OF_GPIO_PORTS];
+	uint32_t  pdor[NUMBER_OF_GPIO_PORTS];
+	uint32_t  pcr[NUMBER_OF_GPIO_PORTS][32];
+}
+tTestPins;
+
+static const uint32_t  testGpioBase[NUMBER_OF_GPIO_PORTS] = {PTA_BASE, PTB_BASE, PTC_BASE, PTD_BASE, PTE_BASE};
+static const uint32_t  testPortBase[NUMBER_OF_GPIO_PORTS] = {PORTA_BASE, PORTB_BASE, PORTC_BASE, PORTD_BASE, PORTE_BASE};
+
+/*****************************************************************************
+*
+* Function: void TestPinsSet(uint32_t pddr, uint32_t pdor, uint32_t pcr)
+*
+* Description: Same start state of all pins
+*
+*****************************************************************************/
+static void TestPinsSet(uint32_t pddr, uint32_t pdor, uint32_t pcr)
+{
+	uint32_t  portNum, pinNum;
+
+	for (portNum = 0; portNum < NUMBER_OF_GPIO_PORTS; portNum++)
+	{
+		HostRegWrite(testGpioBase[portNum] + offsetof(GPIO_Type, PDDR), pddr);
+		HostRegWrite(testGpioBase[portNum] + offsetof(GPIO_Type, PDOR), pdor);
+		for (pinNum = 0; pinNum < 32; pinNum++)
+		{
+			HostRegWrite(testPortBase[portNum] + offsetof(PORT_Type, PCR) + 4 * pinNum, pcr);
+		}
+	}
+}
+
+/*****************************************************************************
+*
+* Function: void TestPinsGet(tTestPins *pinsPtr)
+*
+* Description: Pins state, PCR status flags (write 1 to clear) left out
+*
+*****************************************************************************/
+static void TestPinsGet(tTestPins *pinsPtr)
+{
+	uint32_t  portNum, pinNum;
+
+	memset(pinsPtr, 0, sizeof(*pinsPtr));
+	for (portNum = 0; portNum < NUMBER_OF_GPIO_PORTS; portNum++)
+	{
+		pinsPtr->pddr[portNum] = HostRegRead(testGpioBase[portNum] + offsetof(GPIO_Type, PDDR));
+		pinsPtr->pdor[portNum] = HostRegRead(testGpioBase[portNum] + offsetof(GPIO_Type, PDOR));
+		for (pinNum = 0; pinNum < 32; pinNum++)
+		{
+			pinsPtr->pcr[portNum][pinNum] = HostRegRead(testPortBase[portNum] + offsetof(PORT_Type, PCR) + 4 * pinNum) & 0x0000FFFF;
+		}
+	}
+}
+
+/*****************************************************************************
+*
+* Function: uint32_t TestAccesses(void)
+*
+* Description: GPIO and PORT register accesses recorded
+*
+*****************************************************************************/
+static uint32_t TestAccesses(void)
+{
+	return HostRegTraceCount(PTA_BASE, TEST_GPIO_SIZE, 0) + HostRegTraceCount(PTA_BASE, TEST_GPIO_SIZE, 1) + \
+			HostRegTraceCount(PORTA_BASE, TEST_PORT_SIZE, 0) + HostRegTraceCount(PORTA_BASE, TEST_PORT_SIZE, 1);
+}
+
+int main(void)
+{
+	tTestPins  pinsLoop, pinsBatched;
+	uint32_t  elecNum, gndLoop, gndBatched, floatLoop, floatBatched;
+
+	HostTouchSenseInit();
+
+	// Ground - per-electrode loop
+	TestPinsSet(0, 0xFFFFFFFF, 0);
+	HostRegTraceStart();
+	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+	{
+		ElectrodeGnd(&elecStruct[elecNum]);
+	}
+#if SLIDER_ENABLE
+	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
+	{
+		ElectrodeGnd(&sliderElecStruct[elecNum]);
+	}
+#endif
+	HostRegTraceStop();
+	gndLoop = TestAccesses();
+	TestPinsGet(&pinsLoop);
+
+	// Ground - port-batched
+	TestPinsSet(0, 0xFFFFFFFF, 0);
+	HostRegTraceStart();
+	ElectrodesGndAll();
+	HostRegTraceStop();
+	gndBatched = TestAccesses();
+	TestPinsGet(&pinsBatched);
+
+	TEST_CHECK(memcmp(&pinsLoop, &pinsBatched, sizeof(pinsLoop)) == 0);
+	TEST_CHECK(gndBatched < gndLoop);
+
+	// Float - per-electrode loop
+	TestPinsSet(0xFFFFFFFF, 0, PCR_GPIO & 0x0000FFFF);
+	HostRegTraceStart();
+	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+	{
+		ElectrodeFloat(&elecStruct[elecNum]);
+	}
+#if SLIDER_ENABLE
+	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
+	{
+		ElectrodeFloat(&sliderElecStruct[elecNum]);
+	}
+#endif
+	HostRegTraceStop();
+	floatLoop = TestAccesses();
+	TestPinsGet(&pinsLoop);
+
+	// Float - port-batched
+	TestPinsSet(0xFFFFFFFF, 0, PCR_GPIO & 0x0000FFFF);
+	HostRegTraceStart();
+	ElectrodesFloatAll();
+	HostRegTraceStop();
+	floatBatched = TestAccesses();
+	TestPinsGet(&pinsBatched);
+
+	TEST_CHECK(memcmp(&pinsLoop, &pinsBatched, sizeof(pinsLoop)) == 0);
+	TEST_CHECK(floatBatched < floatLoop);
+
+	printf("test_port_batch: ground %u -> %u accesses, float %u -> %u accesses\n", gndLoop, gndBatched, floatLoop, floatBatched);
+
+	return HostTestResult("test_port_batch");
+}
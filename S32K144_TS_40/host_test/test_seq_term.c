@@ -0,0 +1,180 @@
+/****************************************************************************//*!
+*
+* @file     test_seq_term.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Sequential early termination - sensing cycles saved and decision error rate
+*           of the shortened bursts against the full bursts, electrode levels from far
+*           above the release threshold to far below the touch threshold
+*
+* @note     Decision of a burst is the raw data side of the thresholds - touch (below the
+*           touch threshold), release (above the release threshold) or undecided. Decision
+*           error is a burst decided differently from the noiseless electrode level.
+*           Full bursts are the same bursts with the sequential test held off (self-trim
+*           done flag cleared for the burst).
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <math.h>
+#include "host_test.h"
+#include "S32K144.h"
+#include "main.h"
+#include "ts_cfg.h"
+#include "ets.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+// Untouched electrode equivalent voltage, white noise RMS of a sample [12-bit LSB]
+#define TEST_BASELINE_LEVEL   2000
+#define TEST_NOISE            8.0
+// Electrode level offsets from the baseline [12-bit LSB]
+#define TEST_OFFSETS          {0, -8, -14, -21, -28, -34, -60}
+#define TEST_OFFSETS_NUM      7
+// Bursts per electrode level and mode
+#define TEST_BURSTS           4000
+// Early bursts decision error rate allowed above the full bursts one (statistical spread of the bursts)
+#define TEST_ERROR_TOLERANCE  0.002
+
+// Burst decision
+#define TEST_RELEASE          0
+#define TEST_TOUCH            1
+#define TEST_UNDECIDED        2
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+extern int16_t  numberOfElectrodeSensingCyclesPerSample;
+extern tElecData  elecData[NUMBER_OF_ELECTRODES];
+extern tElecStatus  electrodesStatus;
+extern uint32_t  sequentialTestSamplesNum;
+extern uint32_t  sequentialTestTerminations, sequentialTestCyclesSaved;
+
+// Electrode level of the burst
+static double  testLevel;
+
+/*****************************************************************************
+*
+* Function: int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+*
+* Description: Electrode level with white noise
+*
+*****************************************************************************/
+static int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+{
+	(void)adcNum;
+	(void)channel;
+
+	return (int32_t)lround(testLevel + TEST_NOISE * HostGauss());
+}
+
+/*****************************************************************************
+*
+* Function: uint32_t TestDecision(double rawData)
+*
+* Description: Raw data side of electrode 0 touch and release thresholds
+*
+*****************************************************************************/
+static uint32_t TestDecision(double rawData)
+{
+	if (rawData < elecData[0].detectorThresholdTouch)
+	{
+		return TEST_TOUCH;
+	}
+	if (rawData > elecData[0].detectorThresholdRelease)
+	{
+		return TEST_RELEASE;
+	}
+	return TEST_UNDECIDED;
+}
+
+/*****************************************************************************
+*
+* Function: void TestBursts(double offset, uint8_t early, uint32_t *errorsPtr, uint32_t *cyclesPtr)
+*
+* Description: Electrode 0 bursts at the level offset, decision errors and sensing cycles used
+*
+*****************************************************************************/
+static void TestBursts(double offset, uint8_t early, uint32_t *errorsPtr, uint32_t *cyclesPtr)
+{
+	uint32_t  burstNum, decisionTrue;
+
+	*errorsPtr = 0;
+	*cyclesPtr = 0;
+	testLevel = elecData[0].DCTrackerDataBuffer + offset;
+	decisionTrue = TestDecision(testLevel);
+
+	// Same noise for both modes
+	HostRandomSeed((uint32_t)(1000 - offset));
+	electrodesStatus.bit.selfTrimDone = early;
+
+	for (burstNum = 0; burstNum < TEST_BURSTS; burstNum++)
+	{
+		numberOfElectrodeSensingCyclesPerSample = NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE;
+		ElectrodeCapToVoltConvELCH(0);
+
+		*cyclesPtr += sequentialTestSamplesNum;
+		if (TestDecision(elecData[0].adcDataElectrodeDischargeRaw[0]) != decisionTrue)
+		{
+			(*errorsPtr)++;
+		}
+	}
+
+	electrodesStatus.bit.selfTrimDone = YES;
+}
+
+int main(void)
+{
+	const int32_t  offsets[TEST_OFFSETS_NUM] = TEST_OFFSETS;
+	uint32_t  offsetIdx, errorsEarly, errorsFull, cyclesEarly, cyclesFull;
+	uint32_t  errorsEarlySum, errorsFullSum, cyclesEarlySum, cyclesFullSum, terminations;
+
+	hostAdcModel = TestAdcModel;
+	HostTouchSenseInit();
+
+	// Thresholds from the untouched electrode self-trim
+	testLevel = TEST_BASELINE_LEVEL;
+	TEST_CHECK(HostTouchSenseSelfTrim(5000) < 5000);
+
+	printf("test_seq_term: touch threshold %d, release threshold %d, baseline %d, sample noise %.1f LSB\n", \
+			elecData[0].detectorThresholdTouch, elecData[0].detectorThresholdRelease, elecData[0].DCTrackerDataBuffer, TEST_NOISE);
+	printf("  offset  cycles full  cycles early  errors full  errors early\n");
+
+	errorsEarlySum = errorsFullSum = cyclesEarlySum = cyclesFullSum = 0;
+	terminations = sequentialTestTerminations;
+	for (offsetIdx = 0; offsetIdx < TEST_OFFSETS_NUM; offsetIdx++)
+	{
+		TestBursts(offsets[offsetIdx], NO, &errorsFull, &cyclesFull);
+		TestBursts(offsets[offsetIdx], YES, &errorsEarly, &cyclesEarly);
+		printf("  %6d  %11.2f  %12.2f  %10.2f%%  %11.2f%%\n", offsets[offsetIdx], (double)cyclesFull / TEST_BURSTS, (double)cyclesEarly / TEST_BURSTS, \
+				100.0 * errorsFull / TEST_BURSTS, 100.0 * errorsEarly / TEST_BURSTS);
+
+		errorsFullSum += errorsFull;
+		errorsEarlySum += errorsEarly;
+		cyclesFullSum += cyclesFull;
+		cyclesEarlySum += cyclesEarly;
+
+		// Full bursts never shortened, decision error rate of every level not above the full bursts one by more than TEST_ERROR_TOLERANCE
+		TEST_CHECK(cyclesFull == TEST_BURSTS * NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE);
+		TEST_CHECK(errorsEarly <= errorsFull + TEST_BURSTS * TEST_ERROR_TOLERANCE);
+	}
+	terminations = sequentialTestTerminations - terminations;
+
+	printf("  cycles saved %.1f%%, %u of %u bursts stopped, decision errors full %.2f%%, early %.2f%%\n", \
+			100.0 * (cyclesFullSum - cyclesEarlySum) / cyclesFullSum, terminations, TEST_OFFSETS_NUM * TEST_BURSTS, \
+			100.0 * errorsFullSum / (TEST_OFFSETS_NUM * TEST_BURSTS), 100.0 * errorsEarlySum / (TEST_OFFSETS_NUM * TEST_BURSTS));
+
+	// Saved cycles reported on target match the cycles not taken
+	TEST_CHECK(cyclesFullSum - cyclesEarlySum == sequentialTestCyclesSaved);
+	// Cycles saved, decision error rate of all levels not above the full bursts one
+	TEST_CHECK(cyclesEarlySum < cyclesFullSum);
+	TEST_CHECK(errorsEarlySum <= errorsFullSum + TEST_OFFSETS_NUM * TEST_BURSTS * TEST_ERROR_TOLERANCE);
+
+	return HostTestResult("test_seq_term");
+}
@@ -0,0 +1,205 @@
+/****************************************************************************//*!
+*
+* @file     test_startup.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Startup time from reset to the first touch sense scan - acquisition timing
+*           auto-tuning and self-trim scans, baseline error, quiet, noisy and settling
+*           electrodes
+*
+* @note     Built twice: test_startup_fixed (TS_SELF_TRIM_CONVERGENCE 0, self-trim of
+*           NUMBER_OF_CYCLES_DCTRACKER_PWRUP scans) and test_startup (TS_SELF_TRIM_CONVERGENCE 1),
+*           both with TS_TIMING_AUTOTUNE 1. Modelled time is the scans at the self-trim
+*           LPTMR0 period (LPTMR_ELEC_CAL) plus one sensing period to the first scan, ADC
+*           calibration and clock startup not modelled. Every startup runs in its own
+*           process (RAM from reset).
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <math.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "host_test.h"
+#include "S32K144.h"
+#include "main.h"
+#include "ts_cfg.h"
+#include "ets.h"
+#include "timer.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+#if TS_SELF_TRIM_CONVERGENCE
+#define TEST_NAME               "test_startup"
+#else
+#define TEST_NAME               "test_startup_fixed"
+#endif
+
+// Settled electrode level [12-bit LSB]
+#define TEST_ELECTRODE_LEVEL    2000
+// Startups - white noise RMS [12-bit LSB], power-up settling amplitude [12-bit LSB] and time constant [scans]
+#define TEST_NOISE              {2.0, 6.0, 6.0}
+#define TEST_SETTLE             {0.0, 0.0, 30.0}
+#define TEST_SETTLE_TAU         {1.0, 1.0, 20.0}
+#define TEST_STARTUPS_NUM       3
+// Runs of each startup (noise seeds)
+#define TEST_RUNS               20
+// Scans limit of a startup
+#define TEST_SCANS_MAX          1000
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+extern tElecStatus  electrodesStatus;
+extern tElecData  elecData[NUMBER_OF_ELECTRODES];
+
+// Startup result - auto-tuning scans, self-trim scans, electrode 0 baseline error
+typedef struct
+{
+	uint32_t  tuneScans;
+	uint32_t  selfTrimScans;
+	double    error;
+}
+tTestStartup;
+
+static const char  *testStartupName[TEST_STARTUPS_NUM] = {"noise 2, no settling", "noise 6, no settling", "noise 6, settling 30 tau 20"};
+
+// Electrode model of the startup, scan number
+static double    testNoise, testSettle, testSettleTau;
+static uint32_t  testScan;
+
+/*****************************************************************************
+*
+* Function: int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+*
+* Description: Electrode level settling from power-up with white noise
+*
+*****************************************************************************/
+static int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+{
+	(void)adcNum;
+	(void)channel;
+
+	return (int32_t)lround(TEST_ELECTRODE_LEVEL + testSettle * exp(-(double)testScan / testSettleTau) + testNoise * HostGauss());
+}
+
+/*****************************************************************************
+*
+* Function: void TestStartupRun(tTestStartup *startupPtr)
+*
+* Description: Startup as in main(), scans until acquisition timing auto-tuning done and
+* 				until self-trim done
+*
+*****************************************************************************/
+static void TestStartupRun(tTestStartup *startupPtr)
+{
+	HostTouchSenseInit();
+
+	startupPtr->tuneScans = TEST_SCANS_MAX;
+	for (testScan = 0; testScan < TEST_SCANS_MAX; testScan++)
+	{
+		if ((electrodesStatus.bit.timingTuneDone == YES) && (startupPtr->tuneScans == TEST_SCANS_MAX))
+		{
+			startupPtr->tuneScans = testScan;
+		}
+		if (electrodesStatus.bit.selfTrimDone == YES)
+		{
+			break;
+		}
+		HostTouchSensePeriods(1);
+	}
+
+	startupPtr->selfTrimScans = testScan - startupPtr->tuneScans;
+	startupPtr->error = fabs(elecData[0].DCTrackerDataBuffer - (double)TEST_ELECTRODE_LEVEL);
+}
+
+/*****************************************************************************
+*
+* Function: void TestStartup(uint32_t seed, tTestStartup *startupPtr)
+*
+* Description: Startup in a child process, firmware started from reset
+*
+*****************************************************************************/
+static void TestStartup(uint32_t seed, tTestStartup *startupPtr)
+{
+	int  pipeFd[2];
+
+	memset(startupPtr, 0, sizeof(*startupPtr));
+	if (pipe(pipeFd) != 0)
+	{
+		return;
+	}
+	if (fork() == 0)
+	{
+		HostRandomSeed(seed);
+		TestStartupRun(startupPtr);
+		write(pipeFd[1], startupPtr, sizeof(*startupPtr));
+		_exit(0);
+	}
+	read(pipeFd[0], startupPtr, sizeof(*startupPtr));
+	wait(0);
+	close(pipeFd[0]);
+	close(pipeFd[1]);
+}
+
+int main(void)
+{
+	const double  noise[TEST_STARTUPS_NUM] = TEST_NOISE;
+	const double  settle[TEST_STARTUPS_NUM] = TEST_SETTLE;
+	const double  settleTau[TEST_STARTUPS_NUM] = TEST_SETTLE_TAU;
+	tTestStartup  startup;
+	uint32_t  startupIdx, runNum, scansMax;
+	double    scansSum, errorSum, timeMean;
+
+	hostAdcModel = TestAdcModel;
+
+	printf("%s: self-trim convergence %s, timing auto-tuning %u x %u scans, scan %u ms, sensing period %u ms, touch threshold %d LSB\n", \
+			TEST_NAME, TS_SELF_TRIM_CONVERGENCE ? "on" : "off", NUMBER_OF_TIMING_TUNE_CANDIDATES, NUMBER_OF_TIMING_TUNE_SCANS, \
+			LPTMR_ELEC_CAL + 1, ELECTRODES_SENSE_PERIOD, ELEC_TOUCH_THRESHOLD_DELTA);
+	printf("  %-28s %6s %16s %14s %14s\n", "startup", "tune", "self-trim mean", "self-trim max", "time [ms]");
+
+	for (startupIdx = 0; startupIdx < TEST_STARTUPS_NUM; startupIdx++)
+	{
+		testNoise = noise[startupIdx];
+		testSettle = settle[startupIdx];
+		testSettleTau = settleTau[startupIdx];
+
+		scansSum = errorSum = 0;
+		scansMax = 0;
+		for (runNum = 0; runNum < TEST_RUNS; runNum++)
+		{
+			TestStartup(startupIdx * TEST_RUNS + runNum + 1, &startup);
+
+			// Auto-tuning adds all candidates scans, self-trim done within its cap
+			TEST_CHECK(startup.tuneScans == NUMBER_OF_TIMING_TUNE_CANDIDATES * NUMBER_OF_TIMING_TUNE_SCANS);
+			TEST_CHECK(startup.selfTrimScans <= NUMBER_OF_CYCLES_DCTRACKER_PWRUP + 1);
+#if TS_SELF_TRIM_CONVERGENCE
+			TEST_CHECK(startup.selfTrimScans >= SELF_TRIM_MIN_CYCLES);
+#else
+			TEST_CHECK(startup.selfTrimScans >= NUMBER_OF_CYCLES_DCTRACKER_PWRUP);
+#endif
+			// Baseline within the touch threshold / 4 of the settled level
+			TEST_CHECK(startup.error * 4 < ELEC_TOUCH_THRESHOLD_DELTA);
+
+			scansSum += startup.selfTrimScans;
+			errorSum += startup.error;
+			if (startup.selfTrimScans > scansMax)
+			{
+				scansMax = startup.selfTrimScans;
+			}
+		}
+
+		timeMean = (startup.tuneScans + scansSum / TEST_RUNS) * (LPTMR_ELEC_CAL + 1) + ELECTRODES_SENSE_PERIOD;
+		printf("  %-28s %6u %16.1f %14u %14.1f   baseline error %.2f LSB\n", testStartupName[startupIdx], startup.tuneScans, \
+				scansSum / TEST_RUNS, scansMax, timeMean, errorSum / TEST_RUNS);
+	}
+
+	return HostTestResult(TEST_NAME);
+}
@@ -0,0 +1,184 @@
+/****************************************************************************//*!
+*
+* @file     test_temp_comp.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Temperature feed-forward baseline compensation - thermal ramp up and down
+*           faster than the DC tracker slew, baseline error and false touches with the
+*           on-chip temperature sensor following the ramp and with it held
+*
+* @note     Held temperature sensor is the same firmware without temperature information,
+*           ElectrodeTempCompUpdate() sees no temperature step and the DC tracker alone
+*           follows the electrodes drift. Every ramp runs in its own process, firmware
+*           started from reset.
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <math.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "host_test.h"
+#include "S32K144.h"
+#include "main.h"
+#include "ts_cfg.h"
+#include "ets.h"
+#include "adc.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+// Untouched electrode level at the start temperature, drift [12-bit LSB per degC], white noise RMS
+#define TEST_ELECTRODE_LEVEL    2000
+#define TEST_ELECTRODE_DRIFT    (-1.5)
+#define TEST_NOISE              2.0
+// On-chip temperature sensor level at the start temperature, slope [12-bit LSB per degC]
+#define TEST_SENSOR_LEVEL       1600
+#define TEST_SENSOR_SLOPE       (-2.0)
+// Thermal ramp [degC] and its length [sensing periods], each direction
+#define TEST_RAMP               60.0
+#define TEST_RAMP_PERIODS       1200
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+extern tElecData  elecData[NUMBER_OF_ELECTRODES];
+
+// Ramp result - self-trim periods, worst baseline error, periods with false touch, learned coefficient
+typedef struct
+{
+	uint32_t  selfTrimPeriods;
+	double    errorMax;
+	uint32_t  falseTouch;
+	int32_t   coef;
+}
+tTestRamp;
+
+// Temperature change from the start [degC], temperature sensor following it
+static double   testTemperature;
+static uint8_t  testSensorFollows;
+
+/*****************************************************************************
+*
+* Function: int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+*
+* Description: ADC0 temperature sensor channel and electrodes level at the temperature
+*
+*****************************************************************************/
+static int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+{
+	if ((adcNum == 0) && (channel == ADC_CH_TEMP_SENSOR))
+	{
+		return (int32_t)lround(TEST_SENSOR_LEVEL + (testSensorFollows ? TEST_SENSOR_SLOPE * testTemperature : 0) + 0.5 * HostGauss());
+	}
+
+	return (int32_t)lround(TEST_ELECTRODE_LEVEL + TEST_ELECTRODE_DRIFT * testTemperature + TEST_NOISE * HostGauss());
+}
+
+/*****************************************************************************
+*
+* Function: void TestRampRun(uint8_t sensorFollows, tTestRamp *rampPtr)
+*
+* Description: Self-trim at the start temperature, ramp up and down, worst baseline error
+* 				of electrode 0 on the way down (coefficient learned on the way up) and
+* 				sensing periods with false touch of any electrode
+*
+*****************************************************************************/
+static void TestRampRun(uint8_t sensorFollows, tTestRamp *rampPtr)
+{
+	uint32_t  periodNum, elecNum;
+	double    error;
+
+	testSensorFollows = sensorFollows;
+	testTemperature = 0;
+	HostTouchSenseInit();
+	rampPtr->selfTrimPeriods = HostTouchSenseSelfTrim(5000);
+
+	rampPtr->errorMax = 0;
+	rampPtr->falseTouch = 0;
+	for (periodNum = 0; periodNum < 2 * TEST_RAMP_PERIODS; periodNum++)
+	{
+		testTemperature = TEST_RAMP * ((periodNum < TEST_RAMP_PERIODS) ? periodNum : (2 * TEST_RAMP_PERIODS - periodNum)) / TEST_RAMP_PERIODS;
+		HostTouchSensePeriods(1);
+
+		for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+		{
+			if (elecData[elecNum].electrodeTouch[0] == YES)
+			{
+				rampPtr->falseTouch++;
+				break;
+			}
+		}
+
+		error = fabs(elecData[0].DCTrackerDataBuffer - (TEST_ELECTRODE_LEVEL + TEST_ELECTRODE_DRIFT * testTemperature));
+		if ((periodNum >= TEST_RAMP_PERIODS) && (error > rampPtr->errorMax))
+		{
+			rampPtr->errorMax = error;
+		}
+	}
+	rampPtr->coef = elecData[0].tempCompCoef;
+}
+
+/*****************************************************************************
+*
+* Function: void TestRamp(uint8_t sensorFollows, tTestRamp *rampPtr)
+*
+* Description: Ramp in a child process, firmware started from reset
+*
+*****************************************************************************/
+static void TestRamp(uint8_t sensorFollows, tTestRamp *rampPtr)
+{
+	int  pipeFd[2];
+
+	memset(rampPtr, 0, sizeof(*rampPtr));
+	if (pipe(pipeFd) != 0)
+	{
+		return;
+	}
+	if (fork() == 0)
+	{
+		TestRampRun(sensorFollows, rampPtr);
+		write(pipeFd[1], rampPtr, sizeof(*rampPtr));
+		_exit(0);
+	}
+	read(pipeFd[0], rampPtr, sizeof(*rampPtr));
+	wait(0);
+	close(pipeFd[0]);
+	close(pipeFd[1]);
+}
+
+int main(void)
+{
+	tTestRamp  held, comp;
+
+	hostAdcModel = TestAdcModel;
+	HostRandomSeed(1);
+
+	// Temperature sensor held, DC tracker alone
+	TestRamp(NO, &held);
+	// Temperature sensor following the ramp, feed-forward
+	TestRamp(YES, &comp);
+
+	printf("test_temp_comp: ramp %.0f degC in %u periods up and down, electrode drift %.1f LSB/degC, touch threshold %d LSB\n", \
+			TEST_RAMP, TEST_RAMP_PERIODS, TEST_ELECTRODE_DRIFT, ELEC_TOUCH_THRESHOLD_DELTA);
+	printf("  without feed-forward: worst baseline error %.1f LSB, %u periods with false touch\n", held.errorMax, held.falseTouch);
+	printf("  with feed-forward:    worst baseline error %.1f LSB, %u periods with false touch\n", comp.errorMax, comp.falseTouch);
+	printf("  learned coefficient %d/%u LSB per sensor LSB, model %.1f/%u\n", comp.coef, 1 << TEMP_COMP_COEF_SHIFT, \
+			(TEST_ELECTRODE_DRIFT / (TEST_SENSOR_SLOPE * TEMP_SENSOR_SAMPLES)) * (1 << TEMP_COMP_COEF_SHIFT), 1 << TEMP_COMP_COEF_SHIFT);
+
+	TEST_CHECK(held.selfTrimPeriods < 5000);
+	TEST_CHECK(comp.selfTrimPeriods < 5000);
+	// Baseline error past the touch threshold without, within half of it with feed-forward, no false touch
+	TEST_CHECK(held.errorMax > ELEC_TOUCH_THRESHOLD_DELTA);
+	TEST_CHECK(held.falseTouch > 0);
+	TEST_CHECK(comp.errorMax < ELEC_TOUCH_THRESHOLD_DELTA / 2);
+	TEST_CHECK(comp.falseTouch == 0);
+
+	return HostTestResult("test_temp_comp");
+}
@@ -0,0 +1,261 @@
+/****************************************************************************//*!
+*
+* @file     test_timing_tune.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Acquisition timing auto-tuning - candidate selected per electrode against the
+*           shortest candidate reaching TIMING_TUNE_TARGET_SNR in the electrode model,
+*           touch delta scaled with the candidate raw data level, longest candidate
+*           when none reaches the target
+*
+* @note     Electrode model of each candidate (charge distribution period and ADC sample
+*           time loaded to the electrode record) is a raw data level and a noise of +/-
+*           amplitude alternating every scan, peak-to-peak exactly twice the amplitude
+*           over the candidate scans. Every startup runs in its own process (RAM from reset).
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "host_test.h"
+#include "S32K144.h"
+#include "main.h"
+#include "ts_cfg.h"
+#include "ets.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+// Raw data level of the candidates, ADC sample time 6 candidates lower [12-bit LSB]
+#define TEST_LEVEL              {1500, 1500, 2000, 2000, 1500, 2000, 2000, 2000, 2000}
+// Noise amplitude of the candidates [12-bit LSB] - quiet, noisy and too noisy electrode
+#define TEST_NOISE_QUIET        {1, 1, 1, 1, 1, 1, 1, 1, 1}
+#define TEST_NOISE_NOISY        {4, 4, 3, 3, 2, 2, 1, 1, 1}
+#define TEST_NOISE_TOO_NOISY    {5, 5, 5, 5, 5, 5, 5, 5, 5}
+#define TEST_PROFILES_NUM       3
+
+// Scans limit of the auto-tuning
+#define TEST_SCANS_MAX          1000
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+extern tElecStatus  electrodesStatus;
+extern tElecStruct  elecStruct[NUMBER_OF_ELECTRODES];
+extern tElecData  elecData[NUMBER_OF_ELECTRODES];
+extern const uint16_t  timingTuneChargeDistributionPeriod[NUMBER_OF_TIMING_TUNE_CANDIDATES];
+extern const uint8_t   timingTuneAdcSampleTime[NUMBER_OF_TIMING_TUNE_CANDIDATES];
+extern uint8_t  elecTimingTuneResult[NUMBER_OF_ELECTRODES];
+
+// Auto-tuning result - scans, touch threshold delta, candidate selected and timing loaded per electrode
+typedef struct
+{
+	uint32_t  scans;
+	int16_t   touchDelta[NUMBER_OF_ELECTRODES];
+	uint8_t   candidate[NUMBER_OF_ELECTRODES];
+	uint16_t  chargeDistributionPeriod[NUMBER_OF_ELECTRODES];
+	uint8_t   adcSampleTime[NUMBER_OF_ELECTRODES];
+}
+tTestTune;
+
+static const int32_t  testLevel[NUMBER_OF_TIMING_TUNE_CANDIDATES] = TEST_LEVEL;
+static const int32_t  testNoise[TEST_PROFILES_NUM][NUMBER_OF_TIMING_TUNE_CANDIDATES] = {TEST_NOISE_QUIET, TEST_NOISE_NOISY, TEST_NOISE_TOO_NOISY};
+static const char  *testProfileName[TEST_PROFILES_NUM] = {"quiet", "noisy", "too noisy"};
+
+// Noise profile of touch button electrodes 0 and 1 (others quiet), scan number
+static uint32_t  testProfile[2];
+static uint32_t  testScan;
+
+/*****************************************************************************
+*
+* Function: uint32_t TestCandidate(uint32_t elecNum)
+*
+* Description: Candidate of the timing loaded to the electrode record
+*
+*****************************************************************************/
+static uint32_t TestCandidate(uint32_t elecNum)
+{
+	uint32_t  candidate;
+
+	for (candidate = 0; candidate < NUMBER_OF_TIMING_TUNE_CANDIDATES; candidate++)
+	{
+		if ((elecData[elecNum].elecChargeDistributionPeriod == timingTuneChargeDistributionPeriod[candidate]) && \
+				(elecData[elecNum].elecAdcSampleTime == timingTuneAdcSampleTime[candidate]))
+		{
+			break;
+		}
+	}
+
+	return (candidate < NUMBER_OF_TIMING_TUNE_CANDIDATES) ? candidate : TIMING_TUNE_REFERENCE_CANDIDATE;
+}
+
+/*****************************************************************************
+*
+* Function: int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+*
+* Description: Level of the electrode candidate, noise amplitude of its profile alternating every scan
+*
+*****************************************************************************/
+static int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+{
+	uint32_t  elecNum, candidate, profile;
+
+	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+	{
+		if ((elecStruct[elecNum].adcBasePtr == (adcNum ? ADC1 : ADC0)) && ((elecStruct[elecNum].adcChNum & 0x3F) == channel))
+		{
+			break;
+		}
+	}
+	if (elecNum == NUMBER_OF_ELECTRODES)
+	{
+		return testLevel[TIMING_TUNE_REFERENCE_CANDIDATE];
+	}
+
+	candidate = TestCandidate(elecNum);
+	profile = (elecNum < 2) ? testProfile[elecNum] : 0;
+
+	return testLevel[candidate] + ((testScan & 1) ? -testNoise[profile][candidate] : testNoise[profile][candidate]);
+}
+
+/*****************************************************************************
+*
+* Function: uint32_t TestExpected(int32_t touchDelta, uint32_t profile)
+*
+* Description: Shortest candidate of the model reaching target SNR with the touch delta
+* 				scaled down by the candidate level, the longest candidate when none reaches it
+*
+*****************************************************************************/
+static uint32_t TestExpected(int32_t touchDelta, uint32_t profile)
+{
+	uint32_t  candidate;
+	int32_t   candidateDelta;
+
+	for (candidate = 0; candidate < NUMBER_OF_TIMING_TUNE_CANDIDATES; candidate++)
+	{
+		candidateDelta = touchDelta;
+		if (testLevel[candidate] < testLevel[TIMING_TUNE_REFERENCE_CANDIDATE])
+		{
+			candidateDelta = touchDelta * testLevel[candidate] / testLevel[TIMING_TUNE_REFERENCE_CANDIDATE];
+		}
+		if (2 * testNoise[profile][candidate] * TIMING_TUNE_TARGET_SNR <= candidateDelta)
+		{
+			return candidate;
+		}
+	}
+
+	return NUMBER_OF_TIMING_TUNE_CANDIDATES - 1;
+}
+
+/*****************************************************************************
+*
+* Function: void TestTuneRun(tTestTune *tunePtr)
+*
+* Description: Startup as in main(), scans until acquisition timing auto-tuning done
+*
+*****************************************************************************/
+static void TestTuneRun(tTestTune *tunePtr)
+{
+	uint32_t  elecNum;
+
+	HostTouchSenseInit();
+
+	for (testScan = 0; testScan < TEST_SCANS_MAX; testScan++)
+	{
+		if (electrodesStatus.bit.timingTuneDone == YES)
+		{
+			break;
+		}
+		HostTouchSensePeriods(1);
+	}
+
+	tunePtr->scans = testScan;
+	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+	{
+		tunePtr->touchDelta[elecNum] = elecData[elecNum].detectorThresholdTouchDelta;
+		tunePtr->candidate[elecNum] = elecTimingTuneResult[elecNum];
+		tunePtr->chargeDistributionPeriod[elecNum] = elecData[elecNum].elecChargeDistributionPeriod;
+		tunePtr->adcSampleTime[elecNum] = elecData[elecNum].elecAdcSampleTime;
+	}
+}
+
+/*****************************************************************************
+*
+* Function: void TestTune(uint32_t profile0, uint32_t profile1, tTestTune *tunePtr)
+*
+* Description: Auto-tuning in a child process, firmware started from reset
+*
+*****************************************************************************/
+static void TestTune(uint32_t profile0, uint32_t profile1, tTestTune *tunePtr)
+{
+	int  pipeFd[2];
+
+	memset(tunePtr, 0, sizeof(*tunePtr));
+	testProfile[0] = profile0;
+	testProfile[1] = profile1;
+	if (pipe(pipeFd) != 0)
+	{
+		return;
+	}
+	if (fork() == 0)
+	{
+		TestTuneRun(tunePtr);
+		write(pipeFd[1], tunePtr, sizeof(*tunePtr));
+		_exit(0);
+	}
+	read(pipeFd[0], tunePtr, sizeof(*tunePtr));
+	wait(0);
+	close(pipeFd[0]);
+	close(pipeFd[1]);
+}
+
+/*****************************************************************************
+*
+* Function: void TestTuneCheck(uint32_t profile0, uint32_t profile1)
+*
+* Description: Auto-tuning of electrodes 0 and 1 with the noise profiles, candidates
+* 				against the expected ones
+*
+*****************************************************************************/
+static void TestTuneCheck(uint32_t profile0, uint32_t profile1)
+{
+	const uint32_t  profile[2] = {profile0, profile1};
+	tTestTune  tune;
+	uint32_t   elecNum, expected;
+
+	TestTune(profile0, profile1, &tune);
+	TEST_CHECK(tune.scans == NUMBER_OF_TIMING_TUNE_CANDIDATES * NUMBER_OF_TIMING_TUNE_SCANS);
+
+	for (elecNum = 0; elecNum < 2; elecNum++)
+	{
+		expected = TestExpected(tune.touchDelta[elecNum], profile[elecNum]);
+		printf("  electrode %u %-10s  candidate %u (CDP %2u, sample time %2u), expected %u\n", elecNum, testProfileName[profile[elecNum]], \
+				tune.candidate[elecNum], tune.chargeDistributionPeriod[elecNum], tune.adcSampleTime[elecNum], expected);
+
+		TEST_CHECK(tune.candidate[elecNum] == expected);
+		TEST_CHECK(tune.chargeDistributionPeriod[elecNum] == timingTuneChargeDistributionPeriod[expected]);
+		TEST_CHECK(tune.adcSampleTime[elecNum] == timingTuneAdcSampleTime[expected]);
+	}
+}
+
+int main(void)
+{
+	hostAdcModel = TestAdcModel;
+
+	printf("test_timing_tune: %u candidates x %u scans, target SNR %u, touch threshold %d LSB\n", NUMBER_OF_TIMING_TUNE_CANDIDATES, \
+			NUMBER_OF_TIMING_TUNE_SCANS, TIMING_TUNE_TARGET_SNR, ELEC_TOUCH_THRESHOLD_DELTA);
+
+	// Quiet electrode - the shortest candidate, noisy electrode - longer candidate reaching target with the scaled delta
+	TestTuneCheck(0, 1);
+	// Too noisy for all candidates - the longest candidate
+	TestTuneCheck(2, 0);
+
+	return HostTestResult("test_timing_tune");
+}
@@ -0,0 +1,218 @@
+/****************************************************************************//*!
+*
+* @file     test_touch_process.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Electrode record benchmark - ElectrodeTouchProcess() time and host cycles per
+*           scan and per electrode, electrode record size and cache lines the per-scan
+*           pipeline touches in one record
+*
+* @note     7 pad keypad without wake-up electrode. Raw data of the scans (noise, touches
+*           of the electrodes in turn) computed before the timed loop. Host time shows the
+*           pipeline cost only, not the S32K144 bus and LMEM cache, host cycles of the
+*           x86 time stamp counter (0 on other hosts). A full ElectrodeTouchElecSense()
+*           pass is not timed, the register model traps of the acquisition take most of
+*           its host time. Record size and
+*           offsets are the target ones (no pointers in tElecData).
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <math.h>
+#include <stddef.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "host_test.h"
+#include "S32K144.h"
+#include "main.h"
+#include "ts_cfg.h"
+#include "ets.h"
+#include "filter.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+// Untouched electrode level, white noise RMS, touch delta [12-bit LSB]
+#define TEST_ELECTRODE_LEVEL    2000
+#define TEST_NOISE              2.0
+#define TEST_TOUCH_DELTA        60
+// Scans of the raw data table, touch of one electrode within TEST_TOUCH_CYCLE scans
+#define TEST_TABLE_SCANS        4096
+#define TEST_TOUCH_CYCLE        512
+#define TEST_TOUCH_SCANS        128
+// Timed scans, best of the repeats
+#define TEST_SCANS              1000000
+#define TEST_REPEATS            5
+// S32K144 LMEM cache line [bytes]
+#define TEST_CACHE_LINE         16
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+extern tElecData  elecData[NUMBER_OF_ELECTRODES];
+
+// Raw data of the scans
+static int32_t  testRawData[TEST_TABLE_SCANS][NUMBER_OF_TOUCH_ELECTRODES];
+
+/*****************************************************************************
+*
+* Function: int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+*
+* Description: Electrode level with white noise
+*
+*****************************************************************************/
+static int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+{
+	(void)adcNum;
+	(void)channel;
+
+	return (int32_t)lround(TEST_ELECTRODE_LEVEL + TEST_NOISE * HostGauss());
+}
+
+/*****************************************************************************
+*
+* Function: double TestTime(void)
+*
+* Description: Monotonic time [ns]
+*
+*****************************************************************************/
+static double TestTime(void)
+{
+	struct timespec  time;
+
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+/*****************************************************************************
+*
+* Function: uint64_t TestCycles(void)
+*
+* Description: Host time stamp counter [cycles], 0 if none
+*
+*****************************************************************************/
+static uint64_t TestCycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+/*****************************************************************************
+*
+* Function: void TestScans(uint32_t scansNum, uint32_t *touchScansPtr)
+*
+* Description: Raw data of the table to the electrode records, ElectrodeTouchProcess()
+* 				of every scan, scans with a touch reported
+*
+*****************************************************************************/
+static void TestScans(uint32_t scansNum, uint32_t *touchScansPtr)
+{
+	uint32_t  scanNum, elecNum;
+	tSenseCtx  senseCtx;
+
+	for (scanNum = 0; scanNum < scansNum; scanNum++)
+	{
+		for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+		{
+			elecData[elecNum].adcDataElectrodeDischargeRaw[0] = testRawData[scanNum % TEST_TABLE_SCANS][elecNum];
+		}
+		senseCtx.elecDataPtr = elecData;
+		senseCtx.scanMask = ELEC_SCAN_MASK_ALL;
+		senseCtx.frequencyID = 0;
+		ElectrodeTouchProcess(&senseCtx);
+
+		for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+		{
+			if (elecData[elecNum].electrodeTouch[0] == YES)
+			{
+				(*touchScansPtr)++;
+				break;
+			}
+		}
+	}
+}
+
+int main(void)
+{
+	uint32_t  scanNum, elecNum, repeatNum, touchScans, accesses, hotLines;
+	size_t    hotStart, hotEnd;
+	double    timeStart, time, timeBest;
+	uint64_t  cyclesStart, cycles, cyclesBest;
+
+	hostAdcModel = TestAdcModel;
+	HostTouchSenseInit();
+	TEST_CHECK(HostTouchSenseSelfTrim(5000) < 5000);
+
+	// Raw data of the scans, electrodes touched in turn
+	HostRandomSeed(1);
+	for (scanNum = 0; scanNum < TEST_TABLE_SCANS; scanNum++)
+	{
+		for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+		{
+			testRawData[scanNum][elecNum] = (int32_t)lround(elecData[elecNum].DCTrackerDataBuffer + TEST_NOISE * HostGauss() - \
+					((((scanNum / TEST_TOUCH_CYCLE) % NUMBER_OF_TOUCH_ELECTRODES) == elecNum) && ((scanNum % TEST_TOUCH_CYCLE) < TEST_TOUCH_SCANS) ? TEST_TOUCH_DELTA : 0));
+		}
+	}
+
+	// Pipeline without peripheral registers, touches detected
+	touchScans = 0;
+	HostRegTraceStart();
+	TestScans(TEST_TABLE_SCANS, &touchScans);
+	HostRegTraceStop();
+	accesses = HostRegTraceCount(HOST_PERIPH_BASE, HOST_PERIPH_SIZE, NO) + HostRegTraceCount(HOST_PERIPH_BASE, HOST_PERIPH_SIZE, YES);
+	TEST_CHECK(accesses == 0);
+	TEST_CHECK(touchScans > 0);
+
+	// Best of the repeats
+	timeBest = 0;
+	cyclesBest = 0;
+	for (repeatNum = 0; repeatNum < TEST_REPEATS; repeatNum++)
+	{
+		touchScans = 0;
+		timeStart = TestTime();
+		cyclesStart = TestCycles();
+		TestScans(TEST_SCANS, &touchScans);
+		cycles = TestCycles() - cyclesStart;
+		time = TestTime() - timeStart;
+		if ((repeatNum == 0) || (time < timeBest))
+		{
+			timeBest = time;
+		}
+		if ((repeatNum == 0) || (cycles < cyclesBest))
+		{
+			cyclesBest = cycles;
+		}
+	}
+
+	// Record span of the per-scan pipeline (raw data to touch flags)
+	hotStart = offsetof(tElecData, adcDataElectrodeDischargeRaw);
+	hotEnd = offsetof(tElecData, electrodeTouch) + sizeof(elecData[0].electrodeTouch);
+	hotLines = (uint32_t)((hotEnd - 1) / TEST_CACHE_LINE - hotStart / TEST_CACHE_LINE + 1);
+
+	printf("test_touch_process: %u touch button electrodes, %u scans (best of %u)\n", NUMBER_OF_TOUCH_ELECTRODES, TEST_SCANS, TEST_REPEATS);
+	printf("  ElectrodeTouchProcess()      %8.1f ns per scan, %.1f ns per electrode\n", timeBest / TEST_SCANS, \
+			timeBest / TEST_SCANS / NUMBER_OF_TOUCH_ELECTRODES);
+	printf("  ElectrodeTouchProcess()      %8.1f cycles per scan, %.1f cycles per electrode\n", (double)cyclesBest / TEST_SCANS, \
+			(double)cyclesBest / TEST_SCANS / NUMBER_OF_TOUCH_ELECTRODES);
+	printf("  scans with touch             %8u of %u\n", touchScans, TEST_SCANS);
+	printf("  tElecData                    %8u bytes, elecData[] %u bytes\n", (uint32_t)sizeof(tElecData), (uint32_t)sizeof(elecData));
+	printf("  pipeline span of a record    %8u bytes (offset %u..%u), %u lines of %u bytes\n", (uint32_t)(hotEnd - hotStart), \
+			(uint32_t)hotStart, (uint32_t)hotEnd, hotLines, TEST_CACHE_LINE);
+
+	// Touches detected about the touched scans share
+	TEST_CHECK(fabs((double)touchScans / TEST_SCANS - (double)TEST_TOUCH_SCANS / TEST_TOUCH_CYCLE) < 0.02);
+	// Pipeline state of one electrode contiguous in its record, the fewest cache lines of the span
+	TEST_CHECK(hotLines <= (hotEnd - hotStart + TEST_CACHE_LINE - 1) / TEST_CACHE_LINE + 1);
+
+	return HostTestResult("test_touch_process");
+}
@@ -0,0 +1,265 @@
+/****************************************************************************//*!
+*
+* @file     test_warm_start.c
+*
+* @version  1.0.0.0
+*
+* @date     October-2026
+*
+* @brief    Warm start snapshot in the emulated FlexNVM data flash - save after cold start,
+*           check and restore at the next startup, erased, torn, corrupted, stale and
+*           configuration changed snapshots
+*
+* @note     Every startup runs in its own process (RAM from reset), the data flash sector
+*           of the snapshot is passed back to the test and kept for the next startup.
+*           Startup time is the self-trim (sensing periods and ADC conversions until done).
+*
+*******************************************************************************/
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "host_test.h"
+#include "S32K144.h"
+#include "main.h"
+#include "ts_cfg.h"
+#include "ets.h"
+#include "adc.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+// Electrodes level, white noise RMS [12-bit LSB]
+#define TEST_ELECTRODE_LEVEL    2000
+#define TEST_NOISE              2.0
+// Baseline move of the stale snapshot startup [12-bit LSB], over half the touch threshold
+#define TEST_BASELINE_MOVE      20
+// ADC0 gain loaded from the snapshot (calibration result of the host ADC model is 0x2F0)
+#define TEST_SNAPSHOT_GAIN      0x123
+
+/*******************************************************************************
+* Variables
+*******************************************************************************/
+extern uint8_t   warmStartValid;
+extern volatile uint8_t  warmStartSaveRequest;
+extern int16_t   calibrationGainADC0, calibrationGainADC1;
+extern tElecData  elecData[NUMBER_OF_ELECTRODES];
+
+// Startup result - warm start, self-trim periods and conversions, snapshot store requested,
+// data flash erases and phrases programmed, ADC0 gain, electrode 0 baseline
+typedef struct
+{
+	uint8_t   warmStart;
+	uint32_t  selfTrimPeriods;
+	uint32_t  selfTrimConversions;
+	uint8_t   saveRequest;
+	uint32_t  erases;
+	uint32_t  phrases;
+	int16_t   gain;
+	int32_t   baseline;
+}
+tTestStartup;
+
+// Electrodes level of the startup
+static double  testLevel = TEST_ELECTRODE_LEVEL;
+
+// Snapshot in the data flash
+static tWarmStartImage  *const testSnapshotPtr = (tWarmStartImage *)WARM_START_DFLASH_ADDRESS;
+
+/*****************************************************************************
+*
+* Function: int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+*
+* Description: Electrodes level with white noise
+*
+*****************************************************************************/
+static int32_t TestAdcModel(uint32_t adcNum, uint32_t channel)
+{
+	(void)adcNum;
+	(void)channel;
+
+	return (int32_t)lround(testLevel + TEST_NOISE * HostGauss());
+}
+
+/*****************************************************************************
+*
+* Function: void TestStartupRun(tTestStartup *startupPtr)
+*
+* Description: Startup as in main() - ADC calibration or warm start restore, self-trim,
+* 				snapshot store from the main loop when requested
+*
+*****************************************************************************/
+static void TestStartupRun(tTestStartup *startupPtr)
+{
+	// ADC calibration registers from reset
+	HostRegWrite(ADC0_BASE + offsetof(ADC_Type, G), 0);
+	HostRegWrite(ADC1_BASE + offsetof(ADC_Type, G), 0);
+
+	HostTouchSenseInit();
+	startupPtr->warmStart = warmStartValid;
+	startupPtr->gain = calibrationGainADC0;
+
+	hostAdcConversions[0] = hostAdcConversions[1] = 0;
+	startupPtr->selfTrimPeriods = HostTouchSenseSelfTrim(5000);
+	startupPtr->selfTrimConversions = hostAdcConversions[0] + hostAdcConversions[1];
+	startupPtr->saveRequest = warmStartSaveRequest;
+	startupPtr->baseline = elecData[0].DCTrackerDataBuffer;
+
+	// Main loop - store the snapshot
+	hostFlashErases = hostFlashPhrases = 0;
+	if (warmStartSaveRequest == YES)
+	{
+		ElectrodeWarmStartSave();
+	}
+	startupPtr->erases = hostFlashErases;
+	startupPtr->phrases = hostFlashPhrases;
+}
+
+/*****************************************************************************
+*
+* Function: void TestStartup(const char *name, tTestStartup *startupPtr)
+*
+* Description: Startup in a child process, data flash sector of the snapshot kept
+*
+*****************************************************************************/
+static void TestStartup(const char *name, tTestStartup *startupPtr)
+{
+	uint8_t   buffer[sizeof(tTestStartup) + HOST_DFLASH_SECTOR];
+	uint32_t  bufferNum;
+	ssize_t   readNum;
+	int  pipeFd[2];
+
+	memset(startupPtr, 0, sizeof(*startupPtr));
+	if (pipe(pipeFd) != 0)
+	{
+		return;
+	}
+	if (fork() == 0)
+	{
+		TestStartupRun(startupPtr);
+		memcpy(buffer, startupPtr, sizeof(tTestStartup));
+		memcpy(buffer + sizeof(tTestStartup), (void *)(uintptr_t)WARM_START_DFLASH_ADDRESS, HOST_DFLASH_SECTOR);
+		write(pipeFd[1], buffer, sizeof(buffer));
+		_exit(0);
+	}
+
+	bufferNum = 0;
+	while (bufferNum < sizeof(buffer))
+	{
+		readNum = read(pipeFd[0], buffer + bufferNum, sizeof(buffer) - bufferNum);
+		if (readNum <= 0)
+		{
+			break;
+		}
+		bufferNum += readNum;
+	}
+	wait(0);
+	close(pipeFd[0]);
+	close(pipeFd[1]);
+
+	TEST_CHECK(bufferNum == sizeof(buffer));
+	memcpy(startupPtr, buffer, sizeof(tTestStartup));
+	memcpy((void *)(uintptr_t)WARM_START_DFLASH_ADDRESS, buffer + sizeof(tTestStartup), HOST_DFLASH_SECTOR);
+
+	printf("  %-34s %5s %8u %12u %6s %7u %8u  0x%03X\n", name, startupPtr->warmStart ? "warm" : "cold", startupPtr->selfTrimPeriods, \
+			startupPtr->selfTrimConversions, startupPtr->saveRequest ? "yes" : "no", startupPtr->erases, startupPtr->phrases, startupPtr->gain);
+}
+
+/*****************************************************************************
+*
+* Function: void TestSnapshotChecksum(void)
+*
+* Description: Checksum of the snapshot in the data flash after a test change, same rotate
+* 				and add as the firmware
+*
+*****************************************************************************/
+static void TestSnapshotChecksum(void)
+{
+	uint32_t  checksum = 0, wordNum;
+
+	for (wordNum = 0; wordNum < WARM_START_CHECKSUM_WORDS; wordNum++)
+	{
+		checksum = ((checksum << 1) | (checksum >> 31)) + testSnapshotPtr->word[wordNum];
+	}
+	testSnapshotPtr->data.checksum = checksum;
+}
+
+int main(void)
+{
+	tTestStartup  cold, warm, startup;
+	tWarmStartImage  snapshot;
+	uint32_t  phrasesNum;
+
+	hostAdcModel = TestAdcModel;
+	phrasesNum = sizeof(snapshot.word) / 8;
+
+	printf("test_warm_start: snapshot %u bytes, %u phrases\n", (uint32_t)sizeof(tWarmStart), phrasesNum);
+	printf("  %-34s %5s %8s %12s %6s %7s %8s  %5s\n", "startup", "start", "periods", "conversions", "store", "erases", "phrases", "gain");
+
+	// Erased flash - cold start, snapshot stored
+	HostFlashErase();
+	TestStartup("erased flash", &cold);
+	TEST_CHECK(cold.warmStart == NO);
+	TEST_CHECK(cold.saveRequest == YES);
+	TEST_CHECK((cold.erases == 1) && (cold.phrases == phrasesNum));
+	TEST_CHECK(testSnapshotPtr->data.signature == WARM_START_SIGNATURE);
+	memcpy(&snapshot, testSnapshotPtr, sizeof(snapshot));
+
+	// Valid snapshot - warm start, short self-trim, no store
+	TestStartup("valid snapshot", &warm);
+	TEST_CHECK(warm.warmStart == YES);
+	TEST_CHECK(warm.selfTrimConversions < cold.selfTrimConversions);
+	TEST_CHECK(warm.saveRequest == NO);
+	TEST_CHECK(warm.erases == 0);
+	TEST_CHECK(warm.gain == cold.gain);
+	TEST_CHECK(memcmp(&snapshot, testSnapshotPtr, sizeof(snapshot)) == 0);
+
+	// ADC calibration from the snapshot, not calibrated again
+	testSnapshotPtr->data.adcCal[0].G = TEST_SNAPSHOT_GAIN;
+	TestSnapshotChecksum();
+	TestStartup("snapshot ADC0 gain 0x123", &startup);
+	TEST_CHECK((startup.warmStart == YES) && (startup.gain == TEST_SNAPSHOT_GAIN));
+	memcpy(testSnapshotPtr, &snapshot, sizeof(snapshot));
+
+	// Corrupted bit - checksum fails, cold start, snapshot stored again
+	testSnapshotPtr->data.adcCal[1].CLP0 ^= 0x4;
+	TestStartup("corrupted bit", &startup);
+	TEST_CHECK((startup.warmStart == NO) && (startup.saveRequest == YES) && (startup.erases == 1));
+	TEST_CHECK(startup.gain == cold.gain);
+
+	// Configuration changed - checksum valid, thresholds differ, cold start
+	testSnapshotPtr->data.elec[0].detectorThresholdTouchDelta++;
+	TestSnapshotChecksum();
+	TestStartup("touch threshold changed", &startup);
+	TEST_CHECK((startup.warmStart == NO) && (startup.saveRequest == YES) && (startup.erases == 1));
+	TEST_CHECK(startup.selfTrimConversions == cold.selfTrimConversions);
+
+	// Torn write - reset after half of the phrases, cold start at the next startup
+	HostFlashErase();
+	hostFlashPhraseLimit = phrasesNum / 2;
+	TestStartup("erased flash, torn store", &startup);
+	TEST_CHECK((startup.warmStart == NO) && (startup.phrases == phrasesNum / 2));
+	hostFlashPhraseLimit = -1;
+	TestStartup("torn snapshot", &startup);
+	TEST_CHECK((startup.warmStart == NO) && (startup.saveRequest == YES) && (startup.phrases == phrasesNum));
+	TestStartup("snapshot stored again", &startup);
+	TEST_CHECK(startup.warmStart == YES);
+
+	// Stale snapshot - baseline moved over half the touch threshold, warm start, stored again
+	testLevel = TEST_ELECTRODE_LEVEL + TEST_BASELINE_MOVE;
+	TestStartup("baseline moved +20", &startup);
+	TEST_CHECK((startup.warmStart == YES) && (startup.saveRequest == YES) && (startup.erases == 1));
+	TEST_CHECK(testSnapshotPtr->data.elec[0].DCTrackerDataBuffer == startup.baseline);
+	TestStartup("snapshot stored again", &startup);
+	TEST_CHECK((startup.warmStart == YES) && (startup.saveRequest == NO));
+
+	printf("  self-trim %u -> %u conversions (%u -> %u periods)\n", cold.selfTrimConversions, warm.selfTrimConversions, \
+			cold.selfTrimPeriods, warm.selfTrimPeriods);
+
+	return HostTestResult("test_warm_start");
+}
@@ -169,6 +169,15 @@
 	#endif
 #endif
 
+/*******************************************************************************
+* Modify: Keypad sensor group scan period in electrodes sensing cycles (TS_SENSOR_GROUPS)
+*         Touch button electrodes are scanned every KEYPAD_SCAN_PERIOD_IDLE sensing cycles
+*         while not touched, every KEYPAD_SCAN_PERIOD_ACTIVE sensing cycles while touched.
+*         Value from 1 to 255. DC tracker and IIR filter run once per group scan.
+******************************************************************************/
+#define KEYPAD_SCAN_PERIOD_IDLE     1
+#define KEYPAD_SCAN_PERIOD_ACTIVE   1
+
 /*******************************************************************************
 * Modify: Define filter parameters.
 *         Coefficients B0, B1 and A0 are dependent on filter cutoff frequency [Hz]
@@ -400,6 +409,8 @@
 	#define ELEC0_TOUCH_THRESHOLD_DELTA       ELEC_TOUCH_THRESHOLD_DELTA
 	// Electrode release threshold relative to DC tracker value
 	#define ELEC0_RELEASE_THRESHOLD_DELTA     ELEC_RELEASE_THRESHOLD_DELTA
+	// Neighbour electrodes scanned every period together with the touched electrode (bit per electrode)
+	#define ELEC0_ROI_NEIGHBOURS              (1 << 1)
 #endif
 
 /*******************************************************************************
@@ -410,6 +421,7 @@
 	#define ELEC1_LPFILTER_TYPE               FILTER_1
 	#define ELEC1_TOUCH_THRESHOLD_DELTA       ELEC_TOUCH_THRESHOLD_DELTA
 	#define ELEC1_RELEASE_THRESHOLD_DELTA     ELEC_RELEASE_THRESHOLD_DELTA
+	#define ELEC1_ROI_NEIGHBOURS              ((1 << 0) | (1 << 2))
 #endif
 
 /*******************************************************************************
@@ -420,6 +432,7 @@
 	#define ELEC2_LPFILTER_TYPE               FILTER_1
 	#define ELEC2_TOUCH_THRESHOLD_DELTA       ELEC_TOUCH_THRESHOLD_DELTA
 	#define ELEC2_RELEASE_THRESHOLD_DELTA     ELEC_RELEASE_THRESHOLD_DELTA
+	#define ELEC2_ROI_NEIGHBOURS              ((1 << 1) | (1 << 3))
 #endif
 
 /*******************************************************************************
@@ -430,6 +443,7 @@
 	#define ELEC3_LPFILTER_TYPE               FILTER_1
 	#define ELEC3_TOUCH_THRESHOLD_DELTA       ELEC_TOUCH_THRESHOLD_DELTA
 	#define ELEC3_RELEASE_THRESHOLD_DELTA     ELEC_RELEASE_THRESHOLD_DELTA
+	#define ELEC3_ROI_NEIGHBOURS              ((1 << 2) | (1 << 4))
 #endif
 
 /*******************************************************************************
@@ -440,6 +454,7 @@
 	#define ELEC4_LPFILTER_TYPE               FILTER_1
 	#define ELEC4_TOUCH_THRESHOLD_DELTA       ELEC_TOUCH_THRESHOLD_DELTA
 	#define ELEC4_RELEASE_THRESHOLD_DELTA     ELEC_RELEASE_THRESHOLD_DELTA
+	#define ELEC4_ROI_NEIGHBOURS              ((1 << 3) | (1 << 5))
 #endif
 
 /*******************************************************************************
@@ -450,6 +465,7 @@
 	#define ELEC5_LPFILTER_TYPE               FILTER_1
 	#define ELEC5_TOUCH_THRESHOLD_DELTA       ELEC_TOUCH_THRESHOLD_DELTA
 	#define ELEC5_RELEASE_THRESHOLD_DELTA     ELEC_RELEASE_THRESHOLD_DELTA
+	#define ELEC5_ROI_NEIGHBOURS              (1 << 4)
 #endif
 
 /*******************************************************************************
@@ -458,6 +474,7 @@
 #ifdef ELEC6
 	#define ELEC6_DCTRACKER_FILTER_FACTOR     5
 	#define ELEC6_LPFILTER_TYPE               FILTER_2
+	#define ELEC6_ROI_NEIGHBOURS              0
 
 	#if(TS_RAW_DATA_CALCULATION == AVERAGING)
 		// Electrode touch threshold relative to DC tracker value
@@ -526,6 +543,15 @@
 // Calculate number of samples, when module in active mode, max value 128
 #define NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_ACTIVE   (NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_MULTIPLY * NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_IDLE)
 
+/*******************************************************************************
+* Modify: Slider sensor group scan period in electrodes sensing cycles (TS_SENSOR_GROUPS)
+*         Slider electrodes are scanned every SLIDER_SCAN_PERIOD_IDLE sensing cycles
+*         while not touched, every SLIDER_SCAN_PERIOD_ACTIVE sensing cycles while touched.
+*         Value from 1 to 255.
+******************************************************************************/
+#define SLIDER_SCAN_PERIOD_IDLE     4
+#define SLIDER_SCAN_PERIOD_ACTIVE   1
+
 /*******************************************************************************
 * Modify: Slider Electrode 0 to 1 common defines
 ******************************************************************************/
@@ -163,10 +163,19 @@
 
 	#if (NUMBER_OF_USED_ADC_MODULES == 2 || NUMBER_OF_USED_ADC_MODULES == 1)
 		// YES (SLIDER_NOISE_CANCELING_ON) or NO (SLIDER_NOISE_CANCELING_OFF)
-		// Works only with averaging, does not work with oversampling
+		// Rejects the lowest and highest samples of the active sample burst, raw data are scaled to the full number of sensing cycles
 		#define SLIDER_NOISE_CANCELING SLIDER_NOISE_CANCELING_OFF
 	#endif
 
+	#if SLIDER_NOISE_CANCELING
+		// Number of rejected lowest and highest samples (0 to TRIM_ACC_REJECT_MAX)
+		#define SLIDER_SAMPLES_REJECT_LOW	1
+		#define SLIDER_SAMPLES_REJECT_HIGH	0
+	#else
+		#define SLIDER_SAMPLES_REJECT_LOW	0
+		#define SLIDER_SAMPLES_REJECT_HIGH	0
+	#endif
+
 	#if (NUMBER_OF_USED_ADC_MODULES == 2)
 		// ADC sample time adjustment
 		#define ADC_SAMPLE_TIME 14
@@ -207,6 +216,21 @@
 	#define SLIDER_ELEC1_PORT_MASK       (1 << SLIDER_ELEC1_ELEC_GPIO_PIN) | (1 << SLIDER_ELEC1_CEXT_GPIO_PIN)
 #endif
 
+/*******************************************************************************
+* Modify: Touch button electrodes dual ADC conversion
+******************************************************************************/
+// YES (DUAL_ADC_CONVERSION_ON) or NO (DUAL_ADC_CONVERSION_OFF) optional dual ADC conversion
+// If ON, each touch button electrode with Cext on ADC0 is paired with a touch button electrode with Cext on ADC1
+// and both electrodes of the pair are converted at the same time, electrodes left without pair are converted one by one
+#define DUAL_ADC_CONVERSION   DUAL_ADC_CONVERSION_ON
+
+#if DUAL_ADC_CONVERSION
+	#ifndef ADC_SAMPLE_TIME
+		// ADC sample time adjustment
+		#define ADC_SAMPLE_TIME 14
+	#endif
+#endif
+
 #endif
 
 #endif /* CFG_6PAD_SLIDER_6PAD_HW_H_ */
@@ -42,9 +42,255 @@
 /*******************************************************************************
 * Modify: Assembly optimization to avoid dependency on -O3 compilation optimization (1-ON, 0-OFF)
 * 		  Modify only if lower than -O3 optimization needed
+* 		  Touch button, simultaneous slider and slider guard conversions use a hand-scheduled
+* 		  kernel (ConversionKernelRun): charge distribution, delay, conversion start and
+* 		  redistribution in one assembly block, same timing at -O0, -Os and -O3.
+* 		  Charge distribution delay: (chargeDistributionPeriod + 1) loop iterations.
+* 		  Pipelined conversion keeps the C delay loop. Kernel instructions and window cycles
+* 		  are checked by host_test "make test_conv_kernel", a change of the kernel fails it.
 ******************************************************************************/
 #define TS_ASM_OPTIMIZE     0
 
+/*******************************************************************************
+* Modify: Pipelined conversion of touch button electrodes (1-ON, 0-OFF)
+* 		  Charge of the next electrode is distributed while Cext voltage
+* 		  of the previous electrode is converted by ADC. Only electrodes on different
+* 		  GPIO ports are pipelined, electrodes on the same port are converted one by one.
+* 		  Check the noise (DEBUG_SCAN_TIMING, raw data deviation) on the target before use.
+******************************************************************************/
+#define TS_PIPELINED_CONVERSION     0
+
+/*******************************************************************************
+* Modify: DMA acquisition of touch button electrodes (1-ON, 0-OFF)
+* 		  eDMA drives charge distribution, conversion start, charge redistribution
+* 		  and stores ADC results, CPU only waits for the end of the samples burst.
+* 		  Charge distribution delay is done by chargeDistributionPeriod DMA writes (min. 1).
+* 		  Sample rate jittering (JITTERING_OPTION 2) is not applied.
+******************************************************************************/
+#define TS_DMA_ACQUISITION     0
+
+/*******************************************************************************
+* Modify: Acquisition timing auto-tuning during self-trim (1-ON, 0-OFF)
+* 		  Charge distribution period and ADC sample time are swept per electrode,
+* 		  the shortest setting with touch threshold delta at least
+* 		  TIMING_TUNE_TARGET_SNR times the raw data noise (peak-to-peak) is used.
+* 		  Touch threshold delta is scaled by the raw data level relative to the default
+* 		  timing (charge distribution period 0, ADC_SAMPLE_TIME_SW) it is set up with.
+* 		  Adds NUMBER_OF_TIMING_TUNE_CANDIDATES x NUMBER_OF_TIMING_TUNE_SCANS (36) scans
+* 		  before the self-trim on cold start.
+******************************************************************************/
+#define TS_TIMING_AUTOTUNE       0
+#define TIMING_TUNE_TARGET_SNR   5
+
+/*******************************************************************************
+* Modify: Self-trim convergence detection (1-ON, 0-OFF)
+* 		  Self-trim of touch button and slider electrodes ends once each electrode
+* 		  baseline (mean of the self-trim samples) standard error is at most its touch
+* 		  threshold delta / SELF_TRIM_TARGET_SNR, after SELF_TRIM_MIN_CYCLES and at
+* 		  the latest after NUMBER_OF_CYCLES_DCTRACKER_PWRUP self-trim cycles.
+* 		  Electrode drifting (power-up settling) more than touch threshold delta /
+* 		  SELF_TRIM_DRIFT_SNR over its samples restarts its samples from the latest one.
+* 		  Validate the baseline error on the board before use.
+******************************************************************************/
+#define TS_SELF_TRIM_CONVERGENCE   0
+#define SELF_TRIM_MIN_CYCLES       16
+#define SELF_TRIM_TARGET_SNR       20
+#define SELF_TRIM_DRIFT_SNR        5
+
+/*******************************************************************************
+* Modify: Trimmed mean of touch button electrode samples
+* 		  Number of rejected lowest and highest samples of each sample burst
+* 		  (0 to TRIM_ACC_REJECT_MAX), samples are accumulated during acquisition.
+* 		  Raw data are scaled to the full number of sensing cycles.
+******************************************************************************/
+#define ELEC_SAMPLES_REJECT_LOW     0
+#define ELEC_SAMPLES_REJECT_HIGH    0
+
+/*******************************************************************************
+* Modify: Noise-adaptive sensing cycles per sample of touch button electrodes (1-ON, 0-OFF)
+* 		  Each electrode raw data noise variance is measured while not touched, the number
+* 		  of sensing cycles is the lowest one with touch threshold delta at least
+* 		  ADAPTIVE_SENSING_TARGET_SNR times the noise (RMS), within
+* 		  ADAPTIVE_SENSING_MIN_CYCLES and the actual idle / active number of cycles.
+* 		  Raw data are scaled to the idle / active number of cycles, DC tracker
+* 		  and thresholds do not change with the per-electrode number of cycles.
+* 		  Changes raw data noise of every electrode, validate on the board before use.
+******************************************************************************/
+#define TS_ADAPTIVE_SENSING_CYCLES    0
+#define ADAPTIVE_SENSING_TARGET_SNR   8
+#define ADAPTIVE_SENSING_MIN_CYCLES   2
+
+/*******************************************************************************
+* Modify: Sequential early termination of touch button electrode sample bursts (1-ON, 0-OFF)
+* 		  After SEQUENTIAL_TEST_MIN_CYCLES sensing cycles, the burst stops as soon as the
+* 		  full burst raw data predicted from the samples taken is more than
+* 		  SEQUENTIAL_TEST_CONFIDENCE standard deviations above or below both touch and
+* 		  release thresholds. The interval includes the variance of the samples not taken,
+* 		  decision error rate stays at the full burst one. Raw data are scaled to the
+* 		  full number of sensing cycles. Applies to single electrode CPU conversion
+* 		  after self-trim, watch sequentialTestTerminations and sequentialTestCyclesSaved.
+* 		  Electrode pairs converted simultaneously on ADC0 and ADC1 (DUAL_ADC_CONVERSION) and
+* 		  DMA acquisition (TS_DMA_ACQUISITION) always take the full burst.
+******************************************************************************/
+#define TS_SEQUENTIAL_TERMINATION      0
+#define SEQUENTIAL_TEST_MIN_CYCLES     4
+#define SEQUENTIAL_TEST_CONFIDENCE     4
+
+/*******************************************************************************
+* Modify: ADC conversion complete wait
+* 		  ADC_WAIT_POLL - core polls conversion complete flag in RUN mode
+* 		  ADC_WAIT_SLEEP - core sleeps (WFE) until ADC conversion complete interrupt
+* 		                   is pending, ADC interrupt is not enabled in NVIC, no ISR
+* 		  To compare both options, define DEBUG_SCAN_TIMING and watch
+* 		  scanTimingWaitCycles, scanTimingWaitPercent and scanTimingWakeups.
+* 		  Core current in WAIT mode is well below RUN mode at the same clock,
+* 		  the saving scales with scanTimingWaitPercent of the sensing ISR. Host tests
+* 		  test_adc_wait_poll and test_adc_wait estimate cycles and current of the waits.
+******************************************************************************/
+#define ADC_CONVERSION_WAIT     ADC_WAIT_POLL
+
+/*******************************************************************************
+* Modify: Wake-up (EGS) electrode ADC resolution while idle
+* 		  ADC_RESOLUTION_8BIT, ADC_RESOLUTION_10BIT or ADC_RESOLUTION_12BIT
+* 		  Idle EGS polling converts at reduced resolution (shorter conversion),
+* 		  12-bit is restored once EGS is touched (ElectrodeSensingCyclesChangeEGS).
+* 		  Samples are scaled to 12-bit range, so DC tracker, filters
+* 		  and thresholds stay valid when the resolution changes.
+* 		  Valid only if wake-up electrode is used.
+* 		  12-bit unless the board *_app.h defines it, check the EGS touch delta margin
+* 		  at the reduced resolution on the board before opting in.
+******************************************************************************/
+#ifndef EGS_IDLE_ADC_RESOLUTION
+	#define EGS_IDLE_ADC_RESOLUTION   ADC_RESOLUTION_12BIT
+#endif
+
+/*******************************************************************************
+* Modify: Correlated double sampling of touch button electrodes (1-ON, 0-OFF)
+* 		  Each sensing cycle converts also the charged Cext reference level before
+* 		  redistribution and subtracts it from the redistributed Cext voltage,
+* 		  low frequency supply and ground noise is cancelled. Same SNR is reached with
+* 		  fewer NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE/IDLE, each cycle
+* 		  takes two conversions. Raw data are offset by ADC full scale.
+******************************************************************************/
+#define TS_CORRELATED_DOUBLE_SAMPLING   0
+
+/*******************************************************************************
+* Modify: Adaptive slew rate of the DC tracker (1-ON, 0-OFF)
+* 		  While the electrode is not touched, the DC tracker step doubles every
+* 		  DCTRACKER_SLEW_PERSISTENCE consecutive samples above the baseline (release
+* 		  direction), up to 2^DCTRACKER_SLEW_MAX_LOG2, and never steps over the input.
+* 		  Noise keeps the step at 1, a baseline left low after a release or an upward
+* 		  environmental step is recovered in tens of periods instead of thousands.
+* 		  Below the baseline (touch direction) the step stays 1, so held keys, hovering
+* 		  fingers, slow approaches and neighbour coupling are not absorbed faster.
+* 		  The wake-up (EGS) electrode DC tracker, not frozen while touched, keeps the
+* 		  fixed step. DC tracker of touch button and slider electrodes is frozen while touched.
+******************************************************************************/
+#define TS_DCTRACKER_ADAPTIVE_SLEW   0
+#define DCTRACKER_SLEW_PERSISTENCE   8
+#define DCTRACKER_SLEW_MAX_LOG2      10
+
+/*******************************************************************************
+* Modify: Temperature feed-forward baseline compensation (1-ON, 0-OFF)
+* 		  Every TEMP_COMP_PERIOD scans the on-chip temperature sensor is converted
+* 		  TEMP_SENSOR_SAMPLES times by ADC0. Each touch button electrode learns its baseline
+* 		  temperature coefficient from the baseline change over windows without touch,
+* 		  in which the temperature changed at least TEMP_COMP_WINDOW_DELTA (sum of
+* 		  conversions), filtered by 2^TEMP_COMP_LEARN_SHIFT. The coefficient times the
+* 		  temperature change is added to the DC tracker with every temperature sample,
+* 		  touch and release thresholds follow the baseline.
+******************************************************************************/
+#define TS_TEMP_COMPENSATION     0
+#define TEMP_COMP_PERIOD         32
+#define TEMP_SENSOR_SAMPLES      16
+#define TEMP_COMP_WINDOW_DELTA   32
+#define TEMP_COMP_LEARN_SHIFT    2
+
+/*******************************************************************************
+* Modify: Common-mode noise rejection of touch button electrodes (1-ON, 0-OFF)
+* 		  Every scan the median of the raw data to baseline deltas of the scanned,
+* 		  not touched touch button electrodes is subtracted from the raw data of all
+* 		  scanned electrodes before the DC tracker and IIR LP filter. Requires at least
+* 		  COMMON_MODE_MIN_ELECTRODES not touched electrodes, otherwise no correction.
+* 		  Conducted noise common to all electrodes is removed without filter latency,
+* 		  IIR filter cutoff frequency may be raised to shorten touch reaction time.
+******************************************************************************/
+#define TS_COMMON_MODE_REJECTION     0
+#define COMMON_MODE_MIN_ELECTRODES   3
+
+/*******************************************************************************
+* Modify: Warm start from the FlexNVM snapshot (1-ON, 0-OFF)
+* 		  After the first cold self-trim ADC0/ADC1 calibration, touch button electrodes
+* 		  acquisition timing, DC tracker shift, thresholds and baselines are stored with
+* 		  a checksum in the data flash sector at WARM_START_DFLASH_ADDRESS. With a valid
+* 		  snapshot the ADC calibration and timing auto-tuning are skipped and the self-trim
+* 		  takes WARM_START_SELF_TRIM_CYCLES scans. Snapshot is re-stored when a baseline
+* 		  moved more than half the touch threshold. FlexNVM must contain data flash.
+******************************************************************************/
+#define TS_WARM_START                  0
+#define WARM_START_DFLASH_ADDRESS      0x10000000
+#define WARM_START_SELF_TRIM_CYCLES    8
+
+/*******************************************************************************
+* Modify: Region-of-interest scan scheduling of touch button electrodes (1-ON, 0-OFF)
+* 		  While any touch button electrode is touched, the touched electrodes and their
+* 		  neighbours (ELECn_ROI_NEIGHBOURS) are scanned every period, the other electrodes
+* 		  in rotation once per ROI_BACKGROUND_SCAN_PERIODS periods, their DC tracker keeps
+* 		  updating on these scans. All electrodes are scanned while none touched.
+* 		  First touch of a background electrode is detected up to ROI_BACKGROUND_SCAN_PERIODS
+* 		  times later and its baseline tracks at 1/ROI_BACKGROUND_SCAN_PERIODS of the rate.
+******************************************************************************/
+#define TS_ROI_SCAN                   0
+#define ROI_BACKGROUND_SCAN_PERIODS   4
+
+/*******************************************************************************
+* Modify: Sensor groups with separate scan schedules (1-ON, 0-OFF)
+* 		  Touch button electrodes (keypad) and slider electrodes are independent sensor
+* 		  groups, each with its own sensing cycles per sample state, touch qualification
+* 		  and wake-up. One scheduler on LPTMR scans each group every KEYPAD/SLIDER_SCAN_PERIOD_IDLE
+* 		  LPTMR periods while the group is idle and every KEYPAD/SLIDER_SCAN_PERIOD_ACTIVE
+* 		  periods while it is active. No electrode is converted in periods with no group due.
+* 		  Limited to builds without the wake-up (EGS) electrode. The slider is on the 6pad
+* 		  board only, so set OPTIONAL_WAKE_UP_ELECTRODE WAKE_ELEC_NO in 6pad_hw.h first.
+* 		  The EGS wakes keypad and slider together and would override the group schedules.
+******************************************************************************/
+#define TS_SENSOR_GROUPS   0
+
+/*******************************************************************************
+* Modify: Deferred processing of the electrodes scan (1-ON, 0-OFF)
+* 		  LPTMR ISR only acquires raw data of all touch button and slider electrodes
+* 		  into one of two acquisition frames and pends PendSV. DC tracker, filters,
+* 		  touch detection and qualification, backlight control and FreeMASTER recorder
+* 		  run in PendSV at the lowest priority. With frequency hopping the second
+* 		  period/frequency scan is acquired in LPIT interrupt instead of LPIT busy-wait.
+* 		  A scan is dropped when its frame still waits for processing, watch acqFrameOverruns.
+* 		  Limited to builds without the wake-up (EGS) electrode: the 2pad EVB as shipped,
+* 		  the 6pad and 7pad keypads only with OPTIONAL_WAKE_UP_ELECTRODE WAKE_ELEC_NO in
+* 		  their *_hw.h. The EGS scan picks the electrodes to acquire from the processing
+* 		  result of the same scan, which deferred processing does not have yet.
+******************************************************************************/
+#define TS_DEFERRED_PROCESSING   0
+
+#if (TS_DMA_ACQUISITION && TS_PIPELINED_CONVERSION)
+#error Pipelined conversion is CPU driven, disable TS_PIPELINED_CONVERSION for DMA acquisition
+#endif
+
+#if (TS_DEFERRED_PROCESSING && (OPTIONAL_WAKE_UP_ELECTRODE == WAKE_ELEC_YES))
+#error TS_DEFERRED_PROCESSING is limited to builds without wake-up electrode, set OPTIONAL_WAKE_UP_ELECTRODE WAKE_ELEC_NO or disable TS_DEFERRED_PROCESSING
+#endif
+
+#if (TS_SENSOR_GROUPS && (OPTIONAL_WAKE_UP_ELECTRODE == WAKE_ELEC_YES))
+#error TS_SENSOR_GROUPS is limited to builds without wake-up electrode, set OPTIONAL_WAKE_UP_ELECTRODE WAKE_ELEC_NO or disable TS_SENSOR_GROUPS
+#endif
+
+#if (NUMBER_OF_ELECTRODES > 32)
+#error Electrode configuration table supports up to 32 electrodes (ELEC0 to ELEC31)
+#endif
+
+#if (TS_CORRELATED_DOUBLE_SAMPLING && (TS_PIPELINED_CONVERSION || TS_DMA_ACQUISITION || TS_ASM_OPTIMIZE))
+#error Correlated double sampling converts Cext before redistribution, disable TS_PIPELINED_CONVERSION, TS_DMA_ACQUISITION and TS_ASM_OPTIMIZE
+#endif
+
 /*******************************************************************************
 * Modify: If needed, configure debug pins. Uncomment required option.
 ******************************************************************************/
@@ -52,6 +298,12 @@
 //#define DEBUG_ELECTRODE_SENSE
 // Debug application algorithm
 //#define DEBUG_ALGORITHM
+// Measure electrodes scan time by DWT cycle counter (watch scanTiming variables in FreeMASTER)
+// scanTimingIrqMaskedCycles(Max) report the longest interrupts masked window of slider sensing
+// scanTimingProcessCycles(Max) report the deferred processing duration (TS_DEFERRED_PROCESSING)
+// startupTimingCycles reports main() entry to the first touch sense scan, startupTimingAdcCalCycles the ADC calibration
+// (DWT starts in main(), reset to main() - startup code, SystemInit, RAM init - is not included)
+//#define DEBUG_SCAN_TIMING
 
 // Defined?
 #ifdef DEBUG_ELECTRODE_SENSE
@@ -64,4 +64,23 @@
 #define DECIMATION_FILTER_ON   1
 #define DECIMATION_FILTER_OFF   0
 
+/*******************************************************************************
+* Do not modify! Dual ADC conversion defines
+******************************************************************************/
+#define DUAL_ADC_CONVERSION_ON   1
+#define DUAL_ADC_CONVERSION_OFF   0
+
+/*******************************************************************************
+* Do not modify! ADC conversion complete wait defines
+******************************************************************************/
+#define ADC_WAIT_POLL    0
+#define ADC_WAIT_SLEEP   1
+
+/*******************************************************************************
+* Do not modify! ADC conversion resolution defines
+******************************************************************************/
+#define ADC_RESOLUTION_8BIT    8
+#define ADC_RESOLUTION_10BIT   10
+#define ADC_RESOLUTION_12BIT   12
+
 #endif /* CFG_TS_CFG_DO_NOT_MODIFY_H_ */
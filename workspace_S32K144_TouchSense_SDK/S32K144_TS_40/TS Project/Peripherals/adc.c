@@ -25,6 +25,7 @@
 *******************************************************************************/
 extern int16_t calibrationGainADC0;
 extern int16_t calibrationGainADC1;
+extern uint8_t adcResolution;
 
 /*****************************************************************************
 *
@@ -37,6 +38,9 @@ extern int16_t calibrationGainADC1;
 *****************************************************************************/
 void ADC0_Init(uint32_t sampleTime, uint32_t avgSel, uint8_t clkMode)
 {
+	// Hardware averaging not used, averaging done in software
+	(void)avgSel;
+
 	// Configure ADC based on selected clock mode
 	switch (clkMode)
     {
@@ -68,6 +72,9 @@ void ADC0_Init(uint32_t sampleTime, uint32_t avgSel, uint8_t clkMode)
 *****************************************************************************/
 void ADC1_Init(uint32_t sampleTime, uint32_t avgSel, uint8_t clkMode)
 {
+	// Hardware averaging not used, averaging done in software
+	(void)avgSel;
+
 	// Configure ADC based on selected clock mode
 	switch (clkMode)
     {
@@ -88,7 +95,7 @@ void ADC1_Init(uint32_t sampleTime, uint32_t avgSel, uint8_t clkMode)
     }
 }
 
-#if (NUMBER_OF_USED_ADC_MODULES == 2)
+#if (NUMBER_OF_USED_ADC_MODULES == 2) || DUAL_ADC_CONVERSION
 /*****************************************************************************
  *
  * Function: void ADCs_simultaneous_HW_trigger_preset(void)
@@ -141,96 +148,107 @@ void ADCs_SetBackToSWtrigger(void)
 	ADC0->SC2 = 0x00000000;
 
 	// Reset the sample time (different conversion trigger moment in time)
-	ADC0->CFG2 = 14;
-	ADC1->CFG2 = 14;
+	ADC0->CFG2 = ADC_SAMPLE_TIME_SW;
+	ADC1->CFG2 = ADC_SAMPLE_TIME_SW;
 }
 
 /*****************************************************************************
 *
-* Function: int16_t ADC0_Calibration(void)
+* Function: void ADC_CalibrationStart(ADC_Type *adcPtr)
 *
-* Description: Init ADC0 calibration
+* Description: Start ADC calibration, ADC0 and ADC1 calibrate at the same time
 *
 *****************************************************************************/
-int16_t ADC0_Calibration(void){
-
+void ADC_CalibrationStart(ADC_Type *adcPtr)
+{
 	//ADC clock divided by 2 (48/2=24MHz)
-	ADC0->CFG1=0x00000024;
+	adcPtr->CFG1=0x00000024;
 
 	// Clear registers
-	ADC0->CLPS=0x00000000;
-	ADC0->CLP3=0x00000000;
-	ADC0->CLP2=0x00000000;
-	ADC0->CLP1=0x00000000;
-	ADC0->CLP0=0x00000000;
-	ADC0->CLPX=0x00000000;
-	ADC0->CLP9=0x00000000;
+	adcPtr->CLPS=0x00000000;
+	adcPtr->CLP3=0x00000000;
+	adcPtr->CLP2=0x00000000;
+	adcPtr->CLP1=0x00000000;
+	adcPtr->CLP0=0x00000000;
+	adcPtr->CLPX=0x00000000;
+	adcPtr->CLP9=0x00000000;
 
 	/*// Clear registers offset
-	ADC0->CLP0_OFS=0x00000000;
-	ADC0->CLP1_OFS=0x00000000;
-	ADC0->CLP2_OFS=0x00000000;
-	ADC0->CLP3_OFS=0x00000000;
-	ADC0->CLPX_OFS=0x00000000;
-	ADC0->CLP9_OFS=0x00000000;
-	ADC0->CLPS_OFS=0x00000000;*/
+	adcPtr->CLP0_OFS=0x00000000;
+	adcPtr->CLP1_OFS=0x00000000;
+	adcPtr->CLP2_OFS=0x00000000;
+	adcPtr->CLP3_OFS=0x00000000;
+	adcPtr->CLPX_OFS=0x00000000;
+	adcPtr->CLP9_OFS=0x00000000;
+	adcPtr->CLPS_OFS=0x00000000;*/
 
 	// Hardware averaging enable, 32 samples, start calibration
-	ADC0->SC3 = ADC_SC3_AVGE(1) | ADC_SC3_AVGS(3) | ADC_SC3_CAL(1);
+	adcPtr->SC3 = ADC_SC3_AVGE(1) | ADC_SC3_AVGS(3) | ADC_SC3_CAL(1);
+}
 
+/*****************************************************************************
+*
+* Function: int16_t ADC_CalibrationWait(ADC_Type *adcPtr)
+*
+* Description: Wait for ADC calibration complete
+*
+*****************************************************************************/
+int16_t ADC_CalibrationWait(ADC_Type *adcPtr)
+{
 	// Wait for conversion complete flag
-	while(ADC0->SC1[0] < 0x80)
+	while(adcPtr->SC1[0] < 0x80)
 	{}
 
 	// Hardware averaging off
-	ADC0->SC3 = ADC_SC3_AVGE(0) | ADC_SC3_AVGS(0);
+	adcPtr->SC3 = ADC_SC3_AVGE(0) | ADC_SC3_AVGS(0);
 
 	// Return the gain register value
-	return ADC0->G;
+	return adcPtr->G;
 }
 
 /*****************************************************************************
 *
-* Function: int16_t ADC1_Calibration(void)
+* Function: void ADC_CalibrationSave(ADC_Type *adcPtr, tAdcCal *calPtr)
 *
-* Description: Init ADC1 calibration
+* Description: Store ADC calibration result
 *
 *****************************************************************************/
-int16_t ADC1_Calibration(void){
+void ADC_CalibrationSave(ADC_Type *adcPtr, tAdcCal *calPtr)
+{
+	calPtr->G = adcPtr->G;
+	calPtr->CLPS = adcPtr->CLPS;
+	calPtr->CLP3 = adcPtr->CLP3;
+	calPtr->CLP2 = adcPtr->CLP2;
+	calPtr->CLP1 = adcPtr->CLP1;
+	calPtr->CLP0 = adcPtr->CLP0;
+	calPtr->CLPX = adcPtr->CLPX;
+	calPtr->CLP9 = adcPtr->CLP9;
+}
 
+/*****************************************************************************
+*
+* Function: int16_t ADC_CalibrationLoad(ADC_Type *adcPtr, const tAdcCal *calPtr)
+*
+* Description: Load stored ADC calibration result instead of running the calibration
+*
+*****************************************************************************/
+int16_t ADC_CalibrationLoad(ADC_Type *adcPtr, const tAdcCal *calPtr)
+{
 	//ADC clock divided by 2 (48/2=24MHz)
-	ADC1->CFG1=0x00000024;
-
-	// Clear registers
-	ADC1->CLPS=0x00000000;
-	ADC1->CLP3=0x00000000;
-	ADC1->CLP2=0x00000000;
-	ADC1->CLP1=0x00000000;
-	ADC1->CLP0=0x00000000;
-	ADC1->CLPX=0x00000000;
-	ADC1->CLP9=0x00000000;
-
-	/*// Clear registers offset
-	ADC1->CLP0_OFS=0x00000000;
-	ADC1->CLP1_OFS=0x00000000;
-	ADC1->CLP2_OFS=0x00000000;
-	ADC1->CLP3_OFS=0x00000000;
-	ADC1->CLPX_OFS=0x00000000;
-	ADC1->CLP9_OFS=0x00000000;
-	ADC1->CLPS_OFS=0x00000000;*/
-
-	// Hardware averaging enable, 32 samples, start calibration
-	ADC1->SC3 = ADC_SC3_AVGE(1) | ADC_SC3_AVGS(3) | ADC_SC3_CAL(1);
-
-	// Wait for conversion complete flag
-	while(ADC1->SC1[0] < 0x80)
-	{}
-
-	// Hardware averaging off
-	ADC1->SC3 = ADC_SC3_AVGE(0) | ADC_SC3_AVGS(0);
+	adcPtr->CFG1=0x00000024;
+
+	// Load calibration registers
+	adcPtr->CLPS = calPtr->CLPS;
+	adcPtr->CLP3 = calPtr->CLP3;
+	adcPtr->CLP2 = calPtr->CLP2;
+	adcPtr->CLP1 = calPtr->CLP1;
+	adcPtr->CLP0 = calPtr->CLP0;
+	adcPtr->CLPX = calPtr->CLPX;
+	adcPtr->CLP9 = calPtr->CLP9;
+	adcPtr->G = calPtr->G;
 
 	// Return the gain register value
-	return ADC1->G;
+	return adcPtr->G;
 }
 
 /*****************************************************************************
@@ -260,3 +278,89 @@ void SetADCsGain(void){
 
 	ADC1->G = calibrationGainADC1;
 }
+
+/*****************************************************************************
+*
+* Function: void ADCs_SleepWaitEnable(void)
+*
+* Description: Prepare core to sleep while waiting for ADC conversion complete
+*
+*****************************************************************************/
+void ADCs_SleepWaitEnable(void){
+
+	// Sleep (WAIT mode), not deep sleep (VLPS) while ADC converts
+	S32_SCB->SCR &= ~S32_SCB_SCR_SLEEPDEEP_MASK;
+
+	// Pending ADC interrupt wakes core from WFE, even if not enabled in NVIC
+	S32_SCB->SCR |= S32_SCB_SCR_SEVONPEND_MASK;
+}
+
+/*****************************************************************************
+*
+* Function: void ADCs_SleepWaitDisable(void)
+*
+* Description: Set core back to deep sleep for the low power mode
+*
+*****************************************************************************/
+void ADCs_SleepWaitDisable(void){
+
+	// Deep sleep (VLPS) on the next WFI
+	S32_SCB->SCR |= S32_SCB_SCR_SLEEPDEEP_MASK;
+}
+
+/*****************************************************************************
+*
+* Function: void ADCs_ResolutionSet(uint8_t resolution)
+*
+* Description: Set ADC0 and ADC1 conversion resolution (8, 10 or 12-bit)
+*
+*****************************************************************************/
+void ADCs_ResolutionSet(uint8_t resolution){
+
+	// ADC0 conversion mode
+	ADC0->CFG1 = (ADC0->CFG1 & ~ADC_CFG1_MODE_MASK) | ADC_CFG1_MODE(ADC_CFG1_MODE_RESOLUTION(resolution));
+
+	// ADC1 conversion mode
+	ADC1->CFG1 = (ADC1->CFG1 & ~ADC_CFG1_MODE_MASK) | ADC_CFG1_MODE(ADC_CFG1_MODE_RESOLUTION(resolution));
+
+	// Actual resolution, samples are scaled to 12-bit range
+	adcResolution = resolution;
+}
+
+/*****************************************************************************
+*
+* Function: int32_t ADC0_TempSensorConvert(uint32_t samplesNum)
+*
+* Input: Number of conversions
+*
+* Output: Sum of the on-chip temperature sensor conversions
+*
+* Description: Convert the on-chip temperature sensor with ADC0, SW trigger
+*
+*****************************************************************************/
+int32_t ADC0_TempSensorConvert(uint32_t samplesNum){
+
+	uint32_t sampleNum;
+	int32_t  temperatureSum = 0;
+
+	// Temperature sensor needs long sample time
+	ADC0->CFG2 = ADC_SAMPLE_TIME_TEMP_SENSOR;
+
+	for (sampleNum = 0; sampleNum < samplesNum; sampleNum++)
+	{
+		// Start conversion of the temperature sensor channel
+		ADC0->SC1[0] = ADC_SC1_ADCH(ADC_CH_TEMP_SENSOR);
+
+		// Wait for conversion complete flag
+		while(ADC0->SC1[0] < 0x80)
+		{}
+
+		// Add result, clear COCO flag
+		temperatureSum += ADC0->R[0];
+	}
+
+	// Back to default sample time
+	ADC0->CFG2 = ADC_SAMPLE_TIME_SW;
+
+	return temperatureSum;
+}
@@ -0,0 +1,45 @@
+/****************************************************************************//*!
+*
+* @file     flash.h
+*
+* @version  1.0.0.0
+*
+* @date     September-2017
+*
+* @brief    FlexNVM data flash routines header file
+*
+*******************************************************************************/
+#ifndef __FLASH_H
+#define __FLASH_H
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include "S32K144.h"
+#include "S32K144_features.h"
+
+/*******************************************************************************
+* FTFC commands
+******************************************************************************/
+#define FTFC_CMD_PROGRAM_PHRASE   0x07
+#define FTFC_CMD_ERASE_SECTOR     0x09
+
+/*******************************************************************************
+* FlexNVM address for FTFC commands (bit 23 selects FlexNVM), phrase size
+******************************************************************************/
+#define FTFC_DFLASH_CMD_ADDRESS(addr)   ((((uint32_t)(addr)) - FEATURE_FLS_DF_START_ADDRESS) | 0x00800000)
+#define FTFC_PHRASE_SIZE                FEATURE_FLS_DF_BLOCK_WRITE_UNIT_SIZE
+
+/*******************************************************************************
+* FTFC command result
+******************************************************************************/
+#define FLASH_OK      0
+#define FLASH_ERROR   1
+
+/*******************************************************************************
+* Function prototypes
+******************************************************************************/
+uint8_t FLASH_DFlashSectorErase(uint32_t address);
+uint8_t FLASH_DFlashProgram(uint32_t address, const uint32_t *dataPtr, uint32_t wordsNum);
+
+#endif /* __FLASH_H */
@@ -66,6 +66,11 @@ void PCC_Init(uint8_t clkMode)
     		PCC->PCCn[PCC_LPIT_INDEX] = 0xC3000000;		// enable clock, use FIRCDIV2 clock, no clock division
 #endif
 
+#if TS_DMA_ACQUISITION
+    	    // DMAMUX
+    	    PCC->PCCn[PCC_DMAMUX_INDEX] = PCC_PCCn_CGC_MASK;
+#endif
+
 #if(LOW_POWER_MODE == LPM_DISABLE)
     	    // LPUART1
     	    PCC->PCCn[PCC_PORTC_INDEX] = PCC_PCCn_CGC_MASK;
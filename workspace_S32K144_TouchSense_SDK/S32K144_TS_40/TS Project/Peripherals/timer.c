@@ -28,12 +28,12 @@
 // All electrodes status
 extern tElecStatus  electrodesStatus, sliderElectrodesStatus;
 
+// Electrodes processing state
+extern tElecData  elecData[NUMBER_OF_ELECTRODES];
 #if SLIDER_ENABLE
-extern int32_t sliderAdcDataElectrodeDischargeRaw[NUMBER_OF_SLIDER_ELECTRODES];
+extern tSliderElecData  sliderElecData[NUMBER_OF_SLIDER_ELECTRODES];
 #endif
 #ifdef WAKE_UP_ELECTRODE
-// Electrode touch
-extern uint8_t  electrodeTouch[NUMBER_OF_ELECTRODES][NUMBER_OF_HOPPING_FREQUENCIES];
 extern uint8_t  virtualEGSelectrodeTouch;
 #endif
 
@@ -53,15 +53,66 @@ extern uint16_t  backlightPWMDutyCycle;
 uint32_t backlightCounter;
 
 // Jittering
-extern int32_t adcDataElectrodeDischargeRaw[NUMBER_OF_ELECTRODES][NUMBER_OF_HOPPING_FREQUENCIES];
-#if SLIDER_ENABLE
-extern int32_t sliderAdcDataElectrodeDischargeRaw[NUMBER_OF_SLIDER_ELECTRODES];
-#endif
 int16_t jitterRead;
 
 // Frequency hopping
 extern uint8_t frequencyHoppingActivation, frequencyID;
 
+#ifdef DEBUG_SCAN_TIMING
+// Startup time from main() entry to the first touch sense scan after self-trim [core clock cycles],
+// reset to main() (startup code, SystemInit, RAM init) not included
+uint32_t startupTimingCycles;
+// Scan timing breakdown in core clock cycles: ISR duration, ISR peak duration, ADC conversion complete wait
+uint32_t scanTimingIsrCycles, scanTimingIsrCyclesMax, scanTimingWaitCycles;
+// Share of the ISR duration spent waiting for ADC conversion complete [%]
+uint32_t scanTimingWaitPercent;
+#if SLIDER_ENABLE
+// Longest interrupts masked window of slider sensing in the current scan and its peak [core clock cycles]
+uint32_t scanTimingIrqMaskedCycles, scanTimingIrqMaskedCyclesMax;
+#endif
+#if (ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP)
+// Core wake-ups while waiting for ADC conversion complete
+uint32_t scanTimingWakeups;
+#endif
+#if TS_DEFERRED_PROCESSING
+// Deferred processing duration (including preemption by acquisition) and its peak
+uint32_t scanTimingProcessCycles, scanTimingProcessCyclesMax;
+#endif
+#endif
+
+#if SLIDER_ENABLE
+// Slider electrodes scanned in the processed scan
+extern uint8_t  sliderScanned;
+#endif
+
+// Touch buttons and slider number of sensing cycles per sample (sensor groups active state)
+extern int16_t  numberOfElectrodeSensingCyclesPerSample;
+#if SLIDER_ENABLE
+extern int16_t  numberOfElectrodeSensingCyclesPerSampleSlider;
+#endif
+
+#if TS_SENSOR_GROUPS
+// Sensor groups scan schedule
+tSensorGroup  sensorGroup[NUMBER_OF_SENSOR_GROUPS] =
+{
+	{KEYPAD_SCAN_PERIOD_IDLE, KEYPAD_SCAN_PERIOD_ACTIVE, 1},
+#if SLIDER_ENABLE
+	{SLIDER_SCAN_PERIOD_IDLE, SLIDER_SCAN_PERIOD_ACTIVE, 1},
+#endif
+};
+#endif
+// Sensor groups scanned in the current electrodes sensing cycle (bit per group)
+uint8_t  sensorGroupsScan;
+
+#if TS_DEFERRED_PROCESSING
+// Acquisition frames (double buffer), frame being acquired, next frame to acquire and to process
+tAcqFrame  acqFrame[2];
+tAcqFrame  *acqFramePtr;
+uint8_t    acqFrameWrite, acqFrameRead;
+// Scans dropped, because the frame still waits for processing
+uint32_t   acqFrameOverruns;
+#endif
+
 /*****************************************************************************
  *
  * Function: void LPTMR0_Init(uint32_t timeout)
@@ -90,6 +141,26 @@ void LPTMR0_Init(uint32_t timeout)
  *****************************************************************************/
 void LPTMR0_IRQHandler(void)
 {
+#ifdef DEBUG_SCAN_TIMING
+	uint32_t isrStart = DWT_CYCCNT_REG;
+
+	// Reset conversion complete wait cycles
+	scanTimingWaitCycles = 0;
+#if SLIDER_ENABLE
+	// Reset interrupts masked window
+	scanTimingIrqMaskedCycles = 0;
+#endif
+#if (ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP)
+	// Reset wake-ups
+	scanTimingWakeups = 0;
+#endif
+#endif
+
+#if (ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP)
+	// Core sleeps while waiting for ADC conversion complete
+	ADCs_SleepWaitEnable();
+#endif
+
 #if(DECIMATION_FILTER != 1)
 	// Clear TCF LPTMR
 	//REG_RMW32(&LPTMR0->CSR, 1 << 7, 1 << 7);
@@ -98,24 +169,32 @@ void LPTMR0_IRQHandler(void)
 
 	// Electrodes self-trim done?
 #if SLIDER_ENABLE
-	if(electrodesStatus.bit.selfTrimDone == YES || sliderElectrodesStatus.bit.selfTrimDone == YES)
+	if(electrodesStatus.bit.selfTrimDone == YES && sliderElectrodesStatus.bit.selfTrimDone == YES)
 #else
 		if(electrodesStatus.bit.selfTrimDone == YES)
 #endif
 		{
+#ifdef DEBUG_SCAN_TIMING
+			// First touch sense scan?
+			if (startupTimingCycles == 0)
+			{
+				// Startup time
+				startupTimingCycles = isrStart;
+			}
+#endif
 
 #ifdef WAKE_UP_ELECTRODE
 			// Wake-up electrode touched?
-			if (electrodeTouch[WAKE_UP_ELECTRODE][frequencyID] == YES)
+			if (elecData[WAKE_UP_ELECTRODE].electrodeTouch[frequencyID] == YES)
 			{
 #if JITTERING
 #if (JITTERING_OPTION == 1)
 			#if ((REFERENCE_DESIGN_BOARD == S32K144_6PAD_KEYPAD_SLIDER) && (NUMBER_OF_ELECTRODES < 1))
 			// Jitter sample rate
-			Jitter(sliderAdcDataElectrodeDischargeRaw[0]);
+			Jitter(sliderElecData[0].adcDataElectrodeDischargeRaw[frequencyID]);
 			#else
 			// Jitter sample rate
-			Jitter(adcDataElectrodeDischargeRaw[0][frequencyID]);
+			Jitter(elecData[0].adcDataElectrodeDischargeRaw[frequencyID]);
 			#endif
 #endif
 #endif
@@ -127,9 +206,9 @@ void LPTMR0_IRQHandler(void)
 #if JITTERING
 #if (JITTERING_OPTION == 1)
 			#if ((REFERENCE_DESIGN_BOARD == S32K144_6PAD_KEYPAD_SLIDER) && (NUMBER_OF_ELECTRODES < 1))
-			Jitter(sliderAdcDataElectrodeDischargeRaw[0]);
+			Jitter(sliderElecData[0].adcDataElectrodeDischargeRaw[frequencyID]);
 			#else
-			Jitter(adcDataElectrodeDischargeRaw[WAKE_UP_ELECTRODE][frequencyID]);
+			Jitter(elecData[WAKE_UP_ELECTRODE].adcDataElectrodeDischargeRaw[frequencyID]);
 			#endif
 #endif
 #endif
@@ -167,235 +246,89 @@ void LPTMR0_IRQHandler(void)
 			}
 
 #endif
-			// Any electrode touched?
-#if SLIDER_ENABLE
-			if (electrodeTouchQualifiedReport == 1 || sliderElectrodeTouchQualifiedReport == 1)
-#else
-				if (electrodeTouchQualifiedReport == 1)
-#endif
-				{
-					// MCU in RUN mode only
-					lowPowerModeCtrl = OFF;
-
-					// Turn ON backlight?
-					if(backlightCounter == 0)
-					{
-						// Reset FTM 2 counter
-						FTM2->CNT = 0;
-						// Load PWM duty cycle
-						LoadBacklightPWMDutyCycle(backlightPWMDutyCycle);
-						// Load counter period to keep backlight ON
-						backlightCounter = KEYPAD_BACKLIGHT_ON_PERIOD;
-					}
-
-					// Load counter to keep backlight ON?
-					if(backlightCounter != 100)
-					{
-						// Load counter period to keep backlight ON
-						backlightCounter = KEYPAD_BACKLIGHT_ON_PERIOD;
-					}
-				}
-				else
-				{
-					// Act upon backlightCounter value
-					switch(backlightCounter)
-					{
-					case 0:
-					{	// Default: no action
-						break;
-					}
-					case 1:
-					{
-						// MCU enters the low power mode with periodical wake-up by LPTMR
-						lowPowerModeCtrl = ON;
-						// Reset counter
-						backlightCounter = 0;
-
-						break;
-					}
-					case 2:
-					{
-						// Turn OFF backlight
-						LoadBacklightPWMDutyCycle(0);
-						// Load counter value
-						backlightCounter = 1;
-
-						break;
-					}
-					default:
-					{
-						// Keyboard backlight ON?
-						if (backlightCounter > 2)
-						{
-							// Decrement counter
-							backlightCounter--;
-						}
-
-						break;
-					}
-					}
-				}
+			// Keypad backlight and low power mode control
+			BacklightCtrl();
 
 #else // EGS not used
 #if JITTERING
 #if (JITTERING_OPTION == 1)
 			#if ((REFERENCE_DESIGN_BOARD == S32K144_6PAD_KEYPAD_SLIDER) && (NUMBER_OF_ELECTRODES < 1))
 			// Jitter sample rate
-			Jitter(sliderAdcDataElectrodeDischargeRaw[0]);
+			Jitter(sliderElecData[0].adcDataElectrodeDischargeRaw[frequencyID]);
 			#else
 			// Jitter sample rate
-			Jitter(adcDataElectrodeDischargeRaw[0][frequencyID]);
+			Jitter(elecData[0].adcDataElectrodeDischargeRaw[frequencyID]);
 			#endif
 #endif
 #endif
-			// Sense touch buttons electrodes touch event
-			ElectrodeTouchElecSense();
+			// Sensor groups due in this electrodes sensing cycle
+			sensorGroupsScan = SensorGroupsSchedule();
 
-#if SLIDER_ENABLE
-#if (NUMBER_OF_USED_ADC_MODULES == 2)
-			// Preset configuration for both ADC0 and ADC1 for voltage digitalization at the same time
-			ADCs_SimultaneousHWtrigger();
-			// Sense electrode touch event at slider electrodes
-			SliderElectrodesTouchElecSense();
-			// Reset configuration for both ADC0 and ADC1 for voltage digitalization one by one
-			ADCs_SetBackToSWtrigger();
-#else
-			// Sense electrode touch event at slider electrodes
-			SliderElectrodesTouchElecSense();
-#endif
-#endif
-
-#if FREQUENCY_HOPPING
-			// Change the frequency ID
-			FrequencyHop();
-
-			if(frequencyHoppingActivation == 1)
+#if TS_DEFERRED_PROCESSING
+			// Any sensor group due?
+			if (sensorGroupsScan != 0)
 			{
-				//If LPIT disabled (after power-up/wakeup), enable LPIT
-				if((LPIT0->TMR[0].TCTRL & LPIT_TMR_TCTRL_T_EN_MASK) == 0)
-				{
-					//Enable LPIT
-					LPIT_Enable();
-				}
-
-				// Wait for LPIT to timeout
-				while (0 == (LPIT0->MSR & LPIT_MSR_TIF0_MASK)) {}
+				// Acquire touch button and slider electrodes raw data, processing deferred to PendSV
+				ElectrodesScanAcquire(frequencyID);
 
-				// Clear LPIT0 timer flag 0
-				LPIT0->MSR = LPIT_MSR_TIF0_MASK;
-
-				// Disable LPIT
-				LPIT_Disable();
-
-				// Sense touch buttons electrodes again on second period/frequency
-				ElectrodeTouchElecSense();
-
-#if SLIDER_ENABLE
-#if (NUMBER_OF_USED_ADC_MODULES == 2)
-			// Preset configuration for both ADC0 and ADC1 for voltage digitalization at the same time
-			ADCs_SimultaneousHWtrigger();
-			// Sense electrode touch event at slider electrodes on second period/frequency
-			SliderElectrodesTouchElecSense();
-			// Reset configuration for both ADC0 and ADC1 for voltage digitalization one by one
-			ADCs_SetBackToSWtrigger();
-#else
-			// Sense electrode touch event at slider electrodes on second period/frequency
-			SliderElectrodesTouchElecSense();
-#endif
-#endif
-			// If any touch button touched - change the number of sensing cycles per sample
-			ElectrodeSensingCyclesChange();
+#if FREQUENCY_HOPPING
+				// Change the frequency ID
+				FrequencyHop();
 
-#if SLIDER_ENABLE
-			// Change the number of sensing cycles per sample for slider
-			SliderSensingCyclesChange();
+				// Acquire again on second period/frequency in LPIT interrupt
+				LPIT_Enable();
 #endif
-			// Change the frequency ID
-			FrequencyHop();
 			}
 #else
-			// If any touch button touched - change the number of sensing cycles per sample and sense them again
-			ElectrodeSensingCyclesChange();
-
-#if SLIDER_ENABLE
-			// Change the number of sensing cycles per sample for slider
-			SliderSensingCyclesChange();
-#endif
+			// Any sensor group due?
+			if (sensorGroupsScan != 0)
+			{
+				// Sense touch buttons and slider electrodes touch event
+				SensorGroupsTouchElecSense(sensorGroupsScan);
 
-#endif
+#if FREQUENCY_HOPPING
+				// Change the frequency ID
+				FrequencyHop();
 
-			// Any electrode touched?
-#if SLIDER_ENABLE
-			if (electrodeTouchQualifiedReport == 1 || sliderElectrodeTouchQualifiedReport == 1)
-#else
-				if (electrodeTouchQualifiedReport == 1)
-#endif
+				if(frequencyHoppingActivation == 1)
 				{
-					// MCU in RUN mode only
-					lowPowerModeCtrl = OFF;
-
-					// Turn ON backlight?
-					if(backlightCounter == 0)
+					//If LPIT disabled (after power-up/wakeup), enable LPIT
+					if((LPIT0->TMR[0].TCTRL & LPIT_TMR_TCTRL_T_EN_MASK) == 0)
 					{
-						// Reset FTM 2 counter
-						FTM2->CNT = 0;
-						// Load PWM duty cycle
-						LoadBacklightPWMDutyCycle(backlightPWMDutyCycle);
-						// Load counter period to keep backlight ON
-						backlightCounter = KEYPAD_BACKLIGHT_ON_PERIOD;
+						//Enable LPIT
+						LPIT_Enable();
 					}
 
-					// Load counter to keep backlight ON?
-					if(backlightCounter != 100)
-					{
-						// Load counter period to keep backlight ON
-						backlightCounter = KEYPAD_BACKLIGHT_ON_PERIOD;
-					}
-				}
-				else
-				{
-					// Act upon backlightCounter value
-					switch(backlightCounter)
-					{
-					case 0:
-					{	// Default: no action
-						break;
-					}
-					case 1:
-					{
-						// MCU enters the low power mode with periodical wake-up by LPTMR
-						lowPowerModeCtrl = ON;
-						// Reset counter
-						backlightCounter = 0;
+					// Wait for LPIT to timeout
+					while (0 == (LPIT0->MSR & LPIT_MSR_TIF0_MASK)) {}
 
-						break;
-					}
-					case 2:
-					{
-						// Turn OFF backlight
-						LoadBacklightPWMDutyCycle(0);
-						// Load counter value
-						backlightCounter = 1;
+					// Clear LPIT0 timer flag 0
+					LPIT0->MSR = LPIT_MSR_TIF0_MASK;
 
-						break;
-					}
-					default:
-					{
-						// Keyboard backlight ON?
-						if (backlightCounter > 2)
-						{
-							// Decrement counter
-							backlightCounter--;
-						}
-
-						break;
-					}
-					}
+					// Disable LPIT
+					LPIT_Disable();
+
+					// Sense touch buttons and slider electrodes again on second period/frequency
+					SensorGroupsTouchElecSense(sensorGroupsScan);
+
+					// If any electrode touched - change the number of sensing cycles per sample
+					SensorGroupsSensingCyclesChange(sensorGroupsScan, frequencyID);
+
+					// Change the frequency ID
+					FrequencyHop();
 				}
+#else
+				// If any electrode touched - change the number of sensing cycles per sample
+				SensorGroupsSensingCyclesChange(sensorGroupsScan, frequencyID);
+#endif
+			}
 
+			// Keypad backlight and low power mode control
+			BacklightCtrl();
+#endif
 #endif
 
-#if(LOW_POWER_MODE == LPM_DISABLE)
+#if((LOW_POWER_MODE == LPM_DISABLE) && (TS_DEFERRED_PROCESSING == 0))
 			// Recorder time base defined by ELECTRODES_SENSE_PERIOD
 			FMSTR_Recorder();
 #endif
@@ -408,10 +341,17 @@ void LPTMR0_IRQHandler(void)
 		}
 		else
 		{
-			// Self-trim touch button electrodes after power-up / reset
-			ElectrodeSelfTrimSense();
+			// Touch button electrodes self-trim not done (acquisition timing tuning delays it)?
+			if (electrodesStatus.bit.selfTrimDone == NO)
+			{
+				// Self-trim touch button electrodes after power-up / reset
+				ElectrodeSelfTrimSense();
+			}
 
 #if SLIDER_ENABLE
+			// Slider electrodes self-trim not done?
+			if (sliderElectrodesStatus.bit.selfTrimDone == NO)
+			{
 	#if (NUMBER_OF_USED_ADC_MODULES == 2)
 				// Preset configuration for both ADC0 and ADC1 for voltage digitalization at the same time
 				ADCs_SimultaneousHWtrigger();
@@ -423,6 +363,7 @@ void LPTMR0_IRQHandler(void)
 				// Self-trim slider electrodes after power-up / reset
 				SliderElectrodeSelfTrimSense();
 	#endif
+			}
 #endif
 		}
 
@@ -431,8 +372,474 @@ void LPTMR0_IRQHandler(void)
 	//REG_RMW32(&LPTMR0->CSR, 1 << 7, 1 << 7);
 	LPTMR0->CSR |= 1 << 7;
 #endif
+
+#if (ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP)
+	// Core back to deep sleep for the low power mode
+	ADCs_SleepWaitDisable();
+#endif
+
+#ifdef DEBUG_SCAN_TIMING
+	// ISR duration
+	scanTimingIsrCycles = DWT_CYCCNT_REG - isrStart;
+	// ISR peak duration
+	if (scanTimingIsrCycles > scanTimingIsrCyclesMax)
+	{
+		scanTimingIsrCyclesMax = scanTimingIsrCycles;
+	}
+	// ADC conversion complete wait share
+	scanTimingWaitPercent = (scanTimingWaitCycles * 100) / scanTimingIsrCycles;
+#if SLIDER_ENABLE
+	// Interrupts masked window peak
+	if (scanTimingIrqMaskedCycles > scanTimingIrqMaskedCyclesMax)
+	{
+		scanTimingIrqMaskedCyclesMax = scanTimingIrqMaskedCycles;
+	}
+#endif
+#endif
 }
 
+/*****************************************************************************
+ *
+ * Function: void BacklightCtrl(void)
+ *
+ * Description: Keep keypad backlight ON while any electrode touched, turn it OFF and
+ * 				enter the low power mode after KEYPAD_BACKLIGHT_ON_PERIOD without touch
+ *
+ *****************************************************************************/
+void BacklightCtrl(void)
+{
+	// Any electrode touched?
+#if SLIDER_ENABLE
+	if (electrodeTouchQualifiedReport == 1 || sliderElectrodeTouchQualifiedReport == 1)
+#else
+	if (electrodeTouchQualifiedReport == 1)
+#endif
+	{
+		// MCU in RUN mode only
+		lowPowerModeCtrl = OFF;
+
+		// Turn ON backlight?
+		if(backlightCounter == 0)
+		{
+			// Reset FTM 2 counter
+			FTM2->CNT = 0;
+			// Load PWM duty cycle
+			LoadBacklightPWMDutyCycle(backlightPWMDutyCycle);
+			// Load counter period to keep backlight ON
+			backlightCounter = KEYPAD_BACKLIGHT_ON_PERIOD;
+		}
+
+		// Load counter to keep backlight ON?
+		if(backlightCounter != 100)
+		{
+			// Load counter period to keep backlight ON
+			backlightCounter = KEYPAD_BACKLIGHT_ON_PERIOD;
+		}
+	}
+	else
+	{
+		// Act upon backlightCounter value
+		switch(backlightCounter)
+		{
+		case 0:
+		{	// Default: no action
+			break;
+		}
+		case 1:
+		{
+			// MCU enters the low power mode with periodical wake-up by LPTMR
+			lowPowerModeCtrl = ON;
+			// Reset counter
+			backlightCounter = 0;
+
+			break;
+		}
+		case 2:
+		{
+			// Turn OFF backlight
+			LoadBacklightPWMDutyCycle(0);
+			// Load counter value
+			backlightCounter = 1;
+
+			break;
+		}
+		default:
+		{
+			// Keyboard backlight ON?
+			if (backlightCounter > 2)
+			{
+				// Decrement counter
+				backlightCounter--;
+			}
+
+			break;
+		}
+		}
+	}
+}
+
+// Sensor groups scan only without wake-up electrode
+#ifndef WAKE_UP_ELECTRODE
+/*****************************************************************************
+ *
+ * Function: uint8_t SensorGroupsSchedule(void)
+ *
+ * Output: Sensor groups due in this electrodes sensing cycle (bit per group)
+ *
+ * Description: Count down the scan period of each sensor group, the idle or active
+ * 				period according to the group number of sensing cycles per sample
+ *
+ *****************************************************************************/
+uint8_t SensorGroupsSchedule(void)
+{
+#if TS_SENSOR_GROUPS
+	uint8_t  groupNum, groupActive, scanPeriod, sensorGroups;
+
+	// No group due yet
+	sensorGroups = 0;
+
+	// All sensor groups
+	for (groupNum = 0; groupNum < NUMBER_OF_SENSOR_GROUPS; groupNum++)
+	{
+#if SLIDER_ENABLE
+		// Group touched, its sensing cycles per sample switched to active?
+		if (groupNum == SENSOR_GROUP_SLIDER)
+		{
+			groupActive = (numberOfElectrodeSensingCyclesPerSampleSlider == NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_ACTIVE);
+		}
+		else
+#endif
+		{
+			groupActive = (numberOfElectrodeSensingCyclesPerSample == NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE);
+		}
+
+		// Group scan period
+		if (groupActive)
+		{
+			scanPeriod = sensorGroup[groupNum].scanPeriodActive;
+		}
+		else
+		{
+			scanPeriod = sensorGroup[groupNum].scanPeriodIdle;
+		}
+
+		// Group woken up? Do not wait for the rest of the idle period
+		if (sensorGroup[groupNum].scanCounter > scanPeriod)
+		{
+			sensorGroup[groupNum].scanCounter = scanPeriod;
+		}
+
+		// Group scan due?
+		if (--sensorGroup[groupNum].scanCounter == 0)
+		{
+			// Scan the group
+			sensorGroups |= 1 << groupNum;
+			// Reload the scan period
+			sensorGroup[groupNum].scanCounter = scanPeriod;
+		}
+	}
+
+	return sensorGroups;
+#else
+	// All sensor groups every electrodes sensing cycle
+	return SENSOR_GROUPS_ALL;
+#endif
+}
+
+/*****************************************************************************
+ *
+ * Function: void SensorGroupsTouchElecSense(uint8_t sensorGroups)
+ *
+ * Input: Sensor groups to sense (bit per group)
+ *
+ * Description: Sense touch event of touch button and slider electrodes of the groups
+ *
+ *****************************************************************************/
+void SensorGroupsTouchElecSense(uint8_t sensorGroups)
+{
+	// Keypad due?
+	if (sensorGroups & (1 << SENSOR_GROUP_KEYPAD))
+	{
+		// Sense touch buttons electrodes touch event
+		ElectrodeTouchElecSense();
+	}
+
+#if SLIDER_ENABLE
+	// Slider due?
+	if (sensorGroups & (1 << SENSOR_GROUP_SLIDER))
+	{
+#if (NUMBER_OF_USED_ADC_MODULES == 2)
+		// Preset configuration for both ADC0 and ADC1 for voltage digitalization at the same time
+		ADCs_SimultaneousHWtrigger();
+		// Sense electrode touch event at slider electrodes
+		SliderElectrodesTouchElecSense();
+		// Reset configuration for both ADC0 and ADC1 for voltage digitalization one by one
+		ADCs_SetBackToSWtrigger();
+#else
+		// Sense electrode touch event at slider electrodes
+		SliderElectrodesTouchElecSense();
+#endif
+	}
+#endif
+}
+
+/*****************************************************************************
+ *
+ * Function: void SensorGroupsSensingCyclesChange(uint8_t sensorGroups, uint8_t scanFrequencyID)
+ *
+ * Input: Sensor groups scanned (bit per group), scanning period/frequency ID of the scan
+ *
+ * Description: Change the number of sensing cycles per sample of the groups,
+ * 				active if any group electrode touched
+ *
+ *****************************************************************************/
+void SensorGroupsSensingCyclesChange(uint8_t sensorGroups, uint8_t scanFrequencyID)
+{
+	// Keypad scanned?
+	if (sensorGroups & (1 << SENSOR_GROUP_KEYPAD))
+	{
+		// If any touch button touched - change the number of sensing cycles per sample
+		ElectrodeSensingCyclesChange(scanFrequencyID);
+	}
+
+#if SLIDER_ENABLE
+	// Slider scanned?
+	if (sensorGroups & (1 << SENSOR_GROUP_SLIDER))
+	{
+		// Change the number of sensing cycles per sample for slider
+		SliderSensingCyclesChange(scanFrequencyID);
+	}
+#endif
+}
+
+#endif
+
+#if TS_DEFERRED_PROCESSING
+/*****************************************************************************
+ *
+ * Function: void ElectrodesScanAcquire(uint8_t scanFrequencyID)
+ *
+ * Input: Scanning period/frequency ID of the scan
+ *
+ * Description: Acquire raw data of all touch button and slider electrodes into the free
+ * 				acquisition frame and pend the deferred processing (PendSV)
+ *
+ *****************************************************************************/
+void ElectrodesScanAcquire(uint8_t scanFrequencyID)
+{
+	// Frame still waiting for processing?
+	if (acqFrame[acqFrameWrite].ready == YES)
+	{
+		// Processing overrun, drop the scan
+		acqFrameOverruns++;
+	}
+	else
+	{
+		// Open the acquisition frame, raw data are stored there
+		acqFramePtr = &acqFrame[acqFrameWrite];
+		acqFramePtr->frequencyID = scanFrequencyID;
+		acqFramePtr->sensorGroups = sensorGroupsScan;
+
+		// Keypad due?
+		if (sensorGroupsScan & (1 << SENSOR_GROUP_KEYPAD))
+		{
+			// Convert all touch button electrodes capacitance to equivalent voltage
+			ElectrodeTouchElecAcquire();
+		}
+
+#if SLIDER_ENABLE
+		// Slider due?
+		if (sensorGroupsScan & (1 << SENSOR_GROUP_SLIDER))
+		{
+#if (NUMBER_OF_USED_ADC_MODULES == 2)
+			// Preset configuration for both ADC0 and ADC1 for voltage digitalization at the same time
+			ADCs_SimultaneousHWtrigger();
+			// Convert slider electrodes capacitance to equivalent voltage
+			SliderElectrodesTouchElecAcquire();
+			// Reset configuration for both ADC0 and ADC1 for voltage digitalization one by one
+			ADCs_SetBackToSWtrigger();
+#else
+			// Convert slider electrodes capacitance to equivalent voltage
+			SliderElectrodesTouchElecAcquire();
+#endif
+		}
+#endif
+
+		// Frame ready for processing, close it
+		acqFramePtr->ready = YES;
+		acqFramePtr = 0;
+		// Next frame
+		acqFrameWrite ^= 1;
+
+		// Pend deferred processing
+		S32_SCB->ICSR = S32_SCB_ICSR_PENDSVSET_MASK;
+	}
+}
+
+/*****************************************************************************
+ *
+ * Function: void ElectrodesScanProcess(tAcqFrame *framePtr)
+ *
+ * Input: Address of the acquired frame
+ *
+ * Description: Process one acquired scan - DC tracker, IIR LP filter, touch detection and
+ * 				qualification of touch button and slider electrodes, sensing cycles change,
+ * 				backlight control and FreeMASTER recorder
+ *
+ *****************************************************************************/
+void ElectrodesScanProcess(tAcqFrame *framePtr)
+{
+	uint32_t  elecNum;
+	uint8_t   scanFrequencyID;
+	tSenseCtx  senseCtx;
+
+#ifdef DEBUG_ALGORITHM
+	// Pin clear
+	R_RMW32(&(DA_GPIO->PCOR), DA_PIN, 1);
+#endif
+
+	// Scanning period/frequency of the scan, frequencyID belongs to the acquisition interrupts
+	scanFrequencyID = framePtr->frequencyID;
+
+	// Keypad acquired?
+	if (framePtr->sensorGroups & (1 << SENSOR_GROUP_KEYPAD))
+	{
+		// Sensing context of the frame
+		senseCtx.elecDataPtr = elecData;
+		senseCtx.scanMask = framePtr->elecScanMask;
+		senseCtx.frequencyID = scanFrequencyID;
+
+		// Load touch button electrodes raw data
+		for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+		{
+			// Electrode not scanned?
+			if ((senseCtx.scanMask & (1 << elecNum)) == 0)
+			{
+				continue;
+			}
+			elecData[elecNum].adcDataElectrodeDischargeRaw[scanFrequencyID] = framePtr->elecRaw[elecNum];
+		}
+		// Detect and qualify touch button electrodes touch event
+		ElectrodeTouchProcess(&senseCtx);
+	}
+
+#if SLIDER_ENABLE
+	// Slider acquired?
+	if (framePtr->sensorGroups & (1 << SENSOR_GROUP_SLIDER))
+	{
+		// Slider electrodes scanned in the frame
+		sliderScanned = framePtr->sliderScanned;
+
+		// Load slider electrodes raw data
+		for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
+		{
+			sliderElecData[elecNum].adcDataElectrodeDischargeRaw[scanFrequencyID] = framePtr->sliderRaw[elecNum];
+		}
+		// Detect and qualify slider touch event
+		SliderElectrodesTouchProcess(scanFrequencyID);
+	}
+#endif
+
+#if FREQUENCY_HOPPING
+	// Second period/frequency scan?
+	if (scanFrequencyID == 1)
+#endif
+	{
+		// If any electrode touched - change the number of sensing cycles per sample
+		SensorGroupsSensingCyclesChange(framePtr->sensorGroups, scanFrequencyID);
+	}
+
+#if FREQUENCY_HOPPING
+	// Both periods/frequencies scanned?
+	if (scanFrequencyID == 1)
+#endif
+	{
+		// Keypad backlight and low power mode control
+		BacklightCtrl();
+
+#if(LOW_POWER_MODE == LPM_DISABLE)
+		// Recorder time base defined by ELECTRODES_SENSE_PERIOD
+		FMSTR_Recorder();
+#endif
+	}
+
+#ifdef DEBUG_ALGORITHM
+	// Pin set
+	R_RMW32(&(DA_GPIO->PSOR), DA_PIN, 1);
+#endif
+}
+
+/*****************************************************************************
+ *
+ * Function: void PendSV_Handler(void)
+ *
+ * Description: Deferred processing of acquired electrodes scans, lowest priority
+ *
+ *****************************************************************************/
+void PendSV_Handler(void)
+{
+#ifdef DEBUG_SCAN_TIMING
+	uint32_t processStart = DWT_CYCCNT_REG;
+#endif
+
+	// All acquired frames, the oldest first
+	while (acqFrame[acqFrameRead].ready == YES)
+	{
+		// Process the scan
+		ElectrodesScanProcess(&acqFrame[acqFrameRead]);
+
+		// Frame free for acquisition
+		acqFrame[acqFrameRead].ready = NO;
+		// Next frame
+		acqFrameRead ^= 1;
+	}
+
+#ifdef DEBUG_SCAN_TIMING
+	// Deferred processing duration
+	scanTimingProcessCycles = DWT_CYCCNT_REG - processStart;
+	// Deferred processing peak duration
+	if (scanTimingProcessCycles > scanTimingProcessCyclesMax)
+	{
+		scanTimingProcessCyclesMax = scanTimingProcessCycles;
+	}
+#endif
+}
+
+#if FREQUENCY_HOPPING
+/*****************************************************************************
+ *
+ * Function: void LPIT0_Ch0_IRQHandler(void)
+ *
+ * Description: LPIT interrupt, acquire electrodes on second period/frequency
+ *
+ *****************************************************************************/
+void LPIT0_Ch0_IRQHandler(void)
+{
+	// Clear LPIT0 timer flag 0
+	LPIT0->MSR = LPIT_MSR_TIF0_MASK;
+
+	// Disable LPIT
+	LPIT_Disable();
+
+#if (ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP)
+	// Core sleeps while waiting for ADC conversion complete
+	ADCs_SleepWaitEnable();
+#endif
+
+	// Acquire touch button and slider electrodes raw data on second period/frequency
+	ElectrodesScanAcquire(frequencyID);
+
+	// Change the frequency ID back to the first period/frequency
+	FrequencyHop();
+
+#if (ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP)
+	// Core back to deep sleep for the low power mode
+	ADCs_SleepWaitDisable();
+#endif
+}
+#endif
+#endif
+
 /*****************************************************************************
  *
  * Function: void LPIT_Init(uint32_t timeout)
@@ -448,6 +855,11 @@ void LPIT_Init(uint32_t timeout)
 	/* M_CEN=1: enable module clk (allows writing other LPIT0 regs)*/
 
 	LPIT0->TMR[0].TVAL = timeout; /* Chan 0 Timeout period: 0.33 ms */
+
+#if TS_DEFERRED_PROCESSING
+	// Chan 0 timeout interrupt, second period/frequency scan acquired in LPIT ISR
+	LPIT0->MIER = LPIT_MIER_TIE0_MASK;
+#endif
 }
 
 /*****************************************************************************
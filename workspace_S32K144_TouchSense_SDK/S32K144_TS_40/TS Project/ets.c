@@ -13,6 +13,7 @@
 /*******************************************************************************
 * Includes
 *******************************************************************************/
+#include <stddef.h>
 #include "S32K144.h"
 #include "main.h"
 #include "ets.h"
@@ -24,6 +25,12 @@
 #include "adc.h"
 #include "adc_inline_fcn1.h"
 #include "slider.h"
+#if TS_DMA_ACQUISITION
+#include "dma.h"
+#endif
+#if TS_WARM_START
+#include "flash.h"
+#endif
 
 /*******************************************************************************
  * Variables
@@ -35,15 +42,131 @@ tElecStatus   electrodesStatus;
 tElecStruct  elecStruct[NUMBER_OF_ELECTRODES], *pElecStruct;
 #if SLIDER_ENABLE
 extern tElecStruct  sliderElecStruct[NUMBER_OF_SLIDER_ELECTRODES];
+// Slider enable applied to the scan
+extern uint8_t  sliderEnabled;
+#endif
+
+// Electrode processing state
+tElecData  elecData[NUMBER_OF_ELECTRODES];
+
+// Electrode configuration table in flash
+const tElecCfg  elecCfg[NUMBER_OF_ELECTRODES] =
+{
+#ifdef ELEC0
+	ELEC_CFG(0),
+#endif
+#ifdef ELEC1
+	ELEC_CFG(1),
+#endif
+#ifdef ELEC2
+	ELEC_CFG(2),
+#endif
+#ifdef ELEC3
+	ELEC_CFG(3),
+#endif
+#ifdef ELEC4
+	ELEC_CFG(4),
+#endif
+#ifdef ELEC5
+	ELEC_CFG(5),
+#endif
+#ifdef ELEC6
+	ELEC_CFG(6),
+#endif
+#ifdef ELEC7
+	ELEC_CFG(7),
+#endif
+#ifdef ELEC8
+	ELEC_CFG(8),
+#endif
+#ifdef ELEC9
+	ELEC_CFG(9),
+#endif
+#ifdef ELEC10
+	ELEC_CFG(10),
+#endif
+#ifdef ELEC11
+	ELEC_CFG(11),
+#endif
+#ifdef ELEC12
+	ELEC_CFG(12),
+#endif
+#ifdef ELEC13
+	ELEC_CFG(13),
+#endif
+#ifdef ELEC14
+	ELEC_CFG(14),
+#endif
+#ifdef ELEC15
+	ELEC_CFG(15),
+#endif
+#ifdef ELEC16
+	ELEC_CFG(16),
+#endif
+#ifdef ELEC17
+	ELEC_CFG(17),
+#endif
+#ifdef ELEC18
+	ELEC_CFG(18),
 #endif
+#ifdef ELEC19
+	ELEC_CFG(19),
+#endif
+#ifdef ELEC20
+	ELEC_CFG(20),
+#endif
+#ifdef ELEC21
+	ELEC_CFG(21),
+#endif
+#ifdef ELEC22
+	ELEC_CFG(22),
+#endif
+#ifdef ELEC23
+	ELEC_CFG(23),
+#endif
+#ifdef ELEC24
+	ELEC_CFG(24),
+#endif
+#ifdef ELEC25
+	ELEC_CFG(25),
+#endif
+#ifdef ELEC26
+	ELEC_CFG(26),
+#endif
+#ifdef ELEC27
+	ELEC_CFG(27),
+#endif
+#ifdef ELEC28
+	ELEC_CFG(28),
+#endif
+#ifdef ELEC29
+	ELEC_CFG(29),
+#endif
+#ifdef ELEC30
+	ELEC_CFG(30),
+#endif
+#ifdef ELEC31
+	ELEC_CFG(31),
+#endif
+};
 
 // Electrode capacitance to equivalent voltage conversion
 int16_t   numberOfElectrodeSensingCyclesPerSample;
-int32_t   adcDataElectrodeDischargeRaw[NUMBER_OF_ELECTRODES][NUMBER_OF_HOPPING_FREQUENCIES];
+int16_t   electrodeSensingCyclesPerSample;
+#if TS_DMA_ACQUISITION
+// Electrode samples stored by DMA
 int16_t   adcDataElectrodeDischargeRawSample[NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE];
+#endif
+// Electrode samples trimmed mean accumulator
+tTrimAcc  elecTrimAcc;
 int32_t   adcDataElectrodeDischargeRawCalc;
-uint8_t   elecNum, elecNumAct, sampleNum;
+// Next electrode pair converted by the decimation filter scan
+uint8_t   elecNumAct;
 uint16_t  chargeDistributionPeriod, chargeDistributionPeriodTmp;
+#if(TS_ASM_OPTIMIZE == 1)
+// Hand-scheduled conversion kernel parameters
+tConvKernel convKernel;
+#endif
 
 // Wake up
 uint16_t   electrodeWakeUpActivateCounter;
@@ -53,23 +176,15 @@ extern uint8_t sliderElecNumAct;
 // Electrode DC tracker self-trim after power-up or reset
 int32_t   adcDataElectrodeDischargeBuffer[NUMBER_OF_ELECTRODES];
 uint16_t  adcDataElectrodeDischargeBufferCounter[NUMBER_OF_ELECTRODES];
-
-// DC Tracker
-int32_t   DCTrackerDataBufferRaw[NUMBER_OF_ELECTRODES];
-int32_t   DCTrackerDataBuffer[NUMBER_OF_ELECTRODES];
-uint8_t   DCTrackerDataShift[NUMBER_OF_ELECTRODES];
-
-// LP Filter
-tFrac32   LPFilterData[NUMBER_OF_ELECTRODES][NUMBER_OF_HOPPING_FREQUENCIES];
-#if SLIDER_ENABLE
-uint8_t   LPFilterType[NUMBER_OF_ELECTRODES + NUMBER_OF_SLIDER_ELECTRODES];
-#else
-uint8_t   LPFilterType[NUMBER_OF_ELECTRODES];
+#if TS_SELF_TRIM_CONVERGENCE
+// Self-trim samples spread, all baselines settled
+tSelfTrimVar  selfTrimVar[NUMBER_OF_ELECTRODES];
+uint8_t   selfTrimSettled;
+// Self-trim scans, electrode samples restart when drifting
+uint16_t  selfTrimScans;
 #endif
+
 // Detector
-int32_t   detectorThresholdTouch[NUMBER_OF_ELECTRODES], detectorThresholdRelease[NUMBER_OF_ELECTRODES];
-int16_t   detectorThresholdTouchDelta[NUMBER_OF_ELECTRODES], detectorThresholdReleaseDelta[NUMBER_OF_ELECTRODES];
-uint8_t   electrodeTouch[NUMBER_OF_ELECTRODES][NUMBER_OF_HOPPING_FREQUENCIES];
 uint8_t   electrodesVirtualEGSTouch;
 
 // Touch qualification
@@ -80,151 +195,120 @@ uint8_t   electrodeTouchNumberPlusOne;
 // Low power mode
 extern uint8_t  lowPowerModeCtrl;
 
-// FrequencyHopping
-uint8_t   frequencyID,frequencyIDsave;
+// FrequencyHopping, scanning period/frequency of the acquisition, processing functions get the ID in the sensing context of their scan
+uint8_t   frequencyID;
 uint8_t   frequencyHoppingActivation;
 
-// Decimation filter
-int32_t   adcDataElectrodeDischargeRawDF[NUMBER_OF_ELECTRODES][NUMBER_OF_HOPPING_FREQUENCIES];
-
 // Oversampling
 uint8_t electrodesOversamplingActivationReport;
-/*****************************************************************************
- *
- * Function: void ElectrodeStructureInit(void)
- *
- * Description: Electrodes structure init
- *
- *****************************************************************************/
-void ElectrodeStructureInit(void)
-{
-#ifdef ELEC0
-	// Load electrode 0 hardware data
-	elecStruct[0].adcBasePtr = ELEC0_ADC;
-	elecStruct[0].adcChNum = ELEC0_ADC_CHANNEL;
-	elecStruct[0].portBasePtr = ELEC0_PORT;
-	elecStruct[0].gpioBasePtr = ELEC0_GPIO;
-	elecStruct[0].pinNumberElec = ELEC0_ELEC_GPIO_PIN;
-	elecStruct[0].pinNumberCext = ELEC0_CEXT_GPIO_PIN;
-	elecStruct[0].portMask = ELEC0_PORT_MASK;
-	// Load electrode 0 application data
-	DCTrackerDataShift[0] = ELEC0_DCTRACKER_FILTER_FACTOR;
-	LPFilterType[0] = ELEC0_LPFILTER_TYPE;
-	detectorThresholdTouchDelta[0] = ELEC0_TOUCH_THRESHOLD_DELTA;
-	detectorThresholdReleaseDelta[0] = ELEC0_RELEASE_THRESHOLD_DELTA;
+
+#if TS_DEFERRED_PROCESSING
+// Acquisition frame of the scan being acquired, raw data go to electrodes processing state if none
+extern tAcqFrame  *acqFramePtr;
 #endif
 
-#ifdef ELEC1
-	// Load electrode 1 hardware data
-	elecStruct[1].adcBasePtr = ELEC1_ADC;
-	elecStruct[1].adcChNum = ELEC1_ADC_CHANNEL;
-	elecStruct[1].portBasePtr = ELEC1_PORT;
-	elecStruct[1].gpioBasePtr = ELEC1_GPIO;
-	elecStruct[1].pinNumberElec = ELEC1_ELEC_GPIO_PIN;
-	elecStruct[1].pinNumberCext = ELEC1_CEXT_GPIO_PIN;
-	elecStruct[1].portMask = ELEC1_PORT_MASK;
-	// Load electrode 1 application data
-	DCTrackerDataShift[1] = ELEC1_DCTRACKER_FILTER_FACTOR;
-	LPFilterType[1] = ELEC1_LPFILTER_TYPE;
-	detectorThresholdTouchDelta[1] = ELEC1_TOUCH_THRESHOLD_DELTA;
-	detectorThresholdReleaseDelta[1] = ELEC1_RELEASE_THRESHOLD_DELTA;
+// Touch button electrodes enable requested by the application and applied to the scan (bit per electrode)
+volatile uint32_t  elecEnableMask = ELEC_SCAN_MASK_ALL;
+uint32_t  elecEnabledMask = ELEC_SCAN_MASK_ALL;
+// Touch button electrodes scanned in the last period (bit per electrode)
+uint32_t  elecScannedMask = ELEC_SCAN_MASK_ALL;
+
+#if TS_TEMP_COMPENSATION
+// On-chip temperature sensor data (sum of TEMP_SENSOR_SAMPLES conversions), ready for processing, scans to the next conversion
+int32_t   tempSensorData;
+volatile uint8_t  tempSensorReady;
+uint8_t   tempSensorScanCounter;
+// Temperature of the last compensation step and of the learning window start, compensation started
+int32_t   tempCompLast, tempCompWindowStart;
+uint8_t   tempCompStarted;
 #endif
 
-#ifdef ELEC2
-	// Load electrode 2 hardware data
-	elecStruct[2].adcBasePtr = ELEC2_ADC;
-	elecStruct[2].adcChNum = ELEC2_ADC_CHANNEL;
-	elecStruct[2].portBasePtr = ELEC2_PORT;
-	elecStruct[2].gpioBasePtr = ELEC2_GPIO;
-	elecStruct[2].pinNumberElec = ELEC2_ELEC_GPIO_PIN;
-	elecStruct[2].pinNumberCext = ELEC2_CEXT_GPIO_PIN;
-	elecStruct[2].portMask = ELEC2_PORT_MASK;
-	// Load electrode 2 application data
-	DCTrackerDataShift[2] = ELEC2_DCTRACKER_FILTER_FACTOR;
-	LPFilterType[2] = ELEC2_LPFILTER_TYPE;
-	detectorThresholdTouchDelta[2] = ELEC2_TOUCH_THRESHOLD_DELTA;
-	detectorThresholdReleaseDelta[2] = ELEC2_RELEASE_THRESHOLD_DELTA;
+// Number of self-trim cycles to calculate DC tracker power-up value (touch buttons and slider)
+uint16_t  selfTrimCycles = NUMBER_OF_CYCLES_DCTRACKER_PWRUP;
+
+#if TS_WARM_START
+// ADC calibration gain
+extern int16_t  calibrationGainADC0, calibrationGainADC1;
+// Warm start snapshot in data flash
+const tWarmStartImage  *warmStartFlashPtr = (const tWarmStartImage *)WARM_START_DFLASH_ADDRESS;
+// Warm start snapshot to be stored
+tWarmStartImage  warmStartImage;
+// Valid snapshot found at startup, snapshot store requested by the self-trim
+uint8_t   warmStartValid;
+volatile uint8_t  warmStartSaveRequest;
 #endif
 
-#ifdef ELEC3
-	// Load electrode 3 hardware data
-	elecStruct[3].adcBasePtr = ELEC3_ADC;
-	elecStruct[3].adcChNum = ELEC3_ADC_CHANNEL;
-	elecStruct[3].portBasePtr = ELEC3_PORT;
-	elecStruct[3].gpioBasePtr = ELEC3_GPIO;
-	elecStruct[3].pinNumberElec = ELEC3_ELEC_GPIO_PIN;
-	elecStruct[3].pinNumberCext = ELEC3_CEXT_GPIO_PIN;
-	elecStruct[3].portMask = ELEC3_PORT_MASK;
-	// Load electrode 3 application data
-	DCTrackerDataShift[3] = ELEC3_DCTRACKER_FILTER_FACTOR;
-	LPFilterType[3] = ELEC3_LPFILTER_TYPE;
-	detectorThresholdTouchDelta[3] = ELEC3_TOUCH_THRESHOLD_DELTA;
-	detectorThresholdReleaseDelta[3] = ELEC3_RELEASE_THRESHOLD_DELTA;
+#if TS_COMMON_MODE_REJECTION
+// Common-mode delta removed from the touch button electrodes raw data in the last scan
+int32_t   commonModeData;
 #endif
 
-#ifdef ELEC4
-	// Load electrode 4 hardware data
-	elecStruct[4].adcBasePtr = ELEC4_ADC;
-	elecStruct[4].adcChNum = ELEC4_ADC_CHANNEL;
-	elecStruct[4].portBasePtr = ELEC4_PORT;
-	elecStruct[4].gpioBasePtr = ELEC4_GPIO;
-	elecStruct[4].pinNumberElec = ELEC4_ELEC_GPIO_PIN;
-	elecStruct[4].pinNumberCext = ELEC4_CEXT_GPIO_PIN;
-	elecStruct[4].portMask = ELEC4_PORT_MASK;
-	// Load electrode 4 application data
-	DCTrackerDataShift[4] = ELEC4_DCTRACKER_FILTER_FACTOR;
-	LPFilterType[4] = ELEC4_LPFILTER_TYPE;
-	detectorThresholdTouchDelta[4] = ELEC4_TOUCH_THRESHOLD_DELTA;
-	detectorThresholdReleaseDelta[4] = ELEC4_RELEASE_THRESHOLD_DELTA;
+#if TS_ROI_SCAN
+// Region-of-interest scan scheduling, touch button electrodes to scan in the next period
+uint32_t  elecRoiScanMask = ELEC_SCAN_MASK_ALL;
+// Background electrodes rotation slot
+uint8_t   roiBackgroundSlot;
 #endif
 
-#ifdef ELEC5
-	// Load electrode 5 hardware data
-	elecStruct[5].adcBasePtr = ELEC5_ADC;
-	elecStruct[5].adcChNum = ELEC5_ADC_CHANNEL;
-	elecStruct[5].portBasePtr = ELEC5_PORT;
-	elecStruct[5].gpioBasePtr = ELEC5_GPIO;
-	elecStruct[5].pinNumberElec = ELEC5_ELEC_GPIO_PIN;
-	elecStruct[5].pinNumberCext = ELEC5_CEXT_GPIO_PIN;
-	elecStruct[5].portMask = ELEC5_PORT_MASK;
-	// Load electrode 5 application data
-	DCTrackerDataShift[5] = ELEC5_DCTRACKER_FILTER_FACTOR;
-	LPFilterType[5] = ELEC5_LPFILTER_TYPE;
-	detectorThresholdTouchDelta[5] = ELEC5_TOUCH_THRESHOLD_DELTA;
-	detectorThresholdReleaseDelta[5] = ELEC5_RELEASE_THRESHOLD_DELTA;
+#if DUAL_ADC_CONVERSION || TS_PIPELINED_CONVERSION
+// Second electrode samples trimmed mean accumulator - dual ADC or pipelined conversion
+tTrimAcc  elecTrimAccPair;
 #endif
 
-#ifdef ELEC6
-	// Load electrode 6 hardware data
-	elecStruct[6].adcBasePtr = ELEC6_ADC;
-	elecStruct[6].adcChNum = ELEC6_ADC_CHANNEL;
-	elecStruct[6].portBasePtr = ELEC6_PORT;
-	elecStruct[6].gpioBasePtr = ELEC6_GPIO;
-	elecStruct[6].pinNumberElec = ELEC6_ELEC_GPIO_PIN;
-	elecStruct[6].pinNumberCext = ELEC6_CEXT_GPIO_PIN;
-	elecStruct[6].portMask = ELEC6_PORT_MASK;
-	// Load electrode 6 application data
-	DCTrackerDataShift[6] = ELEC6_DCTRACKER_FILTER_FACTOR;
-	LPFilterType[6] = ELEC6_LPFILTER_TYPE;
-	detectorThresholdTouchDelta[6] = ELEC6_TOUCH_THRESHOLD_DELTA;
-	detectorThresholdReleaseDelta[6] = ELEC6_RELEASE_THRESHOLD_DELTA;
+#if DUAL_ADC_CONVERSION
+// Dual ADC conversion
+uint8_t   elecPairPartner[NUMBER_OF_TOUCH_ELECTRODES];
 #endif
 
-#ifdef ELEC7
-	// Load electrode 7 hardware data
-	elecStruct[7].adcBasePtr = ELEC7_ADC;
-	elecStruct[7].adcChNum = ELEC7_ADC_CHANNEL;
-	elecStruct[7].portBasePtr = ELEC7_PORT;
-	elecStruct[7].gpioBasePtr = ELEC7_GPIO;
-	elecStruct[7].pinNumberElec = ELEC7_ELEC_GPIO_PIN;
-	elecStruct[7].pinNumberCext = ELEC7_CEXT_GPIO_PIN;
-	elecStruct[7].portMask = ELEC7_PORT_MASK;
-	// Load electrode 7 application data
-	DCTrackerDataShift[7] = ELEC7_DCTRACKER_FILTER_FACTOR;
-	LPFilterType[7] = ELEC7_LPFILTER_TYPE;
-	detectorThresholdTouchDelta[7] = ELEC7_TOUCH_THRESHOLD_DELTA;
-	detectorThresholdReleaseDelta[7] = ELEC7_RELEASE_THRESHOLD_DELTA;
+// All electrodes pins masks per GPIO port
+uint32_t  electrodesPortMask[NUMBER_OF_GPIO_PORTS];
+
+// ADC conversion resolution, samples scaled to 12-bit range
+uint8_t   adcResolution = ADC_RESOLUTION_12BIT;
+#ifdef WAKE_UP_ELECTRODE
+// Wake-up (EGS) electrode conversion resolution
+uint8_t   egsAdcResolution = EGS_IDLE_ADC_RESOLUTION;
+#endif
+
+#if TS_SEQUENTIAL_TERMINATION
+// Sequential early termination of sample bursts
+int32_t   sequentialTestSum;
+int64_t   sequentialTestSumSquare;
+uint32_t  sequentialTestSamplesNum;
+uint32_t  sequentialTestTerminations, sequentialTestCyclesSaved;
+#endif
+
+#if TS_TIMING_AUTOTUNE
+// Acquisition timing auto-tuning
+const uint16_t timingTuneChargeDistributionPeriod[NUMBER_OF_TIMING_TUNE_CANDIDATES] = TIMING_TUNE_CHARGE_DISTRIBUTION_PERIODS;
+const uint8_t  timingTuneAdcSampleTime[NUMBER_OF_TIMING_TUNE_CANDIDATES] = TIMING_TUNE_ADC_SAMPLE_TIMES;
+uint8_t   timingTuneCandidate, timingTuneStep, timingTuneScan;
+uint8_t   elecTimingTuneResult[NUMBER_OF_ELECTRODES];
+int32_t   timingTuneRawMin[NUMBER_OF_ELECTRODES], timingTuneRawMax[NUMBER_OF_ELECTRODES];
+int32_t   timingTuneRawSum[NUMBER_OF_ELECTRODES], timingTuneRawSumReference[NUMBER_OF_ELECTRODES];
 #endif
+/*****************************************************************************
+ *
+ * Function: void ElectrodeStructureInit(void)
+ *
+ * Description: Electrodes structure init
+ *
+ *****************************************************************************/
+void ElectrodeStructureInit(void)
+{
+	uint32_t  elecNum;
+
+	// All electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+	{
+		// Load electrode hardware data
+		elecStruct[elecNum] = elecCfg[elecNum].hw;
+		// Load electrode application data
+		elecData[elecNum].DCTrackerDataShift = elecCfg[elecNum].DCTrackerFilterFactor;
+		elecData[elecNum].LPFilterType = elecCfg[elecNum].LPFilterType;
+		elecData[elecNum].detectorThresholdTouchDelta = elecCfg[elecNum].touchThresholdDelta;
+		elecData[elecNum].detectorThresholdReleaseDelta = elecCfg[elecNum].releaseThresholdDelta;
+	}
 
 	// If EGS is OFF and TS method is oversampling
 #if !defined(WAKE_UP_ELECTRODE) && TS_RAW_DATA_CALCULATION == OVERSAMPLING
@@ -232,10 +316,10 @@ void ElectrodeStructureInit(void)
 	for(elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
 	{
 		// Set Threshold delta values to correspond to number of samples taken in Idle state
-		detectorThresholdTouchDelta[elecNum] /= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
-		detectorThresholdReleaseDelta[elecNum] /= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
+		elecData[elecNum].detectorThresholdTouchDelta /= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
+		elecData[elecNum].detectorThresholdReleaseDelta /= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
 		// Update DC tracker shift
-		DCTrackerDataShift[elecNum] = ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
+		elecData[elecNum].DCTrackerDataShift = ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
 	}
 #endif
 
@@ -245,7 +329,7 @@ void ElectrodeStructureInit(void)
 	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
 	{
 		// Update DC tracker shift
-		DCTrackerDataShift[elecNum] = ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
+		elecData[elecNum].DCTrackerDataShift = ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
 	}
 #endif
 #endif
@@ -260,6 +344,8 @@ void ElectrodeStructureInit(void)
  *****************************************************************************/
 void ElectrodeADCchannelOffset(void)
 {
+	uint32_t  elecNum;
+
 	// All electrodes
 	for(elecNum = 0; elecNum<NUMBER_OF_ELECTRODES; elecNum++)
 	{
@@ -269,6 +355,70 @@ void ElectrodeADCchannelOffset(void)
 			// Add offset
 			elecStruct[elecNum].adcChNum += ELECTRODE_ADC_CHANNEL_OFFSET;
 		}
+
+#if (ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP)
+		// Conversion complete interrupt enable, wakes core from sleep
+		elecStruct[elecNum].adcChNum |= ADC_SC1_AIEN_MASK;
+#endif
+	}
+}
+
+/*****************************************************************************
+ *
+ * Function: void ElectrodesPortMaskInit(void)
+ *
+ * Description: Gather Electrode and Cext pins of all electrodes (touch button, EGS and slider)
+ * 				into one pins mask per GPIO port
+ *
+ *****************************************************************************/
+void ElectrodesPortMaskInit(void)
+{
+	uint32_t  elecNum;
+	uint32_t portNum;
+	uint32_t portMask[NUMBER_OF_GPIO_PORTS];
+
+	// All GPIO ports
+	for (portNum = 0; portNum < NUMBER_OF_GPIO_PORTS; portNum++)
+	{
+		// Reset port mask
+		portMask[portNum] = 0;
+	}
+
+	// All touch button (and EGS) electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+	{
+		// Disabled touch button electrode stays driven to GND
+		if ((elecNum < NUMBER_OF_TOUCH_ELECTRODES) && ((elecEnabledMask & (1 << elecNum)) == 0))
+		{
+			continue;
+		}
+
+		// GPIO port number
+		portNum = ((uint32_t)elecStruct[elecNum].gpioBasePtr - PTA_BASE) / (PTB_BASE - PTA_BASE);
+		// Add Electrode and Cext pins
+		portMask[portNum] |= elecStruct[elecNum].portMask;
+	}
+
+#if SLIDER_ENABLE
+	// Slider enabled?
+	if (sliderEnabled == YES)
+	{
+		// All slider electrodes
+		for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
+		{
+			// GPIO port number
+			portNum = ((uint32_t)sliderElecStruct[elecNum].gpioBasePtr - PTA_BASE) / (PTB_BASE - PTA_BASE);
+			// Add Electrode and Cext pins
+			portMask[portNum] |= sliderElecStruct[elecNum].portMask;
+		}
+	}
+#endif
+
+	// All GPIO ports
+	for (portNum = 0; portNum < NUMBER_OF_GPIO_PORTS; portNum++)
+	{
+		// Load port mask, one word per port
+		electrodesPortMask[portNum] = portMask[portNum];
 	}
 }
 
@@ -281,15 +431,52 @@ void ElectrodeADCchannelOffset(void)
  *****************************************************************************/
 void ElectrodeTouchSenseInit(void)
 {
+	uint32_t  elecNum;
+
 	// Electrodes structure init
 	ElectrodeStructureInit();
 
 	// Cext pin ADC channel number correction (in case higher ADC channel number used)
 	ElectrodeADCchannelOffset();
 
+#if DUAL_ADC_CONVERSION
+	// Pair touch button electrodes with Cext on ADC0 and ADC1
+	ElectrodeDualADCPairInit();
+#endif
+
 	// Electrode and Cext charge distribution period
 	chargeDistributionPeriod = 0;
 
+	// All touch button (and EGS) electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+	{
+#if TS_TIMING_AUTOTUNE
+		// Start acquisition timing auto-tuning with the reference candidate
+		elecData[elecNum].elecChargeDistributionPeriod = timingTuneChargeDistributionPeriod[TIMING_TUNE_REFERENCE_CANDIDATE];
+		elecData[elecNum].elecAdcSampleTime = timingTuneAdcSampleTime[TIMING_TUNE_REFERENCE_CANDIDATE];
+		// No candidate reached target SNR yet
+		elecTimingTuneResult[elecNum] = NUMBER_OF_TIMING_TUNE_CANDIDATES;
+#else
+		// Default acquisition timing
+		elecData[elecNum].elecChargeDistributionPeriod = 0;
+		elecData[elecNum].elecAdcSampleTime = ADC_SAMPLE_TIME_SW;
+#endif
+
+#if TS_ADAPTIVE_SENSING_CYCLES
+		// Start with all sensing cycles
+		elecData[elecNum].elecSensingCyclesPerSample = NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE;
+		// Noise variance at the target SNR, no change until measured
+		elecData[elecNum].elecNoiseVariance = ((uint32_t)(elecData[elecNum].detectorThresholdTouchDelta * elecData[elecNum].detectorThresholdTouchDelta)) / (ADAPTIVE_SENSING_TARGET_SNR * ADAPTIVE_SENSING_TARGET_SNR);
+#endif
+	}
+
+#if TS_TIMING_AUTOTUNE
+	// Reset acquisition timing auto-tuning
+	timingTuneCandidate = TIMING_TUNE_REFERENCE_CANDIDATE;
+	timingTuneStep = 0;
+	timingTuneScan = 0;
+#endif
+
 	// Reset electrodes status
 	electrodesStatus.byte = 0;
 
@@ -304,340 +491,1857 @@ void ElectrodeTouchSenseInit(void)
 
 	// Reset the number of sensing cycles per sample to idle (default)
 	numberOfElectrodeSensingCyclesPerSample = NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_IDLE;
+	electrodeSensingCyclesPerSample = NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_IDLE;
 
 	// Reset frequencyID
 	frequencyID = 0;
+
+#if TS_WARM_START
+	// Valid warm start snapshot?
+	if (warmStartValid == YES)
+	{
+		// Restore touch button electrodes acquisition timing, shorten self-trim
+		ElectrodeWarmStartRestore();
+	}
+#endif
 }
 
 /*****************************************************************************
  *
- * Function: void ElectrodeCapToVoltConvELCH(uint32_t electrodeNum)
+ * Function: void ElectrodeTimingSet(uint32_t electrode0Num, uint32_t electrode1Num)
  *
- * Description: Convert electrode capacitance to equivalent voltage
+ * Input: Numbers of electrodes converted together (same number for a single electrode)
+ *
+ * Description: Load charge distribution period and ADC sample time of the electrodes,
+ * 				longer setting is used for settings shared by both electrodes
  *
  *****************************************************************************/
-void ElectrodeCapToVoltConvELCH(uint32_t electrodeNum)
+void ElectrodeTimingSet(uint32_t electrode0Num, uint32_t electrode1Num)
 {
-	// Clear ADCs gain (lower noise)
-	ClearADCsGain();
-
-#ifdef DEBUG_ELECTRODE_SENSE
-	// Pin clear
-	R_RMW32(&(DES_GPIO->PCOR), DES_PIN, 1);
-#endif
-
-	// Electrode capacitance to voltage conversion
-	for (sampleNum = 0; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSample); sampleNum++)
+	// Charge distribution period
+	if (elecData[electrode0Num].elecChargeDistributionPeriod > elecData[electrode1Num].elecChargeDistributionPeriod)
 	{
-		// Distribute Electrode and Cext charge
-		ChargeDistribution(&elecStruct[electrodeNum]);
-		// Delay to distribute charge
-		chargeDistributionPeriodTmp = chargeDistributionPeriod;
-		while (chargeDistributionPeriodTmp) {chargeDistributionPeriodTmp--;}
-
-		// If compiler optimization is not -O3 (is set to none -> -O0), then set TS_ASM_OPTIMIZE macro to 1 in ts_cfg.h
-#if(TS_ASM_OPTIMIZE == 1)
-		asm volatile (
-				/***** ASSEMBLY TEMPLATE ****************************************/
-				// Start Cext voltage ADC conversion
-				"str %1, [%0, #0]\n\t"    // store %1 to address in %0 with 0 byte offset
-				// Redistribute Electrode and Cext charge
-				"str %3, [%2, #0]"        // store %3 to address in %2 with 0 byte offset
-				/***** LIST OF OUTPUT OPERANDS **********************************/
-				:
-				/***** LIST OF INPUT OPERANDS ***********************************/
-				:  "r" (&elecStruct[electrodeNum].adcBasePtr->SC1[0]),  // operand %0
-				   "r" (elecStruct[electrodeNum].adcChNum),             // operand %1
-				   "r" (&elecStruct[electrodeNum].gpioBasePtr->PDDR),   // operand %2
-				   "r" ((elecStruct[electrodeNum].gpioBasePtr->PDDR) & ~(elecStruct[electrodeNum].portMask))    // operand %3
-		);
-#else
-		// Start Cext voltage ADC conversion
-		elecStruct[electrodeNum].adcBasePtr->SC1[0] = elecStruct[electrodeNum].adcChNum;
-
-		// Redistribute Electrode and Cext charge
-		ChargeRedistribution(&elecStruct[electrodeNum]);
-#endif
-		// Equivalent voltage digitalization
-		adcDataElectrodeDischargeRawSample[sampleNum] = EquivalentVoltageDigitalization(&elecStruct[electrodeNum]);
+		chargeDistributionPeriod = elecData[electrode0Num].elecChargeDistributionPeriod;
+	}
+	else
+	{
+		chargeDistributionPeriod = elecData[electrode1Num].elecChargeDistributionPeriod;
+	}
 
-#if JITTERING
-#if (JITTERING_OPTION == 2)
-		// Jitter sample rate
-		Jitter(adcDataElectrodeDischargeRaw[electrodeNum][frequencyID]);
-#endif
-#endif
+	// Electrodes Cext on the same ADC?
+	if (elecStruct[electrode0Num].adcBasePtr == elecStruct[electrode1Num].adcBasePtr)
+	{
+		// ADC sample time
+		if (elecData[electrode0Num].elecAdcSampleTime > elecData[electrode1Num].elecAdcSampleTime)
+		{
+			elecStruct[electrode0Num].adcBasePtr->CFG2 = elecData[electrode0Num].elecAdcSampleTime;
+		}
+		else
+		{
+			elecStruct[electrode0Num].adcBasePtr->CFG2 = elecData[electrode1Num].elecAdcSampleTime;
+		}
+	}
+	else
+	{
+		// ADC sample time of each ADC
+		elecStruct[electrode0Num].adcBasePtr->CFG2 = elecData[electrode0Num].elecAdcSampleTime;
+		elecStruct[electrode1Num].adcBasePtr->CFG2 = elecData[electrode1Num].elecAdcSampleTime;
 	}
 
-#if(TS_RAW_DATA_CALCULATION == OVERSAMPLING)
-	// Calculate samples sum
-	adcDataElectrodeDischargeRawCalc = 0;
-	for (sampleNum = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSample); sampleNum++)
+#if TS_ADAPTIVE_SENSING_CYCLES
+	// Sensing cycles per sample, the noisier electrode sets the number for both
+	if (elecData[electrode0Num].elecSensingCyclesPerSample > elecData[electrode1Num].elecSensingCyclesPerSample)
+	{
+		electrodeSensingCyclesPerSample = elecData[electrode0Num].elecSensingCyclesPerSample;
+	}
+	else
 	{
-		adcDataElectrodeDischargeRawCalc = adcDataElectrodeDischargeRawCalc + adcDataElectrodeDischargeRawSample[sampleNum];
+		electrodeSensingCyclesPerSample = elecData[electrode1Num].elecSensingCyclesPerSample;
 	}
-	adcDataElectrodeDischargeRaw[electrodeNum][frequencyID] = adcDataElectrodeDischargeRawCalc;
 
-#elif(TS_RAW_DATA_CALCULATION == AVERAGING)
-	// Calculate samples value average
-	adcDataElectrodeDischargeRawCalc = 0;
-	for (sampleNum = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSample); sampleNum++)
+	// Not more than the actual (idle or active) number of sensing cycles
+	if (electrodeSensingCyclesPerSample > numberOfElectrodeSensingCyclesPerSample)
 	{
-		adcDataElectrodeDischargeRawCalc = adcDataElectrodeDischargeRawCalc + adcDataElectrodeDischargeRawSample[sampleNum];
+		electrodeSensingCyclesPerSample = numberOfElectrodeSensingCyclesPerSample;
 	}
-	adcDataElectrodeDischargeRaw[electrodeNum][frequencyID] = (int32_t)(adcDataElectrodeDischargeRawCalc / numberOfElectrodeSensingCyclesPerSample);
 #else
-#error Please select valid TS method in ts_cfg_general.h
-#endif
-
-#ifdef DEBUG_ELECTRODE_SENSE
-	// Pin set
-	R_RMW32(&(DES_GPIO->PSOR), DES_PIN, 1);
+	// Actual (idle or active) number of sensing cycles
+	electrodeSensingCyclesPerSample = numberOfElectrodeSensingCyclesPerSample;
 #endif
-
-	// Set ADCs gain back to calibrated value
-	SetADCsGain();
 }
 
 /*****************************************************************************
  *
- * Function: void ElectodeBufferInitVal(int32_t inputSignal, int32_t *outputSignalPtr, uint16_t *sumCounterPtr)
+ * Function: void ElectrodeTimingReset(void)
  *
- * Description: Sum data
+ * Description: Set default charge distribution period and ADC sample time (slider electrodes)
  *
  *****************************************************************************/
-void ElectodeBufferInitVal(int32_t inputSignal, int32_t *outputSignalPtr, uint16_t *sumCounterPtr)
+void ElectrodeTimingReset(void)
 {
-	int32_t  outputSignal;
-	uint16_t sumCounter;
-
-
-	outputSignal = *outputSignalPtr;
-	sumCounter = *sumCounterPtr;
+	// Default charge distribution period
+	chargeDistributionPeriod = 0;
 
-	sumCounter++;
-	outputSignal = outputSignal + inputSignal;
+	// Default ADC sample time
+	ADC0->CFG2 = ADC_SAMPLE_TIME_SW;
+	ADC1->CFG2 = ADC_SAMPLE_TIME_SW;
 
-	*outputSignalPtr = outputSignal;
-	*sumCounterPtr = sumCounter;
+	// Actual (idle or active) number of sensing cycles
+	electrodeSensingCyclesPerSample = numberOfElectrodeSensingCyclesPerSample;
 }
 
+#if TS_TIMING_AUTOTUNE
 /*****************************************************************************
  *
- * Function: void ElectodeCalInitVal(int32_t *outputSignalPtr, uint16_t *sumCounterPtr)
+ * Function: void ElectrodeTimingTune(void)
  *
- * Description: Calculate data average value
+ * Description: Evaluate raw data noise and level of all touch button (and EGS) electrodes
+ * 				for the acquisition timing candidate, after all candidates are evaluated,
+ * 				load each electrode the shortest candidate reaching the target SNR
+ *
+ * Note: Called once per self-trim scan, before DC tracker self-trim
+ * 		 Touch threshold delta is set up with the reference candidate timing. A shorter
+ * 		 charge distribution or ADC sample time leaves less charge on Cext, touch signal
+ * 		 drops with the raw data level, so the delta is scaled by the candidate raw data
+ * 		 level to the reference one (never up) before it is compared with the noise.
  *
  *****************************************************************************/
-void ElectodeCalInitVal(int32_t *outputSignalPtr, uint16_t *sumCounterPtr)
+void ElectrodeTimingTune(void)
 {
-	int32_t  outputSignal;
-	uint16_t sumCounter;
+	uint32_t  elecNum;
+	int32_t   touchDelta;
 
+	// All touch button (and EGS) electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+	{
+		// First scan of the candidate?
+		if ((timingTuneScan == 0) || (elecData[elecNum].adcDataElectrodeDischargeRaw[frequencyID] < timingTuneRawMin[elecNum]))
+		{
+			// Raw data minimum
+			timingTuneRawMin[elecNum] = elecData[elecNum].adcDataElectrodeDischargeRaw[frequencyID];
+		}
+		// First scan of the candidate?
+		if ((timingTuneScan == 0) || (elecData[elecNum].adcDataElectrodeDischargeRaw[frequencyID] > timingTuneRawMax[elecNum]))
+		{
+			// Raw data maximum
+			timingTuneRawMax[elecNum] = elecData[elecNum].adcDataElectrodeDischargeRaw[frequencyID];
+		}
+		// First scan of the candidate?
+		if (timingTuneScan == 0)
+		{
+			// Reset raw data level
+			timingTuneRawSum[elecNum] = 0;
+		}
+		// Raw data level
+		timingTuneRawSum[elecNum] += elecData[elecNum].adcDataElectrodeDischargeRaw[frequencyID];
+	}
 
-	outputSignal = *outputSignalPtr;
-	sumCounter = *sumCounterPtr;
+	// Next scan
+	timingTuneScan++;
 
-	outputSignal = outputSignal / sumCounter;
+	// Last scan of the candidate?
+	if (timingTuneScan >= NUMBER_OF_TIMING_TUNE_SCANS)
+	{
+		// All touch button (and EGS) electrodes
+		for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+		{
+			// Reference candidate?
+			if (timingTuneCandidate == TIMING_TUNE_REFERENCE_CANDIDATE)
+			{
+				// Raw data level the touch threshold delta belongs to
+				timingTuneRawSumReference[elecNum] = timingTuneRawSum[elecNum];
+			}
 
-	*outputSignalPtr = outputSignal;
-	*sumCounterPtr = TOUCH_SENSE_APP_PWRUP_INIT_DONE;
-}
+			// Touch threshold delta expected with the candidate timing
+			touchDelta = elecData[elecNum].detectorThresholdTouchDelta;
+			// Candidate raw data level lower than the reference one?
+			if (timingTuneRawSum[elecNum] < timingTuneRawSumReference[elecNum])
+			{
+				// Scale touch threshold delta with the raw data level
+				touchDelta = (int32_t)(((int64_t)touchDelta * timingTuneRawSum[elecNum]) / timingTuneRawSumReference[elecNum]);
+			}
 
-/*****************************************************************************
- *
- * Function: int32_t DCTracker(int32_t inputSignal, int32_t *outputSignalRawPtr, uint8_t shift)
- *
- * Description: DC tracker (baseline) filter
- *
- *****************************************************************************/
-int32_t DCTracker(int32_t inputSignal, int32_t *outputSignalRawPtr, uint8_t shift)
-{	
-	int32_t  outputSignalRaw;
+			// Shorter than the best candidate so far and touch threshold delta reaches target SNR?
+			if ((timingTuneCandidate < elecTimingTuneResult[elecNum]) &&
+					((timingTuneRawMax[elecNum] - timingTuneRawMin[elecNum]) * TIMING_TUNE_TARGET_SNR <= touchDelta))
+			{
+				// The shortest candidate reaching target SNR
+				elecTimingTuneResult[elecNum] = timingTuneCandidate;
+			}
+		}
+
+		// Next candidate, the reference one is skipped after the first step
+		timingTuneStep++;
+		timingTuneCandidate = (timingTuneStep <= TIMING_TUNE_REFERENCE_CANDIDATE) ? (timingTuneStep - 1) : timingTuneStep;
+		timingTuneScan = 0;
+
+		// All candidates evaluated?
+		if (timingTuneStep >= NUMBER_OF_TIMING_TUNE_CANDIDATES)
+		{
+			// All touch button (and EGS) electrodes
+			for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+			{
+				// Electrode not reaching target SNR?
+				if (elecTimingTuneResult[elecNum] == NUMBER_OF_TIMING_TUNE_CANDIDATES)
+				{
+					// The longest candidate
+					elecTimingTuneResult[elecNum] = NUMBER_OF_TIMING_TUNE_CANDIDATES - 1;
+				}
+
+				// Load electrode acquisition timing
+				elecData[elecNum].elecChargeDistributionPeriod = timingTuneChargeDistributionPeriod[elecTimingTuneResult[elecNum]];
+				elecData[elecNum].elecAdcSampleTime = timingTuneAdcSampleTime[elecTimingTuneResult[elecNum]];
+			}
+
+			// Set electrode status "timing tune done" flag
+			electrodesStatus.bit.timingTuneDone = YES;
+		}
+		else
+		{
+			// All touch button (and EGS) electrodes
+			for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+			{
+				// Load the next candidate
+				elecData[elecNum].elecChargeDistributionPeriod = timingTuneChargeDistributionPeriod[timingTuneCandidate];
+				elecData[elecNum].elecAdcSampleTime = timingTuneAdcSampleTime[timingTuneCandidate];
+			}
+		}
+	}
+}
+#endif
+
+/*****************************************************************************
+ *
+ * Function: void ElectrodeRawDataCalc(uint32_t electrodeNum, tTrimAcc *accPtr)
+ *
+ * Input: Electrode number, samples accumulator of the electrode (pre-cycles excluded)
+ *
+ * Description: Calculate electrode raw data as a samples sum (oversampling) or samples average (averaging)
+ * 				of the trimmed samples, scaled to the actual (idle or active) number of sensing cycles
+ *
+ *****************************************************************************/
+void ElectrodeRawDataCalc(uint32_t electrodeNum, tTrimAcc *accPtr)
+{
+	int32_t  rawData;
+
+	// Trimmed samples sum, reduced resolution samples scaled to 12-bit range
+	adcDataElectrodeDischargeRawCalc = TrimAccSum(accPtr) << (ADC_RESOLUTION_12BIT - adcResolution);
+
+#if(TS_RAW_DATA_CALCULATION == OVERSAMPLING)
+	// Samples sum scaled to the actual (idle or active) number of sensing cycles
+	rawData = (adcDataElectrodeDischargeRawCalc * numberOfElectrodeSensingCyclesPerSample) / TrimAccSamplesNum(accPtr);
+#elif(TS_RAW_DATA_CALCULATION == AVERAGING)
+	// Samples value average
+	rawData = (int32_t)(adcDataElectrodeDischargeRawCalc / TrimAccSamplesNum(accPtr));
+#else
+#error Please select valid TS method in ts_cfg_general.h
+#endif
+
+#if TS_DEFERRED_PROCESSING
+	// Scan acquired for deferred processing?
+	if (acqFramePtr != 0)
+	{
+		// Store raw data to the acquisition frame
+		acqFramePtr->elecRaw[electrodeNum] = rawData;
+	}
+	else
+#endif
+	{
+		// Store raw data to the electrode processing state
+		elecData[electrodeNum].adcDataElectrodeDischargeRaw[frequencyID] = rawData;
+	}
+}
+
+#if TS_SEQUENTIAL_TERMINATION
+/*****************************************************************************
+ *
+ * Function: uint8_t ElectrodeSequentialTest(uint32_t electrodeNum, int16_t sample, uint32_t samplesNum)
+ *
+ * Input: Electrode number, last sample, number of samples taken (pre-cycles excluded)
+ *
+ * Output: 1 - raw data clearly above or below both touch and release thresholds, 0 - continue
+ *
+ * Description: Sequential test of the electrode samples burst, full burst raw data predicted
+ * 				from the samples is compared with touch and release thresholds, standard deviation
+ * 				estimated from the samples, variance of the samples not taken included
+ *
+ * Note: Comparisons are done with squares multiplied by samplesNum(samplesNum - 1)N, no division
+ *
+ *****************************************************************************/
+uint8_t ElectrodeSequentialTest(uint32_t electrodeNum, int16_t sample, uint32_t samplesNum)
+{
+	int32_t   scale;
+	int64_t   distanceTouch, distanceRelease, spread;
+
+	// Accumulate samples
+	sequentialTestSum += sample;
+	sequentialTestSumSquare += (int32_t)sample * sample;
+	sequentialTestSamplesNum = samplesNum;
+
+	// Thresholds valid and enough samples for variance estimate?
+	if ((electrodesStatus.bit.selfTrimDone == 0) || (samplesNum < SEQUENTIAL_TEST_MIN_CYCLES))
+	{
+		return 0;
+	}
+
+	// Sample to raw data scale, reduced resolution scaled to 12-bit
+#if(TS_RAW_DATA_CALCULATION == OVERSAMPLING)
+	scale = numberOfElectrodeSensingCyclesPerSample << (ADC_RESOLUTION_12BIT - adcResolution);
+#else
+	scale = 1 << (ADC_RESOLUTION_12BIT - adcResolution);
+#endif
+
+	// Raw data estimate distance from thresholds, multiplied by samplesNum
+	distanceTouch = ((int64_t)sequentialTestSum * scale) - ((int64_t)elecData[electrodeNum].detectorThresholdTouch * samplesNum);
+	distanceRelease = ((int64_t)sequentialTestSum * scale) - ((int64_t)elecData[electrodeNum].detectorThresholdRelease * samplesNum);
+
+	// Estimate not on the same side of both thresholds
+	if ((distanceTouch < 0) != (distanceRelease < 0))
+	{
+		return 0;
+	}
+
+	// Samples variance multiplied by samplesNum(samplesNum - 1), scaled to raw data and confidence
+	spread = ((int64_t)samplesNum * sequentialTestSumSquare) - ((int64_t)sequentialTestSum * sequentialTestSum);
+	spread = spread * scale * scale * (SEQUENTIAL_TEST_CONFIDENCE * SEQUENTIAL_TEST_CONFIDENCE);
+
+	// Interval widened by the variance of the samples not taken, (2N - n)/N of N sensing cycles burst
+	spread = spread * ((2 * electrodeSensingCyclesPerSample) - samplesNum);
+
+	// Both distances beyond confidence interval of the prediction?
+	if (((distanceTouch * distanceTouch * (samplesNum - 1) * electrodeSensingCyclesPerSample) > spread) && \
+			((distanceRelease * distanceRelease * (samplesNum - 1) * electrodeSensingCyclesPerSample) > spread))
+	{
+		return 1;
+	}
+
+	return 0;
+}
+#endif
+
+/*****************************************************************************
+ *
+ * Function: void ElectrodeCapToVoltConvELCH(uint32_t electrodeNum)
+ *
+ * Description: Convert electrode capacitance to equivalent voltage
+ *
+ *****************************************************************************/
+void ElectrodeCapToVoltConvELCH(uint32_t electrodeNum)
+{
+	int32_t   sampleNum;
+#if !TS_DMA_ACQUISITION
+	int16_t  sample;
+#endif
+#if TS_CORRELATED_DOUBLE_SAMPLING
+	int16_t  referenceSample;
+#endif
+
+	// Clear ADCs gain (lower noise)
+	ClearADCsGain();
+
+	// Load electrodes acquisition timing
+	ElectrodeTimingSet(electrodeNum, electrodeNum);
+
+#ifdef DEBUG_ELECTRODE_SENSE
+	// Pin clear
+	R_RMW32(&(DES_GPIO->PCOR), DES_PIN, 1);
+#endif
+
+	// Reset samples accumulator
+	TrimAccInit(&elecTrimAcc, ELEC_SAMPLES_REJECT_LOW, ELEC_SAMPLES_REJECT_HIGH);
+
+#if TS_DMA_ACQUISITION
+	// Load electrode sensing cycle sequence to DMA
+	DMA_ElectrodeSequenceSet(&elecStruct[electrodeNum], chargeDistributionPeriod, adcDataElectrodeDischargeRawSample, NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + electrodeSensingCyclesPerSample);
+
+	// Electrode capacitance to voltage conversion, wait for all samples
+	DMA_ElectrodeSequenceRun(&elecStruct[electrodeNum]);
+
+	// Accumulate samples, skip pre-cycles
+	for (sampleNum = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + electrodeSensingCyclesPerSample); sampleNum++)
+	{
+		TrimAccAdd(&elecTrimAcc, adcDataElectrodeDischargeRawSample[sampleNum]);
+	}
+#else
+#if TS_SEQUENTIAL_TERMINATION
+	// Reset sequential test
+	sequentialTestSum = 0;
+	sequentialTestSumSquare = 0;
+#endif
+
+	// Electrode capacitance to voltage conversion
+	for (sampleNum = 0; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + electrodeSensingCyclesPerSample); sampleNum++)
+	{
+#if(TS_ASM_OPTIMIZE == 1)
+		// Electrode low, Cext high, both pins GPIO
+		ChargeDistributionPinsSet(&elecStruct[electrodeNum]);
+		// Conversion kernel parameters, single distribution stage
+		ConversionKernelSet(&convKernel, elecStruct[electrodeNum].gpioBasePtr, elecStruct[electrodeNum].portMask, chargeDistributionPeriod,
+							elecStruct[electrodeNum].gpioBasePtr, elecStruct[electrodeNum].portMask, 0,
+							&(elecStruct[electrodeNum].adcBasePtr->SC1[0]), elecStruct[electrodeNum].adcChNum);
+		// Distribute charge, start Cext voltage ADC conversion and redistribute Electrode and Cext charge
+		ConversionKernelRun(&convKernel);
+#else
+		// Distribute Electrode and Cext charge
+		ChargeDistribution(&elecStruct[electrodeNum]);
+		// Delay to distribute charge
+		chargeDistributionPeriodTmp = chargeDistributionPeriod;
+		while (chargeDistributionPeriodTmp) {chargeDistributionPeriodTmp--;}
+
+#if TS_CORRELATED_DOUBLE_SAMPLING
+		// Start charged Cext reference level ADC conversion
+		elecStruct[electrodeNum].adcBasePtr->SC1[0] = elecStruct[electrodeNum].adcChNum;
+		// Cext reference level digitalization
+		referenceSample = EquivalentVoltageDigitalization(&elecStruct[electrodeNum]);
+#endif
+
+		// Start Cext voltage ADC conversion and redistribute Electrode and Cext charge
+		ConversionStartChargeRedistribution(&elecStruct[electrodeNum]);
+#endif
+
+		// Equivalent voltage digitalization
+		sample = EquivalentVoltageDigitalization(&elecStruct[electrodeNum]);
+
+#if TS_CORRELATED_DOUBLE_SAMPLING
+		// Subtract Cext reference level, offset by ADC full scale
+		sample = sample - referenceSample + ((1 << adcResolution) - 1);
+#endif
+
+#if JITTERING
+#if (JITTERING_OPTION == 2)
+		// Jitter sample rate
+		Jitter(elecData[electrodeNum].adcDataElectrodeDischargeRaw[frequencyID]);
+#endif
+#endif
+
+		// Pre-cycles done?
+		if (sampleNum >= NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE)
+		{
+			// Accumulate sample
+			TrimAccAdd(&elecTrimAcc, sample);
+
+#if TS_SEQUENTIAL_TERMINATION
+			// Electrode state already clear?
+			if (ElectrodeSequentialTest(electrodeNum, sample, sampleNum + 1 - NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE))
+			{
+				// Report saved sensing cycles
+				sequentialTestTerminations++;
+				sequentialTestCyclesSaved += electrodeSensingCyclesPerSample - sequentialTestSamplesNum;
+
+				// Stop the burst
+				break;
+			}
+#endif
+		}
+	}
+#endif
+
+	// Calculate electrode raw data from samples
+	ElectrodeRawDataCalc(electrodeNum, &elecTrimAcc);
+
+#ifdef DEBUG_ELECTRODE_SENSE
+	// Pin set
+	R_RMW32(&(DES_GPIO->PSOR), DES_PIN, 1);
+#endif
+
+	// Default acquisition timing
+	ElectrodeTimingReset();
+
+	// Set ADCs gain back to calibrated value
+	SetADCsGain();
+}
+
+#if DUAL_ADC_CONVERSION
+/*****************************************************************************
+ *
+ * Function: void ElectrodeDualADCPairInit(void)
+ *
+ * Description: Pair each touch button electrode with Cext on ADC0 with a touch button electrode with Cext on ADC1
+ *
+ * Note: Electrodes left without pair are converted one by one
+ *
+ *****************************************************************************/
+void ElectrodeDualADCPairInit(void)
+{
+	uint32_t  elecNum;
+	uint8_t electrodeNum;
+
+	// All touch button electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+		// Reset electrode pair partner
+		elecPairPartner[elecNum] = ELEC_PAIR_NONE;
+	}
+
+	// All touch button electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+		// Electrode Cext on ADC0?
+		if (elecStruct[elecNum].adcBasePtr == ADC0)
+		{
+			// Find touch button electrode with Cext on ADC1, which has no pair yet
+			for (electrodeNum = 0; electrodeNum < NUMBER_OF_TOUCH_ELECTRODES; electrodeNum++)
+			{
+				if ((elecStruct[electrodeNum].adcBasePtr == ADC1) && (elecPairPartner[electrodeNum] == ELEC_PAIR_NONE))
+				{
+					// Pair both electrodes
+					elecPairPartner[elecNum] = electrodeNum;
+					elecPairPartner[electrodeNum] = elecNum;
+
+					// Exit the for loop
+					break;
+				}
+			}
+		}
+	}
+}
+
+/*****************************************************************************
+ *
+ * Function: void ElectrodeSimultaneousCapToVoltConvELCH(uint32_t electrode0Num, uint32_t electrode1Num)
+ *
+ * Input: Electrode with Cext on ADC0 (electrode0Num) and electrode with Cext on ADC1 (electrode1Num)
+ *
+ * Description: Convert capacitance of a pair of touch button electrodes to equivalent voltage simultaneously - with both ADC modules at once (HW trigger)
+ *
+ * Note: Electrodes pins can be on the same or different port, ADCs_SimultaneousHWtrigger() must be called before
+ *
+ *****************************************************************************/
+void ElectrodeSimultaneousCapToVoltConvELCH(uint32_t electrode0Num, uint32_t electrode1Num)
+{
+	int32_t   sampleNum;
+	int16_t  sample0, sample1;
+#if TS_CORRELATED_DOUBLE_SAMPLING
+	int16_t  referenceSample0, referenceSample1;
+#endif
+
+	// Clear ADCs gain (lower noise)
+	ClearADCsGain();
+
+	// Load electrodes acquisition timing
+	ElectrodeTimingSet(electrode0Num, electrode1Num);
+
+#ifdef DEBUG_ELECTRODE_SENSE
+	// Pin clear
+	R_RMW32(&(DES_GPIO->PCOR), DES_PIN, 1);
+#endif
+
+	// Reset samples accumulators
+	TrimAccInit(&elecTrimAcc, ELEC_SAMPLES_REJECT_LOW, ELEC_SAMPLES_REJECT_HIGH);
+	TrimAccInit(&elecTrimAccPair, ELEC_SAMPLES_REJECT_LOW, ELEC_SAMPLES_REJECT_HIGH);
+
+	// Simultaneous electrodes capacitance to voltage conversion
+	for (sampleNum = 0; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + electrodeSensingCyclesPerSample); sampleNum++)
+	{
+#if(TS_ASM_OPTIMIZE == 1)
+		// Electrodes low, Cexts high, all pins GPIO
+		ChargeDistributionPinsSet(&elecStruct[electrode0Num]);
+		ChargeDistributionPinsSet(&elecStruct[electrode1Num]);
+
+		// Cext voltage conversion - channel PRE-assignment for both electrodes
+		elecStruct[electrode0Num].adcBasePtr->SC1[0] = elecStruct[electrode0Num].adcChNum;
+		elecStruct[electrode1Num].adcBasePtr->SC1[0] = elecStruct[electrode1Num].adcChNum;
+
+		// Conversion kernel parameters, both electrodes distributed before the delay, SW trigger to TRGMUX
+		ConversionKernelSet(&convKernel, elecStruct[electrode0Num].gpioBasePtr, elecStruct[electrode0Num].portMask, 0,
+							elecStruct[electrode1Num].gpioBasePtr, elecStruct[electrode1Num].portMask, chargeDistributionPeriod,
+							&(SIM->MISCTRL1), SIM_MISCTRL1_SW_TRG_MASK);
+		// Distribute charge, start Cext voltage conversion in both ADC modules and redistribute charge of both electrodes
+		ConversionKernelRun(&convKernel);
+#else
+		// Distribute Electrode and Cext charge of both electrodes
+		ChargeDistribution(&elecStruct[electrode0Num]);
+		ChargeDistribution(&elecStruct[electrode1Num]);
+		// Delay to distribute charge
+		chargeDistributionPeriodTmp = chargeDistributionPeriod;
+		while (chargeDistributionPeriodTmp) {chargeDistributionPeriodTmp--;}
+
+		// Cext voltage conversion - channel PRE-assignment for both electrodes
+		elecStruct[electrode0Num].adcBasePtr->SC1[0] = elecStruct[electrode0Num].adcChNum;
+		elecStruct[electrode1Num].adcBasePtr->SC1[0] = elecStruct[electrode1Num].adcChNum;
+
+#if TS_CORRELATED_DOUBLE_SAMPLING
+		// Start charged Cext reference level conversion in both ADC0 and ADC1 at the same time
+		SIM->MISCTRL1 = SIM_MISCTRL1_SW_TRG_MASK;
+		// Cext reference level digitalization for both electrodes at once
+		SimultaneousEquivalentVoltageDigitalization(&elecStruct[electrode0Num], &elecStruct[electrode1Num]);
+		// Store reference level of the first and second electrode, clear COCO flag
+		referenceSample0 = elecStruct[electrode0Num].adcBasePtr->R[0];
+		referenceSample1 = elecStruct[electrode1Num].adcBasePtr->R[0];
+#endif
+
+		// Generate SW trigger to TRGMUX -> and thus initiate the Cext voltage conversion in both ADC0 and ADC1 at the same time
+		// Optimization of code must be set the highest (-O3)
+		SIM->MISCTRL1 = SIM_MISCTRL1_SW_TRG_MASK;
+
+		// Redistribute Electrode and Cext charge of both electrodes
+		ChargeRedistribution(&elecStruct[electrode0Num]);
+		ChargeRedistribution(&elecStruct[electrode1Num]);
+#endif
+		// Equivalent voltage digitalization for both electrodes at once
+		SimultaneousEquivalentVoltageDigitalization(&elecStruct[electrode0Num], &elecStruct[electrode1Num]);
+
+		// Store result of the first and second electrode, clear COCO flag
+		sample0 = elecStruct[electrode0Num].adcBasePtr->R[0];
+		sample1 = elecStruct[electrode1Num].adcBasePtr->R[0];
+
+#if TS_CORRELATED_DOUBLE_SAMPLING
+		// Subtract Cext reference level, offset by ADC full scale
+		sample0 = sample0 - referenceSample0 + ((1 << adcResolution) - 1);
+		sample1 = sample1 - referenceSample1 + ((1 << adcResolution) - 1);
+#endif
+
+		// Pre-cycles done?
+		if (sampleNum >= NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE)
+		{
+			// Accumulate samples of both electrodes
+			TrimAccAdd(&elecTrimAcc, sample0);
+			TrimAccAdd(&elecTrimAccPair, sample1);
+		}
+
+#if JITTERING
+#if (JITTERING_OPTION == 2)
+		// Jitter sample rate
+		Jitter(elecData[electrode0Num].adcDataElectrodeDischargeRaw[frequencyID]);
+#endif
+#endif
+	}
+
+	// Calculate first and second electrode raw data from samples
+	ElectrodeRawDataCalc(electrode0Num, &elecTrimAcc);
+	ElectrodeRawDataCalc(electrode1Num, &elecTrimAccPair);
+
+#ifdef DEBUG_ELECTRODE_SENSE
+	// Pin set
+	R_RMW32(&(DES_GPIO->PSOR), DES_PIN, 1);
+#endif
+
+	// Default acquisition timing
+	ElectrodeTimingReset();
+
+	// Set ADCs gain back to calibrated value
+	SetADCsGain();
+}
+#endif
+
+#if TS_PIPELINED_CONVERSION
+/*****************************************************************************
+ *
+ * Function: void ElectrodePipelinedCapToVoltConvELCH(uint32_t electrode0Num, uint32_t electrode1Num)
+ *
+ * Description: Convert capacitance of two electrodes to equivalent voltage with sensing cycles interleaved,
+ * 				charge of one electrode is distributed while Cext voltage of the other electrode is converted
+ *
+ * Note: Electrodes Cext can be on the same or different ADC module (SW trigger)
+ * 		 Electrodes pins must be on different GPIO ports, PCR/PSOR/PDDR writes of the same port
+ * 		 during the other electrode Cext sample phase couple into the sampled voltage
+ *
+ *****************************************************************************/
+void ElectrodePipelinedCapToVoltConvELCH(uint32_t electrode0Num, uint32_t electrode1Num)
+{
+	int32_t   sampleNum;
+	int16_t  sample0, sample1;
+
+	// Clear ADCs gain (lower noise)
+	ClearADCsGain();
+
+	// Load electrodes acquisition timing
+	ElectrodeTimingSet(electrode0Num, electrode1Num);
+
+#ifdef DEBUG_ELECTRODE_SENSE
+	// Pin clear
+	R_RMW32(&(DES_GPIO->PCOR), DES_PIN, 1);
+#endif
+
+	// Reset samples accumulators
+	TrimAccInit(&elecTrimAcc, ELEC_SAMPLES_REJECT_LOW, ELEC_SAMPLES_REJECT_HIGH);
+	TrimAccInit(&elecTrimAccPair, ELEC_SAMPLES_REJECT_LOW, ELEC_SAMPLES_REJECT_HIGH);
+
+	// Distribute first electrode charge before the first sensing cycle
+	ChargeDistribution(&elecStruct[electrode0Num]);
+
+	// Interleaved electrodes capacitance to voltage conversion
+	for (sampleNum = 0; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + electrodeSensingCyclesPerSample); sampleNum++)
+	{
+		// Delay to distribute charge
+		chargeDistributionPeriodTmp = chargeDistributionPeriod;
+		while (chargeDistributionPeriodTmp) {chargeDistributionPeriodTmp--;}
+
+		// Start first electrode Cext voltage ADC conversion and redistribute Electrode and Cext charge
+		ConversionStartChargeRedistribution(&elecStruct[electrode0Num]);
+
+		// Distribute second electrode charge while first electrode Cext voltage is converted
+		ChargeDistribution(&elecStruct[electrode1Num]);
+
+		// First electrode equivalent voltage digitalization
+		sample0 = EquivalentVoltageDigitalization(&elecStruct[electrode0Num]);
+
+		// Delay to distribute charge
+		chargeDistributionPeriodTmp = chargeDistributionPeriod;
+		while (chargeDistributionPeriodTmp) {chargeDistributionPeriodTmp--;}
+
+		// Start second electrode Cext voltage ADC conversion and redistribute Electrode and Cext charge
+		ConversionStartChargeRedistribution(&elecStruct[electrode1Num]);
+
+		// Not the last sensing cycle?
+		if (sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + electrodeSensingCyclesPerSample - 1))
+		{
+			// Distribute first electrode charge for the next sensing cycle while second electrode Cext voltage is converted
+			ChargeDistribution(&elecStruct[electrode0Num]);
+		}
+
+		// Pre-cycles done?
+		if (sampleNum >= NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE)
+		{
+			// Accumulate first electrode sample while second electrode Cext voltage is converted
+			TrimAccAdd(&elecTrimAcc, sample0);
+		}
+
+		// Second electrode equivalent voltage digitalization
+		sample1 = EquivalentVoltageDigitalization(&elecStruct[electrode1Num]);
+
+		// Pre-cycles done?
+		if (sampleNum >= NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE)
+		{
+			// Accumulate second electrode sample
+			TrimAccAdd(&elecTrimAccPair, sample1);
+		}
+
+#if JITTERING
+#if (JITTERING_OPTION == 2)
+		// Jitter sample rate
+		Jitter(elecData[electrode0Num].adcDataElectrodeDischargeRaw[frequencyID]);
+#endif
+#endif
+	}
+
+	// Calculate first and second electrode raw data from samples
+	ElectrodeRawDataCalc(electrode0Num, &elecTrimAcc);
+	ElectrodeRawDataCalc(electrode1Num, &elecTrimAccPair);
+
+#ifdef DEBUG_ELECTRODE_SENSE
+	// Pin set
+	R_RMW32(&(DES_GPIO->PSOR), DES_PIN, 1);
+#endif
+
+	// Default acquisition timing
+	ElectrodeTimingReset();
+
+	// Set ADCs gain back to calibrated value
+	SetADCsGain();
+}
+#endif
+
+/*****************************************************************************
+ *
+ * Function: void ElectrodesCapToVoltConv(void)
+ *
+ * Description: Convert all touch button electrodes capacitance to equivalent voltage
+ *
+ *****************************************************************************/
+void ElectrodesCapToVoltConv(void)
+{
+	uint32_t  elecNum, scanMask;
+
+#if TS_PIPELINED_CONVERSION
+	uint8_t electrodePending;
+#endif
+
+	// Enabled electrodes
+	scanMask = elecEnabledMask;
+
+#if TS_ROI_SCAN
+	// Electrodes scheduled for this period
+	scanMask &= elecRoiScanMask;
+
+#if DUAL_ADC_CONVERSION
+	// All touch button electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+		// Scheduled electrode paired? Its enabled pair is converted at once
+		if ((elecPairPartner[elecNum] != ELEC_PAIR_NONE) && (scanMask & (1 << elecNum)))
+		{
+			scanMask |= (1 << elecPairPartner[elecNum]) & elecEnabledMask;
+		}
+	}
+#endif
+#endif
+
+#if DUAL_ADC_CONVERSION
+	// Preset configuration for both ADC0 and ADC1 for voltage digitalization at the same time
+	ADCs_SimultaneousHWtrigger();
+
+	// All touch button electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+		// Electrode not scanned in this period?
+		if ((scanMask & (1 << elecNum)) == 0)
+		{
+			continue;
+		}
+
+		// Electrode with Cext on ADC0 paired with scanned electrode with Cext on ADC1?
+		if ((elecPairPartner[elecNum] != ELEC_PAIR_NONE) && (elecStruct[elecNum].adcBasePtr == ADC0) && (scanMask & (1 << elecPairPartner[elecNum])))
+		{
+			// Convert both electrodes of the pair capacitance to equivalent voltage simultaneously - at once
+			ElectrodeSimultaneousCapToVoltConvELCH(elecNum, elecPairPartner[elecNum]);
+		}
+	}
+
+	// Reset configuration for both ADC0 and ADC1 for voltage digitalization one by one
+	ADCs_SetBackToSWtrigger();
+#endif
+
+#if TS_PIPELINED_CONVERSION
+	// No electrode waiting for pipelined conversion
+	electrodePending = ELEC_PAIR_NONE;
+#endif
+
+	// All touch button electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+		// Electrode not scanned in this period?
+		if ((scanMask & (1 << elecNum)) == 0)
+		{
+			continue;
+		}
+#if DUAL_ADC_CONVERSION
+		// Electrode without pair or its pair not scanned?
+		if ((elecPairPartner[elecNum] == ELEC_PAIR_NONE) || ((scanMask & (1 << elecPairPartner[elecNum])) == 0))
+#endif
+		{
+#if TS_PIPELINED_CONVERSION
+			// First electrode of the pipelined couple?
+			if (electrodePending == ELEC_PAIR_NONE)
+			{
+				// Wait for the second electrode
+				electrodePending = elecNum;
+			}
+			// Waiting electrode on the same GPIO port?
+			else if (elecStruct[electrodePending].gpioBasePtr == elecStruct[elecNum].gpioBasePtr)
+			{
+				// Convert electrode capacitance to equivalent voltage, keep waiting for an other port electrode
+				ElectrodeCapToVoltConvELCH(elecNum);
+			}
+			else
+			{
+				// Convert both electrodes capacitance to equivalent voltage with sensing cycles interleaved
+				ElectrodePipelinedCapToVoltConvELCH(electrodePending, elecNum);
+				// Couple done
+				electrodePending = ELEC_PAIR_NONE;
+			}
+#else
+			// Convert electrode capacitance to equivalent voltage
+			ElectrodeCapToVoltConvELCH(elecNum);
+#endif
+		}
+	}
+
+#if TS_PIPELINED_CONVERSION
+	// Odd electrode left?
+	if (electrodePending != ELEC_PAIR_NONE)
+	{
+		// Convert electrode capacitance to equivalent voltage
+		ElectrodeCapToVoltConvELCH(electrodePending);
+	}
+#endif
+
+#if TS_DEFERRED_PROCESSING
+	// Scan acquired for deferred processing?
+	if (acqFramePtr != 0)
+	{
+		// Report scanned electrodes in the acquisition frame
+		acqFramePtr->elecScanMask = scanMask;
+	}
+	else
+#endif
+	{
+		// Report scanned electrodes
+		elecScannedMask = scanMask;
+	}
+}
+
+/*****************************************************************************
+ *
+ * Function: void ElectodeBufferInitVal(int32_t inputSignal, int32_t *outputSignalPtr, uint16_t *sumCounterPtr)
+ *
+ * Description: Sum data
+ *
+ *****************************************************************************/
+void ElectodeBufferInitVal(int32_t inputSignal, int32_t *outputSignalPtr, uint16_t *sumCounterPtr)
+{
+	int32_t  outputSignal;
+	uint16_t sumCounter;
+
+
+	outputSignal = *outputSignalPtr;
+	sumCounter = *sumCounterPtr;
+
+	sumCounter++;
+	outputSignal = outputSignal + inputSignal;
+
+	*outputSignalPtr = outputSignal;
+	*sumCounterPtr = sumCounter;
+}
+
+/*****************************************************************************
+ *
+ * Function: void ElectodeCalInitVal(int32_t *outputSignalPtr, uint16_t *sumCounterPtr)
+ *
+ * Description: Calculate data average value
+ *
+ *****************************************************************************/
+void ElectodeCalInitVal(int32_t *outputSignalPtr, uint16_t *sumCounterPtr)
+{
+	int32_t  outputSignal;
+	uint16_t sumCounter;
+
+
+	outputSignal = *outputSignalPtr;
+	sumCounter = *sumCounterPtr;
+
+	outputSignal = outputSignal / sumCounter;
+
+	*outputSignalPtr = outputSignal;
+	*sumCounterPtr = TOUCH_SENSE_APP_PWRUP_INIT_DONE;
+}
+
+#if TS_SELF_TRIM_CONVERGENCE
+/*****************************************************************************
+ *
+ * Function: void ElectodeVarAcc(int32_t inputSignal, tSelfTrimVar *varPtr, uint16_t sumCounter)
+ *
+ * Description: Accumulate deviation of the self-trim sample from the first sample, squared and
+ * 				weighted by the sample index, call before ElectodeBufferInitVal() increments sumCounter
+ *
+ *****************************************************************************/
+void ElectodeVarAcc(int32_t inputSignal, tSelfTrimVar *varPtr, uint16_t sumCounter)
+{
+	int32_t  deviation;
+
+	// First sample?
+	if (sumCounter == 0)
+	{
+		varPtr->firstSample = inputSignal;
+		varPtr->sumSquare = 0;
+		varPtr->sumIndexed = 0;
+	}
+
+	// Deviation from the first sample, keeps the sums small
+	deviation = inputSignal - varPtr->firstSample;
+	varPtr->sumSquare += (int64_t)deviation * deviation;
+	varPtr->sumIndexed += (int64_t)sumCounter * deviation;
+}
+
+/*****************************************************************************
+ *
+ * Function: uint8_t ElectodeVarSettled(int32_t inputSignal, int32_t *sumPtr, tSelfTrimVar *varPtr,
+ * 										uint16_t *sumCounterPtr, int16_t touchDelta)
+ *
+ * Description: Self-trim baseline settled? With n samples, S and Q sum and sum of squares
+ * 				of the deviations from the first sample, I sum of the deviations weighted by index:
+ * 				- baseline (samples mean) variance, i.e. samples variance / n, at most
+ * 				  (touchDelta / SELF_TRIM_TARGET_SNR)^2: (n*Q - S^2) * SNR^2 <= touchDelta^2 * n^2 * (n-1)
+ * 				- least squares trend over the samples at most touchDelta / SELF_TRIM_DRIFT_SNR:
+ * 				  |n*I - Si*S| * n * SNR <= touchDelta * (n*Sii - Si^2), Si, Sii sums of i and i^2
+ * 				Drifting electrode restarts its samples from inputSignal (the latest sample).
+ *
+ *****************************************************************************/
+uint8_t ElectodeVarSettled(int32_t inputSignal, int32_t *sumPtr, tSelfTrimVar *varPtr, uint16_t *sumCounterPtr, int16_t touchDelta)
+{
+	int64_t  n, sumDeviation, sumIndex, sumIndexSquare, trend;
+
+	// Not enough samples yet?
+	if (*sumCounterPtr < SELF_TRIM_MIN_CYCLES)
+	{
+		return NO;
+	}
+
+	n = *sumCounterPtr;
+	// Sum of the deviations from the first sample
+	sumDeviation = (int64_t)(*sumPtr) - (n * varPtr->firstSample);
+	// Sums of the sample indexes and their squares
+	sumIndex = (n * (n - 1)) / 2;
+	sumIndexSquare = ((n - 1) * n * (2 * n - 1)) / 6;
+
+	// Trend over the samples
+	trend = (n * varPtr->sumIndexed) - (sumIndex * sumDeviation);
+	if (trend < 0)
+	{
+		trend = -trend;
+	}
+
+	// Drifting?
+	if (trend * n * SELF_TRIM_DRIFT_SNR > (int64_t)touchDelta * ((n * sumIndexSquare) - (sumIndex * sumIndex)))
+	{
+		// Restart samples from the latest one
+		*sumPtr = inputSignal;
+		*sumCounterPtr = 1;
+		varPtr->firstSample = inputSignal;
+		varPtr->sumSquare = 0;
+		varPtr->sumIndexed = 0;
+
+		return NO;
+	}
+
+	// Baseline variance within the bound?
+	if (((n * varPtr->sumSquare) - (sumDeviation * sumDeviation)) * (SELF_TRIM_TARGET_SNR * SELF_TRIM_TARGET_SNR) <= \
+			((int64_t)touchDelta * touchDelta) * n * n * (n - 1))
+	{
+		return YES;
+	}
+
+	return NO;
+}
+#endif
+
+/*****************************************************************************
+ *
+ * Function: int32_t DCTracker(int32_t inputSignal, int32_t *outputSignalRawPtr, uint8_t shift, int16_t *slewRunPtr)
+ *
+ * Description: DC tracker (baseline) filter
+ *
+ * Note: With TS_DCTRACKER_ADAPTIVE_SLEW the step doubles every DCTRACKER_SLEW_PERSISTENCE
+ * 		 consecutive samples above the baseline (release direction), up to 2^DCTRACKER_SLEW_MAX_LOG2,
+ * 		 never stepping over the input. slewRunPtr counts the samples. Below the baseline
+ * 		 (touch direction: hover, slow approach, neighbour coupling) the step stays 1.
+ * 		 slewRunPtr NULL keeps the fixed step in both directions (wake-up EGS electrode).
+ *
+ *****************************************************************************/
+int32_t DCTracker(int32_t inputSignal, int32_t *outputSignalRawPtr, uint8_t shift, int16_t *slewRunPtr)
+{	
+	int32_t  outputSignalRaw;
+#if TS_DCTRACKER_ADAPTIVE_SLEW
+	int32_t  slewStep;
+	int16_t  slewRun;
+#endif
 
 
 	outputSignalRaw = *outputSignalRawPtr;
 
-	if(inputSignal > (outputSignalRaw >> shift))
+#if TS_DCTRACKER_ADAPTIVE_SLEW
+	// Adaptive slew and input above baseline (release direction)?
+	if ((slewRunPtr != NULL) && (inputSignal > (outputSignalRaw >> shift)))
+	{
+		slewRun = *slewRunPtr;
+		if (slewRun < (DCTRACKER_SLEW_PERSISTENCE * DCTRACKER_SLEW_MAX_LOG2))
+		{
+			slewRun++;
+		}
+		*slewRunPtr = slewRun;
+
+		// Step doubled by the run persistence, limited by the error size
+		slewStep = 1 << (slewRun / DCTRACKER_SLEW_PERSISTENCE);
+		if (slewStep > ((inputSignal << shift) - outputSignalRaw))
+		{
+			slewStep = (inputSignal << shift) - outputSignalRaw;
+		}
+
+		outputSignalRaw = outputSignalRaw + slewStep;
+	}
+	else
+#endif
+	{
+#if TS_DCTRACKER_ADAPTIVE_SLEW
+		// Adaptive slew?
+		if (slewRunPtr != NULL)
+		{
+			// Release direction run restarted
+			*slewRunPtr = 0;
+		}
+#endif
+		if(inputSignal > (outputSignalRaw >> shift))
+		{
+			outputSignalRaw = outputSignalRaw + 1;
+		}
+		else if (inputSignal < (outputSignalRaw >> shift))
+		{
+			outputSignalRaw = outputSignalRaw - 1;
+		}
+	}
+
+#if (TS_DCTRACKER_ADAPTIVE_SLEW == 0)
+	// Fixed step, slew run not used
+	(void)slewRunPtr;
+#endif
+
+	*outputSignalRawPtr = outputSignalRaw;
+
+	return  (outputSignalRaw >> shift);
+}
+/*****************************************************************************
+ *
+ * Function: void DCTrackerShiftIncrease(void)
+ *
+ * Description: DCtrackershift increase
+ *
+ *****************************************************************************/
+void DCTrackerShiftIncrease(void)
+{
+	uint32_t  elecNum;
+
+	// All touch button electrodes
+	for(elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+		// Load new shift to update the DC tracker
+		elecData[elecNum].DCTrackerDataShift = ELEC_DCTRACKER_FILTER_FACTOR_ACTIVE;
+	}
+
+	// All touch button electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+		// Load DC tracker buffer
+		elecData[elecNum].DCTrackerDataBufferRaw = (elecData[elecNum].DCTrackerDataBuffer) << ((elecData[elecNum].DCTrackerDataShift));
+	}
+}
+
+/*****************************************************************************
+ *
+ * Function: void DCTrackerShiftDecrease(void)
+ *
+ * Description: DCtrackershift decrease
+ *
+ *****************************************************************************/
+void DCTrackerShiftDecrease(void)
+{
+	uint32_t  elecNum;
+
+	// All touch button electrodes
+	for(elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+		// Load new shift to update the DC tracker
+		elecData[elecNum].DCTrackerDataShift = ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
+	}
+
+	// All touch button electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+		// Load DC tracker buffer
+		elecData[elecNum].DCTrackerDataBufferRaw = (elecData[elecNum].DCTrackerDataBuffer) << ((elecData[elecNum].DCTrackerDataShift));
+	}
+}
+/*****************************************************************************
+ *
+ * Function: void ElectrodeSelfTrim(void)
+ *
+ * Description: Run electrode self-trim algorithm
+ *
+ *****************************************************************************/
+void ElectrodeSelfTrim(void)
+{
+	uint32_t  elecNum;
+
+	// Device after power-up / reset ?
+#if TS_SELF_TRIM_CONVERGENCE
+	if ((selfTrimScans < selfTrimCycles) && (selfTrimSettled == NO))
+#else
+	if (adcDataElectrodeDischargeBufferCounter[0] < selfTrimCycles)
+#endif
+	{
+#if TS_SELF_TRIM_CONVERGENCE
+		// Self-trim scan
+		selfTrimScans++;
+		// Settled unless any electrode is not
+		selfTrimSettled = YES;
+#endif
+
+		// All touch button (and EGS) electrodes
+		for (elecNum = 0; elecNum < (NUMBER_OF_ELECTRODES); elecNum++)
+		{
+#if TS_SELF_TRIM_CONVERGENCE
+			// Accumulate touch electrode samples spread
+			ElectodeVarAcc(elecData[elecNum].adcDataElectrodeDischargeRaw[frequencyID], &selfTrimVar[elecNum], adcDataElectrodeDischargeBufferCounter[elecNum]);
+#endif
+			// Store touch electrode init value
+			ElectodeBufferInitVal(elecData[elecNum].adcDataElectrodeDischargeRaw[frequencyID], &(adcDataElectrodeDischargeBuffer[elecNum]), &(adcDataElectrodeDischargeBufferCounter[elecNum]));
+#if TS_SELF_TRIM_CONVERGENCE
+			// Touch electrode baseline not settled yet?
+			if (ElectodeVarSettled(elecData[elecNum].adcDataElectrodeDischargeRaw[frequencyID], &(adcDataElectrodeDischargeBuffer[elecNum]), &selfTrimVar[elecNum], \
+					&(adcDataElectrodeDischargeBufferCounter[elecNum]), elecData[elecNum].detectorThresholdTouchDelta) == NO)
+			{
+				selfTrimSettled = NO;
+			}
+#endif
+		}
+	}
+	// Calculate and load init value
+	else
+	{
+		// All touch button (and EGS) electrodes
+		for (elecNum = 0; elecNum < (NUMBER_OF_ELECTRODES); elecNum++)
+		{
+			// Calculate touch electrode init value
+			ElectodeCalInitVal(&(adcDataElectrodeDischargeBuffer[elecNum]), &(adcDataElectrodeDischargeBufferCounter[elecNum]));
+		}
+
+		// Set electrode status "self-trim done" flag
+		electrodesStatus.bit.selfTrimDone = YES;
+	}
+}
+
+/*****************************************************************************
+ *
+ * Function: void electrodeTouchQualify(tSenseCtx *ctxPtr)
+ *
+ * Input: Sensing context of the scan
+ *
+ * Description: Qualify touch button electrode touch
+ *
+ *****************************************************************************/
+void electrodeTouchQualify(tSenseCtx *ctxPtr)
+{
+	tElecData  *elecDataBasePtr = ctxPtr->elecDataPtr;
+	uint8_t   scanFrequencyID = ctxPtr->frequencyID;
+	uint32_t  elecNum;
+
+	// For all touch button electrodes check touch event
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+#if FREQUENCY_HOPPING
+		// Electrode has been touched on both scanning frequencies?
+		if ((elecDataBasePtr[elecNum].electrodeTouch[0] == 1) && (elecDataBasePtr[elecNum].electrodeTouch[1] == 1)  && (electrodeTouchNumberPlusOne == 0) &&
+				numberOfElectrodeSensingCyclesPerSample == NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE && scanFrequencyID == 1)
+#else
+			// Electrode has been touched?
+			if ((elecDataBasePtr[elecNum].electrodeTouch[scanFrequencyID] == 1) && (electrodeTouchNumberPlusOne == 0) &&
+					numberOfElectrodeSensingCyclesPerSample == NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE)
+#endif
+			{
+				// Report electrode touch
+				electrodeTouchQualifiedReport = 1;
+
+				// Report electrode touch
+				electrodeTouchQualified[elecNum] = 1;
+
+				// Load electrode number + 1
+				electrodeTouchNumberPlusOne = elecNum + 1;
+			}
+
+		// Any electrode touched?
+		if (electrodeTouchNumberPlusOne != 0)
+		{
+#if FREQUENCY_HOPPING
+			// Electrode, that was touched, has been released on first or second scanning frequency?
+			if((elecDataBasePtr[(electrodeTouchNumberPlusOne - 1)].electrodeTouch[0] == 0) || (elecDataBasePtr[(electrodeTouchNumberPlusOne - 1)].electrodeTouch[1] == 0))
+#else
+				// Electrode, that was touched, has been released?
+				if(elecDataBasePtr[(electrodeTouchNumberPlusOne - 1)].electrodeTouch[scanFrequencyID] == 0)
+#endif
+				{
+					// Report electrode release
+					electrodeTouchQualifiedReport = 0;
+					// Report electrode release
+					electrodeTouchQualified[(electrodeTouchNumberPlusOne - 1)] = 0;
+					// Reset
+					electrodeTouchNumberPlusOne = 0;
+				}
+		}
+	}
+}
+
+/*****************************************************************************
+ *
+ * Function: void ElectrodeTouchDetect(uint32_t electrodeNum, tSenseCtx *ctxPtr)
+ *
+ * Input: Electrode number, sensing context of the scan
+ *
+ * Description: Detect touch button electrode touch
+ *
+ *****************************************************************************/
+void ElectrodeTouchDetect(uint32_t electrodeNum, tSenseCtx *ctxPtr)
+{
+	tElecData  *elecDataPtr = &ctxPtr->elecDataPtr[electrodeNum];
+	uint8_t   scanFrequencyID = ctxPtr->frequencyID;
+
+	// Touch button Electrode touched ?
+	if (elecDataPtr->LPFilterData[scanFrequencyID] < elecDataPtr->detectorThresholdTouch)
 	{
-		outputSignalRaw = outputSignalRaw + 1;
+		// Touched
+		elecDataPtr->electrodeTouch[scanFrequencyID] = 1;
+
+#ifdef WAKE_UP_ELECTRODE
+		// Load counter to do not return to the wake-up function
+		// Do not return to the wake-up function, when electrode released and electrode signal value is above touch and bellow release threshold
+		// Expected SR <= 1s
+		electrodeWakeUpActivateCounter = ELEC_WAKEUP_ACTIVATE_COUNTER;
+#else
+		// Load counter to prevent switching of number of samples per cycle to idle
+		electrodesVirtualEGSActivateCounter = ELEC_WAKEUP_ACTIVATE_COUNTER;
+#endif
 	}
-	else if (inputSignal < (outputSignalRaw >> shift))
+	// Electrode released?
+	else if ((elecDataPtr->LPFilterData[scanFrequencyID] > elecDataPtr->detectorThresholdRelease) && (elecDataPtr->electrodeTouch[scanFrequencyID] == 1))
 	{
-		outputSignalRaw = outputSignalRaw - 1;
+		// Released
+		elecDataPtr->electrodeTouch[scanFrequencyID] = 0;
 	}
+}
 
-	*outputSignalRawPtr = outputSignalRaw;
+#if TS_ROI_SCAN
+/*****************************************************************************
+ *
+ * Function: void ElectrodeRoiScanUpdate(tSenseCtx *ctxPtr)
+ *
+ * Input: Sensing context of the scan
+ *
+ * Description: Schedule touch button electrodes scan of the next period - touched electrodes
+ * 				and their neighbours every period, the other electrodes in rotation once per
+ * 				ROI_BACKGROUND_SCAN_PERIODS periods, all electrodes while none touched
+ *
+ *****************************************************************************/
+void ElectrodeRoiScanUpdate(tSenseCtx *ctxPtr)
+{
+	tElecData  *elecDataBasePtr = ctxPtr->elecDataPtr;
+	uint32_t  elecNum, roiMask;
+	uint8_t   frequencyNum;
 
-	return  (outputSignalRaw >> shift);
+	// Once per period, after the last period/frequency scan
+	if (ctxPtr->frequencyID == (NUMBER_OF_HOPPING_FREQUENCIES - 1))
+	{
+		// No region of interest yet
+		roiMask = 0;
+
+		// All touch button electrodes
+		for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+		{
+			// All used scanning frequencies
+			for (frequencyNum = 0; frequencyNum < NUMBER_OF_HOPPING_FREQUENCIES; frequencyNum++)
+			{
+				// Electrode touched? Add it and its neighbours
+				if (elecDataBasePtr[elecNum].electrodeTouch[frequencyNum] != 0)
+				{
+					roiMask |= (1 << elecNum) | elecCfg[elecNum].roiNeighbours;
+				}
+			}
+		}
+
+		// Any electrode touched?
+		if (roiMask != 0)
+		{
+			// Next background electrodes rotation slot
+			roiBackgroundSlot = (roiBackgroundSlot + 1) % ROI_BACKGROUND_SCAN_PERIODS;
+
+			// All touch button electrodes
+			for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+			{
+				// Background electrode of the rotation slot
+				if ((elecNum % ROI_BACKGROUND_SCAN_PERIODS) == roiBackgroundSlot)
+				{
+					roiMask |= 1 << elecNum;
+				}
+			}
+
+			// Scan region of interest and background electrodes of the slot
+			elecRoiScanMask = roiMask & ELEC_SCAN_MASK_ALL;
+		}
+		else
+		{
+			// Scan all touch button electrodes
+			elecRoiScanMask = ELEC_SCAN_MASK_ALL;
+		}
+	}
 }
+#endif
+
 /*****************************************************************************
  *
- * Function: void DCTrackerShiftIncrease(void)
+ * Function: void ElectrodeEnableUpdate(void)
  *
- * Description: DCtrackershift increase
+ * Description: Apply touch button electrodes enable requested in elecEnableMask - disabled
+ * 				electrode touch released, re-enabled electrode baseline re-seeded on its next scan,
+ * 				electrodes pins mask rebuilt to keep disabled electrodes driven to GND
  *
  *****************************************************************************/
-void DCTrackerShiftIncrease(void)
+void ElectrodeEnableUpdate(void)
 {
-	// All touch button electrodes
-	for(elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	uint32_t  elecNum, enableChange;
+	uint8_t   frequencyNum;
+
+	// Electrodes enable changed
+	enableChange = (elecEnableMask & ELEC_SCAN_MASK_ALL) ^ elecEnabledMask;
+
+	// Any change?
+	if (enableChange != 0)
 	{
-		// Load new shift to update the DC tracker
-		DCTrackerDataShift[elecNum] = ELEC_DCTRACKER_FILTER_FACTOR_ACTIVE;
+		// Apply enable
+		elecEnabledMask ^= enableChange;
+
+		// All touch button electrodes
+		for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+		{
+			// Electrode enable changed?
+			if (enableChange & (1 << elecNum))
+			{
+				// Electrode enabled?
+				if (elecEnabledMask & (1 << elecNum))
+				{
+					// Re-seed baseline on the next scan
+					elecData[elecNum].baselineReseed = YES;
+				}
+				else
+				{
+					// All used scanning frequencies
+					for (frequencyNum = 0; frequencyNum < NUMBER_OF_HOPPING_FREQUENCIES; frequencyNum++)
+					{
+						// Released, reported by touch qualification
+						elecData[elecNum].electrodeTouch[frequencyNum] = 0;
+					}
+				}
+			}
+		}
+
+		// Float enabled electrodes only
+		ElectrodesPortMaskInit();
 	}
+}
 
-	// All touch button electrodes
-	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+/*****************************************************************************
+ *
+ * Function: void ElectrodeBaselineReseed(uint32_t electrodeNum, tSenseCtx *ctxPtr)
+ *
+ * Input: Number of re-enabled touch button electrode, sensing context of the scan
+ *
+ * Description: Load DC tracker, IIR LP filter and raw data of all scanning frequencies
+ * 				with the electrode first raw data after re-enabling
+ *
+ *****************************************************************************/
+void ElectrodeBaselineReseed(uint32_t electrodeNum, tSenseCtx *ctxPtr)
+{
+	tElecData  *elecDataPtr = &ctxPtr->elecDataPtr[electrodeNum];
+	uint8_t   frequencyNum;
+
+	// DC tracker data
+	elecDataPtr->DCTrackerDataBuffer = elecDataPtr->adcDataElectrodeDischargeRaw[ctxPtr->frequencyID];
+	// Load DC tracker buffer
+	elecDataPtr->DCTrackerDataBufferRaw = (elecDataPtr->DCTrackerDataBuffer) << (elecDataPtr->DCTrackerDataShift);
+
+	// All used scanning frequencies
+	for (frequencyNum = 0; frequencyNum < NUMBER_OF_HOPPING_FREQUENCIES; frequencyNum++)
 	{
-		// Load DC tracker buffer
-		DCTrackerDataBufferRaw[elecNum] = (DCTrackerDataBuffer[elecNum]) << ((DCTrackerDataShift[elecNum]));
+		// Raw data preset as baseline
+		elecDataPtr->adcDataElectrodeDischargeRaw[frequencyNum] = elecDataPtr->DCTrackerDataBuffer;
+		// LP IIR filter buffer init
+		elecDataPtr->LPFilterData[frequencyNum] = elecDataPtr->DCTrackerDataBuffer;
+		FilterIIR1BufferInit(&elecDataPtr->LPFilterBuffer[frequencyNum], ((tFrac32)(elecDataPtr->DCTrackerDataBuffer)), ((tFrac32)(elecDataPtr->DCTrackerDataBuffer)));
+#if DECIMATION_FILTER
+		// Pre-load DF array
+		elecDataPtr->adcDataElectrodeDischargeRawDF[frequencyNum] = elecDataPtr->DCTrackerDataBuffer;
+#endif
 	}
+
+	// DC tracker slowest step
+	elecDataPtr->DCTrackerSlewRun = 0;
+#if TS_TEMP_COMPENSATION
+	// Restart the temperature learning window
+	elecDataPtr->tempCompTouched = YES;
+#endif
+
+	// Re-seeded
+	elecDataPtr->baselineReseed = NO;
 }
 
+#if TS_TEMP_COMPENSATION
 /*****************************************************************************
  *
- * Function: void DCTrackerShiftDecrease(void)
+ * Function: void ElectrodeTempSensorAcquire(void)
  *
- * Description: DCtrackershift decrease
+ * Description: Convert the on-chip temperature sensor every TEMP_COMP_PERIOD scans
  *
  *****************************************************************************/
-void DCTrackerShiftDecrease(void)
+void ElectrodeTempSensorAcquire(void)
 {
-	// All touch button electrodes
-	for(elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	// Temperature sample due?
+	if (++tempSensorScanCounter >= TEMP_COMP_PERIOD)
 	{
-		// Load new shift to update the DC tracker
-		DCTrackerDataShift[elecNum] = ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
+		// Reset counter
+		tempSensorScanCounter = 0;
+
+		// Convert the on-chip temperature sensor
+		tempSensorData = ADC0_TempSensorConvert(TEMP_SENSOR_SAMPLES);
+
+		// New temperature for the processing
+		tempSensorReady = YES;
+	}
+}
+
+/*****************************************************************************
+ *
+ * Function: void ElectrodeTempCompUpdate(void)
+ *
+ * Description: Add the temperature feed-forward to the touch button electrodes baselines and
+ * 				learn each electrode temperature coefficient from the baseline change over
+ * 				a learning window without touch
+ *
+ *****************************************************************************/
+void ElectrodeTempCompUpdate(void)
+{
+	uint32_t  elecNum;
+	int32_t   temperature, temperatureStep, temperatureWindow, feedForward, coefMeasured;
+	tElecData  *elecDataPtr;
+
+	// New temperature?
+	if (tempSensorReady == NO)
+	{
+		return;
+	}
+
+	// Take the temperature
+	temperature = tempSensorData;
+	tempSensorReady = NO;
+
+	// First temperature?
+	if (tempCompStarted == NO)
+	{
+		// Start the compensation and the learning window
+		tempCompLast = temperature;
+		tempCompWindowStart = temperature;
+		tempCompStarted = YES;
+
+		// All touch button electrodes
+		for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+		{
+			// Learning window start baseline
+			elecData[elecNum].tempCompWindowBaseline = elecData[elecNum].DCTrackerDataBuffer;
+		}
+
+		return;
 	}
 
+	// Temperature change since the last step and since the learning window start
+	temperatureStep = temperature - tempCompLast;
+	temperatureWindow = temperature - tempCompWindowStart;
+	tempCompLast = temperature;
+
 	// All touch button electrodes
 	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
 	{
-		// Load DC tracker buffer
-		DCTrackerDataBufferRaw[elecNum] = (DCTrackerDataBuffer[elecNum]) << ((DCTrackerDataShift[elecNum]));
+		// Electrode processing state
+		elecDataPtr = &elecData[elecNum];
+
+		// Electrode disabled? Its baseline is re-seeded when enabled
+		if ((elecEnabledMask & (1 << elecNum)) == 0)
+		{
+			// Restart the learning window
+			elecDataPtr->tempCompTouched = YES;
+			continue;
+		}
+
+		// Feed-forward of the temperature step, fraction kept for the next step
+		elecDataPtr->tempCompFrac += elecDataPtr->tempCompCoef * temperatureStep;
+		feedForward = elecDataPtr->tempCompFrac >> TEMP_COMP_COEF_SHIFT;
+		elecDataPtr->tempCompFrac -= feedForward << TEMP_COMP_COEF_SHIFT;
+
+		// Move the baseline
+		elecDataPtr->DCTrackerDataBuffer += feedForward;
+		elecDataPtr->DCTrackerDataBufferRaw += feedForward << elecDataPtr->DCTrackerDataShift;
+
+		// Learning window complete?
+		if ((temperatureWindow >= TEMP_COMP_WINDOW_DELTA) || (temperatureWindow <= -TEMP_COMP_WINDOW_DELTA))
+		{
+			// Baseline followed the temperature only (not touched during the window)?
+			if (elecDataPtr->tempCompTouched == NO)
+			{
+				// Baseline change per temperature over the window
+				coefMeasured = ((elecDataPtr->DCTrackerDataBuffer - elecDataPtr->tempCompWindowBaseline) << TEMP_COMP_COEF_SHIFT) / temperatureWindow;
+				// Learn the coefficient
+				elecDataPtr->tempCompCoef += (coefMeasured - elecDataPtr->tempCompCoef) >> TEMP_COMP_LEARN_SHIFT;
+			}
+
+			// Next learning window
+			elecDataPtr->tempCompWindowBaseline = elecDataPtr->DCTrackerDataBuffer;
+			elecDataPtr->tempCompTouched = NO;
+		}
+	}
+
+	// Learning window complete?
+	if ((temperatureWindow >= TEMP_COMP_WINDOW_DELTA) || (temperatureWindow <= -TEMP_COMP_WINDOW_DELTA))
+	{
+		// Next learning window start
+		tempCompWindowStart = temperature;
 	}
 }
+#endif
+
+#if TS_COMMON_MODE_REJECTION
 /*****************************************************************************
  *
- * Function: void ElectrodeSelfTrim(void)
+ * Function: void ElectrodeCommonModeReject(tSenseCtx *ctxPtr)
  *
- * Description: Run electrode self-trim algorithm
+ * Input: Sensing context of the scan
+ *
+ * Description: Subtract the median raw data to baseline delta of the not touched touch
+ * 				button electrodes from the raw data of all scanned electrodes
  *
  *****************************************************************************/
-void ElectrodeSelfTrim(void)
+void ElectrodeCommonModeReject(tSenseCtx *ctxPtr)
 {
-	// Device after power-up / reset ?
-	if (adcDataElectrodeDischargeBufferCounter[0] < NUMBER_OF_CYCLES_DCTRACKER_PWRUP)
+	tElecData  *elecDataBasePtr = ctxPtr->elecDataPtr;
+	uint32_t  scanMask = ctxPtr->scanMask & elecEnabledMask;
+	uint8_t   scanFrequencyID = ctxPtr->frequencyID;
+	uint32_t  elecNum, deltaNum, sortNum;
+	int32_t   delta[NUMBER_OF_TOUCH_ELECTRODES];
+	int32_t   deltaAct;
+	tElecData  *elecDataPtr;
+
+	// Number of reference deltas
+	deltaNum = 0;
+
+	// All touch button electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
 	{
-		// All touch button (and EGS) electrodes
-		for (elecNum = 0; elecNum < (NUMBER_OF_ELECTRODES); elecNum++)
+		// Electrode processing state
+		elecDataPtr = &elecDataBasePtr[elecNum];
+
+		// Only scanned, not touched electrodes with valid baseline are the reference
+		if (((scanMask & (1 << elecNum)) == 0) || (elecDataPtr->electrodeTouch[scanFrequencyID] == 1) || \
+				(elecDataPtr->baselineReseed == YES))
 		{
-			// Store touch electrode init value
-			ElectodeBufferInitVal(adcDataElectrodeDischargeRaw[elecNum][frequencyID], &(adcDataElectrodeDischargeBuffer[elecNum]), &(adcDataElectrodeDischargeBufferCounter[elecNum]));
+			continue;
+		}
+
+		// Raw data to baseline delta
+		deltaAct = elecDataPtr->adcDataElectrodeDischargeRaw[scanFrequencyID] - elecDataPtr->DCTrackerDataBuffer;
+
+		// Insert sorted
+		for (sortNum = deltaNum; (sortNum > 0) && (delta[sortNum - 1] > deltaAct); sortNum--)
+		{
+			delta[sortNum] = delta[sortNum - 1];
 		}
+		delta[sortNum] = deltaAct;
+		deltaNum++;
+	}
+
+	// Not enough reference electrodes?
+	if (deltaNum < COMMON_MODE_MIN_ELECTRODES)
+	{
+		// No correction
+		commonModeData = 0;
+		return;
+	}
+
+	// Median
+	if (deltaNum & 1)
+	{
+		commonModeData = delta[deltaNum >> 1];
 	}
-	// Calculate and load init value
 	else
 	{
-		// All touch button (and EGS) electrodes
-		for (elecNum = 0; elecNum < (NUMBER_OF_ELECTRODES); elecNum++)
+		commonModeData = (delta[(deltaNum >> 1) - 1] + delta[deltaNum >> 1]) / 2;
+	}
+
+	// All touch button electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	{
+		// Electrode scanned?
+		if (scanMask & (1 << elecNum))
 		{
-			// Calculate touch electrode init value
-			ElectodeCalInitVal(&(adcDataElectrodeDischargeBuffer[elecNum]), &(adcDataElectrodeDischargeBufferCounter[elecNum]));
+			// Remove common-mode
+			elecDataBasePtr[elecNum].adcDataElectrodeDischargeRaw[scanFrequencyID] -= commonModeData;
 		}
+	}
+}
+#endif
 
-		// Set electrode status "self-trim done" flag
-		electrodesStatus.bit.selfTrimDone = YES;
+#if TS_WARM_START
+/*****************************************************************************
+ *
+ * Function: uint32_t WarmStartChecksum(const uint32_t *wordPtr, uint32_t wordsNum)
+ *
+ * Description: Rotate and add checksum of the snapshot words
+ *
+ * Note: Erased flash (all words 0xFFFFFFFF) is rejected by the signature, the checksum
+ * 		 detects a snapshot corrupted or torn by a reset during programming
+ *
+ *****************************************************************************/
+static uint32_t WarmStartChecksum(const uint32_t *wordPtr, uint32_t wordsNum)
+{
+	uint32_t  checksum = 0;
+
+	// All words
+	while (wordsNum--)
+	{
+		checksum = ((checksum << 1) | (checksum >> 31)) + *wordPtr++;
 	}
+
+	return checksum;
 }
 
 /*****************************************************************************
  *
- * Function: void electrodeTouchQualify(void)
+ * Function: uint8_t ElectrodeWarmStartCheck(void)
  *
- * Description: Qualify touch button electrode touch
+ * Description: Check the warm start snapshot in data flash - signature and checksum
  *
  *****************************************************************************/
-void electrodeTouchQualify(void)
+uint8_t ElectrodeWarmStartCheck(void)
 {
-	// For all touch button electrodes check touch event
-	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	// Signature and checksum valid?
+	if ((warmStartFlashPtr->data.signature == WARM_START_SIGNATURE) && \
+			(warmStartFlashPtr->data.checksum == WarmStartChecksum(warmStartFlashPtr->word, WARM_START_CHECKSUM_WORDS)))
 	{
-#if FREQUENCY_HOPPING
-		// Electrode has been touched on both scanning frequencies?
-		if ((electrodeTouch[elecNum][0] == 1) && (electrodeTouch[elecNum][1] == 1)  && (electrodeTouchNumberPlusOne == 0) &&
-				numberOfElectrodeSensingCyclesPerSample == NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE && frequencyID == 1)
-#else
-			// Electrode has been touched?
-			if ((electrodeTouch[elecNum][frequencyID] == 1) && (electrodeTouchNumberPlusOne == 0) &&
-					numberOfElectrodeSensingCyclesPerSample == NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE)
-#endif
-			{
-				// Report electrode touch
-				electrodeTouchQualifiedReport = 1;
+		warmStartValid = YES;
+	}
+	else
+	{
+		warmStartValid = NO;
+	}
+
+	return warmStartValid;
+}
+
+/*****************************************************************************
+ *
+ * Function: void ElectrodeWarmStartAdcRestore(void)
+ *
+ * Description: Load ADC0 and ADC1 calibration from the warm start snapshot
+ *
+ *****************************************************************************/
+void ElectrodeWarmStartAdcRestore(void)
+{
+	// ADC0 calibration
+	calibrationGainADC0 = ADC_CalibrationLoad(ADC0, &warmStartFlashPtr->data.adcCal[0]);
+
+	// ADC1 calibration
+	calibrationGainADC1 = ADC_CalibrationLoad(ADC1, &warmStartFlashPtr->data.adcCal[1]);
+}
+
+/*****************************************************************************
+ *
+ * Function: void ElectrodeWarmStartRestore(void)
+ *
+ * Description: Restore touch button (and EGS) electrodes acquisition timing from the warm start
+ * 				snapshot and shorten the self-trim. Thresholds and DC tracker shift must match
+ * 				the configuration, otherwise the snapshot is dropped (cold start).
+ * 				Baselines are measured again by the self-trim, the snapshot ones are compared only.
+ *
+ *****************************************************************************/
+void ElectrodeWarmStartRestore(void)
+{
+	uint32_t  elecNum;
+	const tWarmStartElec  *snapElecPtr;
+
+	// All touch button (and EGS) electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+	{
+		snapElecPtr = &warmStartFlashPtr->data.elec[elecNum];
+
+		// Configuration changed since the snapshot?
+		if ((snapElecPtr->detectorThresholdTouchDelta != elecData[elecNum].detectorThresholdTouchDelta) || \
+				(snapElecPtr->detectorThresholdReleaseDelta != elecData[elecNum].detectorThresholdReleaseDelta) || \
+				(snapElecPtr->DCTrackerDataShift != elecData[elecNum].DCTrackerDataShift))
+		{
+			// Cold start, ADC calibration restored already is kept
+			warmStartValid = NO;
+			return;
+		}
+	}
+
+#if TS_TIMING_AUTOTUNE
+	// All touch button (and EGS) electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+	{
+		// Acquisition timing tuned before
+		elecData[elecNum].elecChargeDistributionPeriod = warmStartFlashPtr->data.elec[elecNum].elecChargeDistributionPeriod;
+		elecData[elecNum].elecAdcSampleTime = warmStartFlashPtr->data.elec[elecNum].elecAdcSampleTime;
+	}
 
-				// Report electrode touch
-				electrodeTouchQualified[elecNum] = 1;
+	// Set electrode status "timing tune done" flag
+	electrodesStatus.bit.timingTuneDone = YES;
+#endif
 
-				// Load electrode number + 1
-				electrodeTouchNumberPlusOne = elecNum + 1;
-			}
+	// Short self-trim
+	selfTrimCycles = WARM_START_SELF_TRIM_CYCLES;
+}
 
-		// Any electrode touched?
-		if (electrodeTouchNumberPlusOne != 0)
+/*****************************************************************************
+ *
+ * Function: void ElectrodeWarmStartSelfTrimDone(void)
+ *
+ * Description: Request the snapshot store after cold self-trim or when a baseline moved
+ * 				more than half the touch threshold since the snapshot
+ *
+ *****************************************************************************/
+void ElectrodeWarmStartSelfTrimDone(void)
+{
+	uint32_t  elecNum;
+	int32_t   baselineDiff;
+
+	// Cold start?
+	if (warmStartValid == NO)
+	{
+		// Store the snapshot
+		warmStartSaveRequest = YES;
+		return;
+	}
+
+	// All touch button (and EGS) electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+	{
+		// Baseline moved since the snapshot
+		baselineDiff = elecData[elecNum].DCTrackerDataBuffer - warmStartFlashPtr->data.elec[elecNum].DCTrackerDataBuffer;
+
+		// Snapshot stale?
+		if ((baselineDiff > (elecData[elecNum].detectorThresholdTouchDelta / 2)) || (baselineDiff < -(elecData[elecNum].detectorThresholdTouchDelta / 2)))
 		{
-#if FREQUENCY_HOPPING
-			// Electrode, that was touched, has been released on first or second scanning frequency?
-			if((electrodeTouch[(electrodeTouchNumberPlusOne - 1)][0] == 0) || (electrodeTouch[(electrodeTouchNumberPlusOne - 1)][1] == 0))
-#else
-				// Electrode, that was touched, has been released?
-				if(electrodeTouch[(electrodeTouchNumberPlusOne - 1)][frequencyID] == 0)
-#endif
-				{
-					// Report electrode release
-					electrodeTouchQualifiedReport = 0;
-					// Report electrode release
-					electrodeTouchQualified[(electrodeTouchNumberPlusOne - 1)] = 0;
-					// Reset
-					electrodeTouchNumberPlusOne = 0;
-				}
+			// Store the snapshot
+			warmStartSaveRequest = YES;
+			return;
 		}
 	}
 }
 
 /*****************************************************************************
  *
- * Function: void ElectrodeTouchDetect(uint32_t electrodeNum)
+ * Function: void ElectrodeWarmStartSave(void)
  *
- * Description: Detect touch button electrode touch
+ * Description: Store ADC calibration and touch button (and EGS) electrodes state to the
+ * 				warm start snapshot in data flash. Called from the main loop, erase and
+ * 				program block it for tens of ms, electrodes sensing interrupts keep running.
  *
  *****************************************************************************/
-void ElectrodeTouchDetect(uint32_t electrodeNum)
+void ElectrodeWarmStartSave(void)
 {
-	// Touch button Electrode touched ?
-	if (LPFilterData[electrodeNum][frequencyID] < detectorThresholdTouch[electrodeNum])
-	{
-		// Touched
-		electrodeTouch[electrodeNum][frequencyID] = 1;
+	uint32_t  elecNum;
+	tWarmStartElec  *snapElecPtr;
 
-#ifdef WAKE_UP_ELECTRODE
-		// Load counter to do not return to the wake-up function
-		// Do not return to the wake-up function, when electrode released and electrode signal value is above touch and bellow release threshold
-		// Expected SR <= 1s
-		electrodeWakeUpActivateCounter = ELEC_WAKEUP_ACTIVATE_COUNTER;
-#else
-		// Load counter to prevent switching of number of samples per cycle to idle
-		electrodesVirtualEGSActivateCounter = ELEC_WAKEUP_ACTIVATE_COUNTER;
-#endif
+	// Request served
+	warmStartSaveRequest = NO;
+
+	// Pad of the last phrase
+	warmStartImage.word[(sizeof(warmStartImage.word) / 4) - 1] = 0xFFFFFFFF;
+
+	// Signature
+	warmStartImage.data.signature = WARM_START_SIGNATURE;
+
+	// ADC0 and ADC1 calibration, gain register cleared during conversions
+	ADC_CalibrationSave(ADC0, &warmStartImage.data.adcCal[0]);
+	warmStartImage.data.adcCal[0].G = calibrationGainADC0;
+	ADC_CalibrationSave(ADC1, &warmStartImage.data.adcCal[1]);
+	warmStartImage.data.adcCal[1].G = calibrationGainADC1;
+
+	// All touch button (and EGS) electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+	{
+		snapElecPtr = &warmStartImage.data.elec[elecNum];
+
+		snapElecPtr->DCTrackerDataBuffer = elecData[elecNum].DCTrackerDataBuffer;
+		snapElecPtr->detectorThresholdTouchDelta = elecData[elecNum].detectorThresholdTouchDelta;
+		snapElecPtr->detectorThresholdReleaseDelta = elecData[elecNum].detectorThresholdReleaseDelta;
+		snapElecPtr->elecChargeDistributionPeriod = elecData[elecNum].elecChargeDistributionPeriod;
+		snapElecPtr->elecAdcSampleTime = elecData[elecNum].elecAdcSampleTime;
+		snapElecPtr->DCTrackerDataShift = elecData[elecNum].DCTrackerDataShift;
 	}
-	// Electrode released?
-	else if ((LPFilterData[electrodeNum][frequencyID] > detectorThresholdRelease[electrodeNum]) && (electrodeTouch[electrodeNum][frequencyID] == 1))
+
+	// Checksum
+	warmStartImage.data.checksum = WarmStartChecksum(warmStartImage.word, WARM_START_CHECKSUM_WORDS);
+
+	// Erase data flash sector and program the snapshot, failed snapshot is invalid at the next startup
+	if (FLASH_DFlashSectorErase(WARM_START_DFLASH_ADDRESS) == FLASH_OK)
 	{
-		// Released
-		electrodeTouch[electrodeNum][frequencyID] = 0;
+		FLASH_DFlashProgram(WARM_START_DFLASH_ADDRESS, warmStartImage.word, sizeof(warmStartImage.word) / 4);
 	}
 }
+#endif
 
 /*****************************************************************************
  *
@@ -648,48 +2352,40 @@ void ElectrodeTouchDetect(uint32_t electrodeNum)
  *****************************************************************************/
 void ElectrodeSelfTrimSense(void)
 {
+	uint32_t  elecNum;
+
 #ifdef DEBUG_ALGORITHM
 	// Pin clear
 	R_RMW32(&(DA_GPIO->PCOR), DA_PIN, 1);
 #endif
 
-	// Configure all touch button (and EGS) electrodes floating
-	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
-	{
-		ElectrodeFloat(&elecStruct[elecNum]);
-	}
+	// Configure all touch button (and EGS) and slider electrodes floating
+	ElectrodesFloatAll();
 
-#if SLIDER_ENABLE
-	// Configure all slider electrodes floating
-	for (elecNum = 0; elecNum < (NUMBER_OF_SLIDER_ELECTRODES); elecNum++)
-	{
-		ElectrodeFloat(&sliderElecStruct[elecNum]);
-	}
+	// Convert all touch button electrodes capacitance to equivalent voltage
+	ElectrodesCapToVoltConv();
+
+#ifdef WAKE_UP_ELECTRODE
+	// Convert wake-up (EGS) electrode capacitance to equivalent voltage
+	ElectrodeCapToVoltConvELCH(WAKE_UP_ELECTRODE);
 #endif
 
-	// All touch button (and EGS) electrodes
-	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
-	{
-		// Convert electrode capacitance to equivalent voltage
-		ElectrodeCapToVoltConvELCH(elecNum);
-	}
+	// Drive all touch button (and EGS) and slider electrodes to GND
+	ElectrodesGndAll();
 
-	// Drive all touch button (and EGS) electrodes to GND
-	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+#if TS_TIMING_AUTOTUNE
+	// Acquisition timing auto-tuning not finished?
+	if (electrodesStatus.bit.timingTuneDone == NO)
 	{
-		ElectrodeGnd(&elecStruct[elecNum]);
+		// Evaluate acquisition timing candidate
+		ElectrodeTimingTune();
 	}
-
-#if SLIDER_ENABLE
-	// Drive all slider electrodes to GND
-	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
+	else
+#endif
 	{
-		ElectrodeGnd(&sliderElecStruct[elecNum]);
+		// All touch button (and EGS) electrodes self trim
+		ElectrodeSelfTrim();
 	}
-#endif
-
-	// All touch button (and EGS) electrodes self trim
-	ElectrodeSelfTrim();
 
 	// Electrodes self-trim done?
 	if(electrodesStatus.bit.selfTrimDone == YES)
@@ -698,12 +2394,12 @@ void ElectrodeSelfTrimSense(void)
 		for (elecNum = 0; elecNum < (NUMBER_OF_ELECTRODES); elecNum++)
 		{
 			// DC tracker data
-			DCTrackerDataBuffer[elecNum] = adcDataElectrodeDischargeBuffer[elecNum];
+			elecData[elecNum].DCTrackerDataBuffer = adcDataElectrodeDischargeBuffer[elecNum];
 			// Load DC tracker buffer
-			DCTrackerDataBufferRaw[elecNum] = (DCTrackerDataBuffer[elecNum]) << ((DCTrackerDataShift[elecNum]));
+			elecData[elecNum].DCTrackerDataBufferRaw = (elecData[elecNum].DCTrackerDataBuffer) << ((elecData[elecNum].DCTrackerDataShift));
 			// Electrode touch and release thresholds
-			detectorThresholdTouch[elecNum] = DCTrackerDataBuffer[elecNum] - detectorThresholdTouchDelta[elecNum];
-			detectorThresholdRelease[elecNum] = DCTrackerDataBuffer[elecNum] - detectorThresholdReleaseDelta[elecNum];
+			elecData[elecNum].detectorThresholdTouch = elecData[elecNum].DCTrackerDataBuffer - elecData[elecNum].detectorThresholdTouchDelta;
+			elecData[elecNum].detectorThresholdRelease = elecData[elecNum].DCTrackerDataBuffer - elecData[elecNum].detectorThresholdReleaseDelta;
 		}
 
 		// All (both) used scanning frequencies (freemaster init)
@@ -713,13 +2409,13 @@ void ElectrodeSelfTrimSense(void)
 			for (elecNum = 0; elecNum < (NUMBER_OF_ELECTRODES); elecNum++)
 			{
 				// Touch electrodes LP IIR filter buffer init (FM only)
-				LPFilterData[elecNum][frequencyID] = DCTrackerDataBuffer[elecNum];
+				elecData[elecNum].LPFilterData[frequencyID] = elecData[elecNum].DCTrackerDataBuffer;
 				// Raw data preset as baseline
-				adcDataElectrodeDischargeRaw[elecNum][frequencyID] = DCTrackerDataBuffer[elecNum];
+				elecData[elecNum].adcDataElectrodeDischargeRaw[frequencyID] = elecData[elecNum].DCTrackerDataBuffer;
 
 #if DECIMATION_FILTER
 				// Pre-load DF array
-				adcDataElectrodeDischargeRawDF[elecNum][frequencyID] = DCTrackerDataBuffer[elecNum];
+				elecData[elecNum].adcDataElectrodeDischargeRawDF[frequencyID] = elecData[elecNum].DCTrackerDataBuffer;
 #endif
 			}
 		}
@@ -733,12 +2429,17 @@ void ElectrodeSelfTrimSense(void)
 			for (elecNum = 0; elecNum < (NUMBER_OF_ELECTRODES); elecNum++)
 			{
 				// Init IIR filter
-				FilterIIR1BufferInit(elecNum, ((tFrac32)(DCTrackerDataBuffer[elecNum])), ((tFrac32)(DCTrackerDataBuffer[elecNum])), frequencyID);
+				FilterIIR1BufferInit(&elecData[elecNum].LPFilterBuffer[frequencyID], ((tFrac32)(elecData[elecNum].DCTrackerDataBuffer)), ((tFrac32)(elecData[elecNum].DCTrackerDataBuffer)));
 			}
 		}
 		// Reset frequencyID
 		frequencyID = 0;
 
+#if TS_WARM_START
+		// Store the warm start snapshot, if cold start or stale
+		ElectrodeWarmStartSelfTrimDone();
+#endif
+
 		// Enable LPTMR
 		LPTMR0_Init(LPTMR_ELEC_SENSE);
 
@@ -761,39 +2462,50 @@ void ElectrodeSelfTrimSense(void)
  *****************************************************************************/
 void ElecOversamplingActivation(void)
 {
+	uint32_t  elecNum;
+#if DECIMATION_FILTER
+	uint8_t   frequencyNum;
+#endif
+
 	// All touch button electrodes
 	for(elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
 	{
 		// Update DC tracker shift
-		DCTrackerDataShift[elecNum] = ELEC_DCTRACKER_FILTER_FACTOR_ACTIVE;
+		elecData[elecNum].DCTrackerDataShift = ELEC_DCTRACKER_FILTER_FACTOR_ACTIVE;
 	}
 
 	// All touch button electrodes
 	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
 	{
 		// Set DCTracker value to correspond to number of samples taken in Active state
-		DCTrackerDataBuffer[elecNum] = DCTrackerDataBuffer[elecNum] * NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
+		elecData[elecNum].DCTrackerDataBuffer = elecData[elecNum].DCTrackerDataBuffer * NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
 
 		// Load DC tracker buffer
-		DCTrackerDataBufferRaw[elecNum] = (DCTrackerDataBuffer[elecNum]) << ((DCTrackerDataShift[elecNum]));
+		elecData[elecNum].DCTrackerDataBufferRaw = (elecData[elecNum].DCTrackerDataBuffer) << ((elecData[elecNum].DCTrackerDataShift));
+
+#if TS_ADAPTIVE_SENSING_CYCLES
+		// Noise variance corresponding to number of samples taken in Active state
+		elecData[elecNum].elecNoiseVariance *= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY * NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
+#endif
+#if TS_TEMP_COMPENSATION
+		// Temperature coefficient corresponding to number of samples taken in Active state, restart the learning window
+		elecData[elecNum].tempCompCoef *= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
+		elecData[elecNum].tempCompFrac *= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
+		elecData[elecNum].tempCompTouched = YES;
+#endif
 	}
 
 #if DECIMATION_FILTER
-	// Save frequencyID
-	frequencyIDsave = frequencyID;
-
 	// All (both) used scanning frequencies
-	for (frequencyID = 0; frequencyID < NUMBER_OF_HOPPING_FREQUENCIES; frequencyID++)
+	for (frequencyNum = 0; frequencyNum < NUMBER_OF_HOPPING_FREQUENCIES; frequencyNum++)
 	{
 		// All touch button electrodes
 		for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
 		{
 			// Load DF array with DC tracker value - used when oversampling with EGS
-			adcDataElectrodeDischargeRawDF[elecNum][frequencyID] = DCTrackerDataBuffer[elecNum];
+			elecData[elecNum].adcDataElectrodeDischargeRawDF[frequencyNum] = elecData[elecNum].DCTrackerDataBuffer;
 		}
 	}
-	// Set back original frequencyID
-	frequencyID = frequencyIDsave;
 #endif
 }
 
@@ -806,21 +2518,34 @@ void ElecOversamplingActivation(void)
  *****************************************************************************/
 void ElecOversamplingDeactivation(void)
 {
+	uint32_t  elecNum;
+
 	// All touch button electrodes
 	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
 	{
 		// Update DC tracker shift
-		DCTrackerDataShift[elecNum] = ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
+		elecData[elecNum].DCTrackerDataShift = ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
 
 		// Set DCTracker value to correspond to number of samples taken in Idle state
-		DCTrackerDataBuffer[elecNum] = DCTrackerDataBuffer[elecNum] / NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
+		elecData[elecNum].DCTrackerDataBuffer = elecData[elecNum].DCTrackerDataBuffer / NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
+
+#if TS_ADAPTIVE_SENSING_CYCLES
+		// Noise variance corresponding to number of samples taken in Idle state
+		elecData[elecNum].elecNoiseVariance /= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY * NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
+#endif
+#if TS_TEMP_COMPENSATION
+		// Temperature coefficient corresponding to number of samples taken in Idle state, restart the learning window
+		elecData[elecNum].tempCompCoef /= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
+		elecData[elecNum].tempCompFrac /= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
+		elecData[elecNum].tempCompTouched = YES;
+#endif
 
 		// Load DC tracker buffer
-		DCTrackerDataBufferRaw[elecNum] = (DCTrackerDataBuffer[elecNum]) << ((DCTrackerDataShift[elecNum]));
+		elecData[elecNum].DCTrackerDataBufferRaw = (elecData[elecNum].DCTrackerDataBuffer) << ((elecData[elecNum].DCTrackerDataShift));
 
 		// Touch electrodes touch and release thresholds
-		detectorThresholdTouch[elecNum] = DCTrackerDataBuffer[elecNum] - detectorThresholdTouchDelta[elecNum];
-		detectorThresholdRelease[elecNum] = DCTrackerDataBuffer[elecNum] - detectorThresholdReleaseDelta[elecNum];
+		elecData[elecNum].detectorThresholdTouch = elecData[elecNum].DCTrackerDataBuffer - elecData[elecNum].detectorThresholdTouchDelta;
+		elecData[elecNum].detectorThresholdRelease = elecData[elecNum].DCTrackerDataBuffer - elecData[elecNum].detectorThresholdReleaseDelta;
 	}
 }
 #endif
@@ -835,53 +2560,63 @@ void ElecOversamplingDeactivation(void)
  *****************************************************************************/
 void ElectrodeWakeElecSense(void)
 {
+	uint32_t  elecNum;
+	uint8_t   frequencyIDsave, elecIdleNum;
+
 #ifdef DEBUG_ALGORITHM
 	// Pin clear
 	R_RMW32(&(DA_GPIO->PCOR), DA_PIN, 1);
 #endif
 
-	// Configure all touch button (and EGS) electrodes floating
-	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
-	{
-		ElectrodeFloat(&elecStruct[elecNum]);
-	}
-
+	// Apply touch button electrodes enable change
+	ElectrodeEnableUpdate();
 #if SLIDER_ENABLE
-	// Configure all slider electrodes floating
-	for (elecNum = 0; elecNum < (NUMBER_OF_SLIDER_ELECTRODES); elecNum++)
-	{
-		ElectrodeFloat(&sliderElecStruct[elecNum]);
-	}
+	// Apply slider enable change
+	SliderEnableUpdate();
 #endif
 
+	// Configure all touch button (and EGS) and slider electrodes floating
+	ElectrodesFloatAll();
+
+	// Wake-up (EGS) electrode conversion resolution
+	ADCs_ResolutionSet(egsAdcResolution);
 	// Convert wake-up (EGS) electrode capacitance to equivalent voltage
 	ElectrodeCapToVoltConvELCH(WAKE_UP_ELECTRODE);
+	// Back to 12-bit resolution for touch button and slider electrodes
+	ADCs_ResolutionSet(ADC_RESOLUTION_12BIT);
 
 	// Update Wake-up DC Tracker
-	DCTrackerDataBuffer[WAKE_UP_ELECTRODE] = DCTracker(adcDataElectrodeDischargeRaw[WAKE_UP_ELECTRODE][frequencyID], &(DCTrackerDataBufferRaw[WAKE_UP_ELECTRODE]), DCTrackerDataShift[WAKE_UP_ELECTRODE]);
+	elecData[WAKE_UP_ELECTRODE].DCTrackerDataBuffer = DCTracker(elecData[WAKE_UP_ELECTRODE].adcDataElectrodeDischargeRaw[frequencyID], &(elecData[WAKE_UP_ELECTRODE].DCTrackerDataBufferRaw), elecData[WAKE_UP_ELECTRODE].DCTrackerDataShift, NULL);
 	// Filter Wake-up electrode signal using IIR LP filter
-	LPFilterData[WAKE_UP_ELECTRODE][frequencyID] = FilterIIR1(WAKE_UP_ELECTRODE, (tFrac32)(adcDataElectrodeDischargeRaw[WAKE_UP_ELECTRODE][frequencyID]), frequencyID);
+	elecData[WAKE_UP_ELECTRODE].LPFilterData[frequencyID] = FilterIIR1(elecData[WAKE_UP_ELECTRODE].LPFilterType, &elecData[WAKE_UP_ELECTRODE].LPFilterBuffer[frequencyID], (tFrac32)(elecData[WAKE_UP_ELECTRODE].adcDataElectrodeDischargeRaw[frequencyID]));
 	// Wake-up electrode touch & release threshold
-	detectorThresholdTouch[WAKE_UP_ELECTRODE] = DCTrackerDataBuffer[WAKE_UP_ELECTRODE] - detectorThresholdTouchDelta[WAKE_UP_ELECTRODE];
-	detectorThresholdRelease[WAKE_UP_ELECTRODE] = DCTrackerDataBuffer[WAKE_UP_ELECTRODE] - detectorThresholdReleaseDelta[WAKE_UP_ELECTRODE];
+	elecData[WAKE_UP_ELECTRODE].detectorThresholdTouch = elecData[WAKE_UP_ELECTRODE].DCTrackerDataBuffer - elecData[WAKE_UP_ELECTRODE].detectorThresholdTouchDelta;
+	elecData[WAKE_UP_ELECTRODE].detectorThresholdRelease = elecData[WAKE_UP_ELECTRODE].DCTrackerDataBuffer - elecData[WAKE_UP_ELECTRODE].detectorThresholdReleaseDelta;
 
 	/*************************************************************************************************
 	 Touch button electrodes & slider electrodes slow baseline update routine when wake-up EGS used
 	 **************************************************************************************************/
+	// Electrode of the slow baseline update, kept across wake up periods
+	elecIdleNum = elecNumAct;
+
 #if SLIDER_ENABLE
 	// Update one touch button electrode baseline per wake up period
-	if (elecNumAct < (NUMBER_OF_ELECTRODES - 1))
+	if (elecIdleNum < (NUMBER_OF_ELECTRODES - 1))
 	{
-		// Convert touch button electrode capacitance to equivalent voltage
-		ElectrodeCapToVoltConvELCH(elecNumAct);
-		// DC tracker calculation
-		DCTrackerDataBuffer[elecNumAct] = DCTracker(adcDataElectrodeDischargeRaw[elecNumAct][frequencyID], &(DCTrackerDataBufferRaw[elecNumAct]), DCTrackerDataShift[elecNumAct]);
+		// Touch button electrode enabled?
+		if (elecEnabledMask & (1 << elecIdleNum))
+		{
+			// Convert touch button electrode capacitance to equivalent voltage, pair partner not converted
+			ElectrodeCapToVoltConvELCH(elecIdleNum);
+			// DC tracker calculation
+			elecData[elecIdleNum].DCTrackerDataBuffer = DCTracker(elecData[elecIdleNum].adcDataElectrodeDischargeRaw[frequencyID], &(elecData[elecIdleNum].DCTrackerDataBufferRaw), elecData[elecIdleNum].DCTrackerDataShift, &(elecData[elecIdleNum].DCTrackerSlewRun));
+		}
 		// Increment to next touch button electrode, that will be updated in next wake up cycle (30ms period)
-		elecNumAct++;
+		elecIdleNum++;
 	}
 
 	// Update slider electrodes baselines if all touch buttons are updated (elecNumact == WakeUpElectrode)
-	else if(elecNumAct == (NUMBER_OF_ELECTRODES - 1) && sliderElecNumAct < (NUMBER_OF_SLIDER_ELECTRODES))
+	else if(elecIdleNum == (NUMBER_OF_ELECTRODES - 1) && sliderElecNumAct < (NUMBER_OF_SLIDER_ELECTRODES))
 	{
 #if (NUMBER_OF_USED_ADC_MODULES == 2)
 		// Preset configuration for both ADC0 and ADC1 for voltage digitalization at the same time
@@ -912,50 +2647,45 @@ void ElectrodeWakeElecSense(void)
 	else
 	{
 		// Start from begin
-		elecNumAct = 0;
+		elecIdleNum = 0;
 		sliderElecNumAct = 0;
 	}
 
 #else
-	// Convert touch button electrode capacitance to equivalent voltage
-	ElectrodeCapToVoltConvELCH(elecNumAct);
-	// DC tracker calculation
-	DCTrackerDataBuffer[elecNumAct] = DCTracker(adcDataElectrodeDischargeRaw[elecNumAct][frequencyID], &(DCTrackerDataBufferRaw[elecNumAct]), DCTrackerDataShift[elecNumAct]);
+	// Touch button electrode enabled?
+	if (elecEnabledMask & (1 << elecIdleNum))
+	{
+		// Convert touch button electrode capacitance to equivalent voltage, pair partner not converted
+		ElectrodeCapToVoltConvELCH(elecIdleNum);
+		// DC tracker calculation
+		elecData[elecIdleNum].DCTrackerDataBuffer = DCTracker(elecData[elecIdleNum].adcDataElectrodeDischargeRaw[frequencyID], &(elecData[elecIdleNum].DCTrackerDataBufferRaw), elecData[elecIdleNum].DCTrackerDataShift, &(elecData[elecIdleNum].DCTrackerSlewRun));
+	}
 
 	// Next touch electrode
-	if (elecNumAct < (NUMBER_OF_ELECTRODES - 2))
+	if (elecIdleNum < (NUMBER_OF_ELECTRODES - 2))
 	{
-		elecNumAct++;
+		elecIdleNum++;
 	}
 	else
 	{
 		// Start from begin
-		elecNumAct = 0;
+		elecIdleNum = 0;
 	}
 #endif
+	// Electrode of the next wake up period
+	elecNumAct = elecIdleNum;
 	/****************************************************************************************************
 	END OF Touch button electrodes & slider electrodes slow baseline update routine when wake-up EGS used
 	 ****************************************************************************************************/
 
-	// Drive all touch button (and EGS) electrodes to GND
-	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
-	{
-		ElectrodeGnd(&elecStruct[elecNum]);
-	}
-
-#if SLIDER_ENABLE
-	// Drive all slider electrodes to GND
-	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
-	{
-		ElectrodeGnd(&sliderElecStruct[elecNum]);
-	}
-#endif
+	// Drive all touch button (and EGS) and slider electrodes to GND
+	ElectrodesGndAll();
 
 	// Proximity - wake up EGS electrode touched? (frequencyID at this stage of code should always be 0)
-	if(LPFilterData[WAKE_UP_ELECTRODE][frequencyID] < detectorThresholdTouch[WAKE_UP_ELECTRODE])
+	if(elecData[WAKE_UP_ELECTRODE].LPFilterData[frequencyID] < elecData[WAKE_UP_ELECTRODE].detectorThresholdTouch)
 	{
 		// Touched
-		electrodeTouch[WAKE_UP_ELECTRODE][frequencyID] = 1;
+		elecData[WAKE_UP_ELECTRODE].electrodeTouch[frequencyID] = 1;
 
 		// Change the number of ADC sensing cycles per sample for touch buttons
 		ElectrodeSensingCyclesChangeEGS();
@@ -996,8 +2726,8 @@ void ElectrodeWakeElecSense(void)
 			for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
 			{
 				// Set IIR filter initial value to (DCTracker - threshold / 2)
-				FilterIIR1BufferInit(elecNum, ((tFrac32)(DCTrackerDataBuffer[elecNum] - (detectorThresholdTouchDelta[elecNum] / 2))), \
-						((tFrac32)(DCTrackerDataBuffer[elecNum] - (detectorThresholdTouchDelta[elecNum] / 2))), frequencyID);
+				FilterIIR1BufferInit(&elecData[elecNum].LPFilterBuffer[frequencyID], ((tFrac32)(elecData[elecNum].DCTrackerDataBuffer - (elecData[elecNum].detectorThresholdTouchDelta / 2))), \
+						((tFrac32)(elecData[elecNum].DCTrackerDataBuffer - (elecData[elecNum].detectorThresholdTouchDelta / 2))));
 			}
 		}
 
@@ -1034,75 +2764,117 @@ void ElectrodeWakeElecSense(void)
  *****************************************************************************/
 void ElectrodeWakeAndTouchElecSense(void)
 {
+	uint32_t  elecNum, scanMask;
+	tElecData  *elecDataPtr;
+	uint8_t   frequencyIDsave;
+	tSenseCtx  senseCtx;
+
 #ifdef DEBUG_ALGORITHM
 	// Pin clear
 	R_RMW32(&(DA_GPIO->PCOR), DA_PIN, 1);
 #endif
 
-	// Configure all touch button (and EGS) electrodes floating
-	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
-	{
-		ElectrodeFloat(&elecStruct[elecNum]);
-	}
+	// Apply touch button electrodes enable change
+	ElectrodeEnableUpdate();
 
-#if SLIDER_ENABLE
-	// Configure all slider electrodes floating
-	for (elecNum = 0; elecNum < (NUMBER_OF_SLIDER_ELECTRODES); elecNum++)
-	{
-		ElectrodeFloat(&sliderElecStruct[elecNum]);
-	}
+	// Configure all touch button (and EGS) and slider electrodes floating
+	ElectrodesFloatAll();
+
+	// Convert all touch button electrodes capacitance to equivalent voltage
+	ElectrodesCapToVoltConv();
+
+	// Sensing context of the scan
+	senseCtx.elecDataPtr = elecData;
+	senseCtx.scanMask = elecScannedMask;
+	senseCtx.frequencyID = frequencyID;
+
+#if TS_COMMON_MODE_REJECTION
+	// Remove common-mode noise from the raw data
+	ElectrodeCommonModeReject(&senseCtx);
 #endif
 
+	// Scan loop state kept in locals
+	scanMask = senseCtx.scanMask & elecEnabledMask;
+	elecDataPtr = senseCtx.elecDataPtr;
+
 	// All touch button electrodes
-	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++, elecDataPtr++)
 	{
-		// Convert touch button electrode capacitance to equivalent voltage
-		ElectrodeCapToVoltConvELCH(elecNum);
+		// Electrode disabled or not scanned in this period?
+		if ((scanMask & (1 << elecNum)) == 0)
+		{
+			continue;
+		}
+
+		// Electrode re-enabled?
+		if (elecDataPtr->baselineReseed == YES)
+		{
+			// Re-seed baseline and filters from the first raw data
+			ElectrodeBaselineReseed(elecNum, &senseCtx);
+		}
 
 		// Update DC Tracker, if electrode not touched
-		if (electrodeTouch[elecNum][frequencyID] == 0)
+		if (elecDataPtr->electrodeTouch[frequencyID] == 0)
 		{
 			// Update DC tracker
-			DCTrackerDataBuffer[elecNum] = DCTracker(adcDataElectrodeDischargeRaw[elecNum][frequencyID], &(DCTrackerDataBufferRaw[elecNum]), DCTrackerDataShift[elecNum]);
+			elecDataPtr->DCTrackerDataBuffer = DCTracker(elecDataPtr->adcDataElectrodeDischargeRaw[frequencyID], &(elecDataPtr->DCTrackerDataBufferRaw), elecDataPtr->DCTrackerDataShift, &(elecDataPtr->DCTrackerSlewRun));
+#if TS_ADAPTIVE_SENSING_CYCLES
+			// Adapt electrode sensing cycles per sample to its noise
+			ElectrodeSensingCyclesAdapt(elecNum, &senseCtx);
+#endif
+		}
+#if TS_DCTRACKER_ADAPTIVE_SLEW || TS_TEMP_COMPENSATION
+		else
+		{
+#if TS_DCTRACKER_ADAPTIVE_SLEW
+			// DC tracker frozen while touched, slew back to the slowest step
+			elecDataPtr->DCTrackerSlewRun = 0;
+#endif
+#if TS_TEMP_COMPENSATION
+			// DC tracker frozen, restart the temperature learning window
+			elecDataPtr->tempCompTouched = YES;
+#endif
 		}
+#endif
 #if DECIMATION_FILTER
 		// Decimation filtering
-		DecimationFilter(elecNum);
+		DecimationFilter(elecNum, &senseCtx);
 #endif
 
 #if DECIMATION_FILTER
 		// IIR LP Filter fed by DF data
-		LPFilterData[elecNum][frequencyID] = FilterIIR1(elecNum, (tFrac32)(adcDataElectrodeDischargeRawDF[elecNum][frequencyID]), frequencyID);
+		elecDataPtr->LPFilterData[frequencyID] = FilterIIR1(elecDataPtr->LPFilterType, &elecDataPtr->LPFilterBuffer[frequencyID], (tFrac32)(elecDataPtr->adcDataElectrodeDischargeRawDF[frequencyID]));
 #else
 		// IIR LP filter fed by raw data
-		LPFilterData[elecNum][frequencyID] = FilterIIR1(elecNum, (tFrac32)(adcDataElectrodeDischargeRaw[elecNum][frequencyID]), frequencyID);
+		elecDataPtr->LPFilterData[frequencyID] = FilterIIR1(elecDataPtr->LPFilterType, &elecDataPtr->LPFilterBuffer[frequencyID], (tFrac32)(elecDataPtr->adcDataElectrodeDischargeRaw[frequencyID]));
 #endif
 
 		// Electrode touch and release thresholds
-		detectorThresholdTouch[elecNum] = DCTrackerDataBuffer[elecNum] - detectorThresholdTouchDelta[elecNum];
-		detectorThresholdRelease[elecNum] = DCTrackerDataBuffer[elecNum] - detectorThresholdReleaseDelta[elecNum];
+		elecDataPtr->detectorThresholdTouch = elecDataPtr->DCTrackerDataBuffer - elecDataPtr->detectorThresholdTouchDelta;
+		elecDataPtr->detectorThresholdRelease = elecDataPtr->DCTrackerDataBuffer - elecDataPtr->detectorThresholdReleaseDelta;
 
 		// Electrode touched ?
-		ElectrodeTouchDetect(elecNum);
+		ElectrodeTouchDetect(elecNum, &senseCtx);
 	}
 
-	// Drive all touch button (and EGS) electrodes to GND
-	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
-	{
-		ElectrodeGnd(&elecStruct[elecNum]);
-	}
+	// Drive all touch button (and EGS) and slider electrodes to GND
+	ElectrodesGndAll();
 
-#if SLIDER_ENABLE
-	// Drive all slider electrodes to GND
-	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
-	{
-		ElectrodeGnd(&sliderElecStruct[elecNum]);
-	}
+#if TS_TEMP_COMPENSATION
+	// Convert the on-chip temperature sensor, if due
+	ElectrodeTempSensorAcquire();
+	// Temperature feed-forward to the baselines
+	ElectrodeTempCompUpdate();
 #endif
 
 	// Qualify the touch event
 	// More the one electrode reports touch?
-	electrodeTouchQualify();
+	electrodeTouchQualify(&senseCtx);
+
+#if TS_ROI_SCAN
+	// Schedule touch button electrodes scan of the next period
+	ElectrodeRoiScanUpdate(&senseCtx);
+#endif
 
 #if SLIDER_ENABLE
 #if (NUMBER_OF_USED_ADC_MODULES == 2)
@@ -1122,7 +2894,7 @@ void ElectrodeWakeAndTouchElecSense(void)
 	if (electrodeWakeUpActivateCounter == 0)
 	{
 		// Released
-		electrodeTouch[WAKE_UP_ELECTRODE][0] = 0;
+		elecData[WAKE_UP_ELECTRODE].electrodeTouch[0] = 0;
 
 #if (TS_RAW_DATA_CALCULATION == OVERSAMPLING)
 		// Deactivate touch button electrodes DC tracker adjustments for oversampling - back to idle mode
@@ -1160,7 +2932,7 @@ void ElectrodeWakeAndTouchElecSense(void)
 		for (frequencyID = 0; frequencyID < NUMBER_OF_HOPPING_FREQUENCIES; frequencyID++)
 		{
 			// Load wake-up electrode IIR1 LP Filter buffer (X, Y) with DC tracker value
-			FilterIIR1BufferInit(WAKE_UP_ELECTRODE, ((tFrac32)(DCTrackerDataBuffer[WAKE_UP_ELECTRODE])), (((tFrac32)(DCTrackerDataBuffer[WAKE_UP_ELECTRODE]))),frequencyID);
+			FilterIIR1BufferInit(&elecData[WAKE_UP_ELECTRODE].LPFilterBuffer[frequencyID], ((tFrac32)(elecData[WAKE_UP_ELECTRODE].DCTrackerDataBuffer)), (((tFrac32)(elecData[WAKE_UP_ELECTRODE].DCTrackerDataBuffer))));
 		}
 		// Set back original frequencyID
 		frequencyID = frequencyIDsave;
@@ -1191,15 +2963,19 @@ void ElectrodeWakeAndTouchElecSense(void)
  *****************************************************************************/
 void ElectrodeSensingCyclesChangeEGS(void)
 {
-	if(electrodeTouch[WAKE_UP_ELECTRODE][0] == 1)
+	if(elecData[WAKE_UP_ELECTRODE].electrodeTouch[0] == 1)
 	{
 		// Change the number of touch buttons sensing cycles per sample to active
 		numberOfElectrodeSensingCyclesPerSample = NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_ACTIVE;
+		// EGS conversion back to full resolution
+		egsAdcResolution = ADC_RESOLUTION_12BIT;
 	}
 	else
 	{
 		// Change the number of touch buttons sensing cycles per sample to idle
 		numberOfElectrodeSensingCyclesPerSample = NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_IDLE;
+		// EGS idle polling at reduced resolution
+		egsAdcResolution = EGS_IDLE_ADC_RESOLUTION;
 	}
 }
 
@@ -1215,106 +2991,193 @@ void ElectrodeSensingCyclesChangeEGS(void)
  *****************************************************************************/
 void ElectrodeTouchElecSense(void)
 {
+	tSenseCtx  senseCtx;
+
 #ifdef DEBUG_ALGORITHM
 	// Pin clear
 	R_RMW32(&(DA_GPIO->PCOR), DA_PIN, 1);
 #endif
 
-	// Configure all touch button (and EGS) electrodes floating
-	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
-	{
-		ElectrodeFloat(&elecStruct[elecNum]);
-	}
+	// Convert all touch button electrodes capacitance to equivalent voltage
+	ElectrodeTouchElecAcquire();
 
-#if SLIDER_ENABLE
-	// Configure all slider electrodes floating
-	for (elecNum = 0; elecNum < (NUMBER_OF_SLIDER_ELECTRODES); elecNum++)
-	{
-		ElectrodeFloat(&sliderElecStruct[elecNum]);
-	}
+	// Sensing context of the scan
+	senseCtx.elecDataPtr = elecData;
+	senseCtx.scanMask = elecScannedMask;
+	senseCtx.frequencyID = frequencyID;
+
+	// Detect and qualify touch button electrodes touch event
+	ElectrodeTouchProcess(&senseCtx);
+
+#ifdef DEBUG_ALGORITHM
+	// Pin set
+	R_RMW32(&(DA_GPIO->PSOR), DA_PIN, 1);
+#endif
+}
+
+/*****************************************************************************
+ *
+ * Function: void ElectrodeTouchElecAcquire(void)
+ *
+ * Description: Convert all touch button electrodes capacitance to equivalent voltage,
+ * 				electrodes floating during conversion and driven to GND afterwards
+ *
+ *****************************************************************************/
+void ElectrodeTouchElecAcquire(void)
+{
+	// Configure all touch button (and EGS) and slider electrodes floating
+	ElectrodesFloatAll();
+
+	// Convert all touch button electrodes capacitance to equivalent voltage
+	ElectrodesCapToVoltConv();
+
+	// Drive all touch button (and EGS) and slider electrodes to GND
+	ElectrodesGndAll();
+
+#if TS_TEMP_COMPENSATION
+	// Convert the on-chip temperature sensor, if due
+	ElectrodeTempSensorAcquire();
+#endif
+}
+
+/*****************************************************************************
+ *
+ * Function: void ElectrodeTouchProcess(tSenseCtx *ctxPtr)
+ *
+ * Input: Sensing context of the scan
+ *
+ * Description: Process raw data of all touch button electrodes - DC tracker, IIR LP filter,
+ * 				touch detection and qualification
+ *
+ *****************************************************************************/
+void ElectrodeTouchProcess(tSenseCtx *ctxPtr)
+{
+	uint32_t  elecNum, scanMask;
+	uint8_t   scanFrequencyID;
+	tElecData  *elecDataPtr;
+
+	// Apply touch button electrodes enable change
+	ElectrodeEnableUpdate();
+
+#if TS_COMMON_MODE_REJECTION
+	// Remove common-mode noise from the raw data
+	ElectrodeCommonModeReject(ctxPtr);
 #endif
 
+	// Scan loop state kept in locals
+	scanMask = ctxPtr->scanMask & elecEnabledMask;
+	scanFrequencyID = ctxPtr->frequencyID;
+	elecDataPtr = ctxPtr->elecDataPtr;
+
 	// All touch button electrodes
-	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
+	for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++, elecDataPtr++)
 	{
-		// Convert electrode capacitance to equivalent voltage
-		ElectrodeCapToVoltConvELCH(elecNum);
+		// Electrode disabled or not scanned in this period?
+		if ((scanMask & (1 << elecNum)) == 0)
+		{
+			continue;
+		}
+
+		// Electrode re-enabled?
+		if (elecDataPtr->baselineReseed == YES)
+		{
+			// Re-seed baseline and filters from the first raw data
+			ElectrodeBaselineReseed(elecNum, ctxPtr);
+		}
 
 		// Update DC Tracker, if electrode not touched
-		if (electrodeTouch[elecNum][frequencyID] == 0)
+		if (elecDataPtr->electrodeTouch[scanFrequencyID] == 0)
 		{
 			// Update DC Tracker
-			DCTrackerDataBuffer[elecNum] = DCTracker(adcDataElectrodeDischargeRaw[elecNum][frequencyID], &(DCTrackerDataBufferRaw[elecNum]), DCTrackerDataShift[elecNum]);
+			elecDataPtr->DCTrackerDataBuffer = DCTracker(elecDataPtr->adcDataElectrodeDischargeRaw[scanFrequencyID], &(elecDataPtr->DCTrackerDataBufferRaw), elecDataPtr->DCTrackerDataShift, &(elecDataPtr->DCTrackerSlewRun));
+#if TS_ADAPTIVE_SENSING_CYCLES
+			// Adapt electrode sensing cycles per sample to its noise
+			ElectrodeSensingCyclesAdapt(elecNum, ctxPtr);
+#endif
+		}
+#if TS_DCTRACKER_ADAPTIVE_SLEW || TS_TEMP_COMPENSATION
+		else
+		{
+#if TS_DCTRACKER_ADAPTIVE_SLEW
+			// DC tracker frozen while touched, slew back to the slowest step
+			elecDataPtr->DCTrackerSlewRun = 0;
+#endif
+#if TS_TEMP_COMPENSATION
+			// DC tracker frozen, restart the temperature learning window
+			elecDataPtr->tempCompTouched = YES;
+#endif
 		}
+#endif
 
 #if DECIMATION_FILTER
 		// Decimation filtering
-		DecimationFilter(elecNum);
+		DecimationFilter(elecNum, ctxPtr);
 #endif
 
 #if DECIMATION_FILTER
 		// IIR LP Filter fed by DF data
-		LPFilterData[elecNum][frequencyID] = FilterIIR1(elecNum, (tFrac32)(adcDataElectrodeDischargeRawDF[elecNum][frequencyID]), frequencyID);
+		elecDataPtr->LPFilterData[scanFrequencyID] = FilterIIR1(elecDataPtr->LPFilterType, &elecDataPtr->LPFilterBuffer[scanFrequencyID], (tFrac32)(elecDataPtr->adcDataElectrodeDischargeRawDF[scanFrequencyID]));
 #else
 		// IIR LP filter fed by raw data
-		LPFilterData[elecNum][frequencyID] = FilterIIR1(elecNum, (tFrac32)(adcDataElectrodeDischargeRaw[elecNum][frequencyID]), frequencyID);
+		elecDataPtr->LPFilterData[scanFrequencyID] = FilterIIR1(elecDataPtr->LPFilterType, &elecDataPtr->LPFilterBuffer[scanFrequencyID], (tFrac32)(elecDataPtr->adcDataElectrodeDischargeRaw[scanFrequencyID]));
 #endif
 
 		// Calculate electrode touch and release thresholds
-		detectorThresholdTouch[elecNum] = DCTrackerDataBuffer[elecNum] - detectorThresholdTouchDelta[elecNum];
-		detectorThresholdRelease[elecNum] = DCTrackerDataBuffer[elecNum] - detectorThresholdReleaseDelta[elecNum];
+		elecDataPtr->detectorThresholdTouch = elecDataPtr->DCTrackerDataBuffer - elecDataPtr->detectorThresholdTouchDelta;
+		elecDataPtr->detectorThresholdRelease = elecDataPtr->DCTrackerDataBuffer - elecDataPtr->detectorThresholdReleaseDelta;
 
 		// Electrode touched ?
-		ElectrodeTouchDetect(elecNum);
-
-	}
+		ElectrodeTouchDetect(elecNum, ctxPtr);
 
-	// Drive all touch button (and EGS) electrodes to GND
-	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
-	{
-		ElectrodeGnd(&elecStruct[elecNum]);
 	}
 
-#if SLIDER_ENABLE
-	// Drive all slider electrodes to GND
-	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
-	{
-		ElectrodeGnd(&sliderElecStruct[elecNum]);
-	}
+#if TS_TEMP_COMPENSATION
+	// Temperature feed-forward to the baselines
+	ElectrodeTempCompUpdate();
 #endif
 
 	// Qualify the touch event
 	// More the one electrode reports touch?
-	electrodeTouchQualify();
+	electrodeTouchQualify(ctxPtr);
 
-#ifdef DEBUG_ALGORITHM
-	// Pin set
-	R_RMW32(&(DA_GPIO->PSOR), DA_PIN, 1);
+#if TS_ROI_SCAN
+	// Schedule touch button electrodes scan of the next period
+	ElectrodeRoiScanUpdate(ctxPtr);
 #endif
-
 }
 
 /*****************************************************************************
  *
- * Function: void ElectrodeSensingCyclesChange(void)
+ * Function: void ElectrodeSensingCyclesChange(uint8_t scanFrequencyID)
+ *
+ * Input: Scanning period/frequency ID of the scan
  *
  * Description: Changes the number of sensing cycles per sample for touch buttons based on detected proximity on touch buttons
  *
  *****************************************************************************/
-void ElectrodeSensingCyclesChange(void)
+void ElectrodeSensingCyclesChange(uint8_t scanFrequencyID)
 {
+#if (TS_RAW_DATA_CALCULATION == OVERSAMPLING)
+	uint32_t  elecNum;
+	uint8_t   frequencyNum;
+#endif
 	uint8_t electrodeNum;
 
+#if FREQUENCY_HOPPING
+	// Proximity checked on both periods/frequencies, scan ID not used
+	(void)scanFrequencyID;
+#endif
+
 	// Detect if any of the button electrodes was reported as proximately touched
 	for(electrodeNum = 0; electrodeNum < NUMBER_OF_TOUCH_ELECTRODES; electrodeNum++)
 	{
 #if FREQUENCY_HOPPING
 		// If on both frequencies proximity detected
-		if((LPFilterData[electrodeNum][0] < (DCTrackerDataBuffer[electrodeNum] - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)) &&  \
-				(LPFilterData[electrodeNum][1] < (DCTrackerDataBuffer[electrodeNum] - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)))
+		if((elecData[electrodeNum].LPFilterData[0] < (elecData[electrodeNum].DCTrackerDataBuffer - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)) &&  \
+				(elecData[electrodeNum].LPFilterData[1] < (elecData[electrodeNum].DCTrackerDataBuffer - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)))
 #else
 			// If proximity detected
-			if(LPFilterData[electrodeNum][frequencyID] < (DCTrackerDataBuffer[electrodeNum] - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA))
+			if(elecData[electrodeNum].LPFilterData[scanFrequencyID] < (elecData[electrodeNum].DCTrackerDataBuffer - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA))
 #endif
 			{
 				// Report wake up
@@ -1340,44 +3203,35 @@ void ElectrodeSensingCyclesChange(void)
 						for(elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
 						{
 							// Set Threshold delta values to correspond to number of samples taken in Active state
-							detectorThresholdTouchDelta[elecNum] *= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
-							detectorThresholdReleaseDelta[elecNum] *= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
+							elecData[elecNum].detectorThresholdTouchDelta *= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
+							elecData[elecNum].detectorThresholdReleaseDelta *= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
 						}
-						// Save frequencyID
-						frequencyIDsave = frequencyID;
 
 						// All (both) used scanning frequencies
-						for (frequencyID = 0; frequencyID < NUMBER_OF_HOPPING_FREQUENCIES; frequencyID++)
+						for (frequencyNum = 0; frequencyNum < NUMBER_OF_HOPPING_FREQUENCIES; frequencyNum++)
 						{
 
 							// All touch button electrodes
 							for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
 							{
 								// Load IIR1 LP Filter buffer (X, Y) exactly with corresponding value
-								FilterIIR1BufferInit(elecNum, ((tFrac32)(DCTrackerDataBuffer[elecNum] - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)), \
-										((tFrac32)(DCTrackerDataBuffer[elecNum] - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)),frequencyID);
+								FilterIIR1BufferInit(&elecData[elecNum].LPFilterBuffer[frequencyNum], ((tFrac32)(elecData[elecNum].DCTrackerDataBuffer - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)), \
+										((tFrac32)(elecData[elecNum].DCTrackerDataBuffer - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)));
 							}
 						}
-						// Set back original frequencyID
-						frequencyID = frequencyIDsave;
 
 #if DECIMATION_FILTER
-						// Save frequencyID
-						frequencyIDsave = frequencyID;
-
 						// All (both) used scanning frequencies
-						for (frequencyID = 0; frequencyID < NUMBER_OF_HOPPING_FREQUENCIES; frequencyID++)
+						for (frequencyNum = 0; frequencyNum < NUMBER_OF_HOPPING_FREQUENCIES; frequencyNum++)
 						{
 
 							// All touch button electrodes
 							for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
 							{
 								// Load DF array exactly with corresponding value
-								adcDataElectrodeDischargeRawDF[elecNum][frequencyID]= DCTrackerDataBuffer[elecNum] - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA;
+								elecData[elecNum].adcDataElectrodeDischargeRawDF[frequencyNum]= elecData[elecNum].DCTrackerDataBuffer - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA;
 							}
 						}
-						// Set back original frequencyID
-						frequencyID = frequencyIDsave;
 #endif
 					}
 #endif
@@ -1411,47 +3265,38 @@ void ElectrodeSensingCyclesChange(void)
 							for(elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
 							{
 								// Set Threshold delta values to correspond to number of samples taken in Idle state
-								detectorThresholdTouchDelta[elecNum] /= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
-								detectorThresholdReleaseDelta[elecNum] /= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
+								elecData[elecNum].detectorThresholdTouchDelta /= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
+								elecData[elecNum].detectorThresholdReleaseDelta /= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_MULTIPLY;
 							}
 
-							// Save frequencyID
-							frequencyIDsave = frequencyID;
 
 							// All (both) used scanning frequencies
-							for (frequencyID = 0; frequencyID < NUMBER_OF_HOPPING_FREQUENCIES; frequencyID++)
+							for (frequencyNum = 0; frequencyNum < NUMBER_OF_HOPPING_FREQUENCIES; frequencyNum++)
 							{
 
 								// All touch button electrodes
 								for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
 								{
 									// Load IIR1 LP Filter buffer (X, Y) with DC tracker value
-									FilterIIR1BufferInit(elecNum, ((tFrac32)(DCTrackerDataBuffer[elecNum])), (((tFrac32)(DCTrackerDataBuffer[elecNum]))),frequencyID);
+									FilterIIR1BufferInit(&elecData[elecNum].LPFilterBuffer[frequencyNum], ((tFrac32)(elecData[elecNum].DCTrackerDataBuffer)), (((tFrac32)(elecData[elecNum].DCTrackerDataBuffer))));
 								}
 							}
-							// Set back original frequencyID
-							frequencyID = frequencyIDsave;
 
 							// Report electrodes Oversampling De-activation done
 							electrodesOversamplingActivationReport = 0;
 
 #if DECIMATION_FILTER
-							// Save frequencyID
-							frequencyIDsave = frequencyID;
-
 							// All (both) used scanning frequencies
-							for (frequencyID = 0; frequencyID < NUMBER_OF_HOPPING_FREQUENCIES; frequencyID++)
+							for (frequencyNum = 0; frequencyNum < NUMBER_OF_HOPPING_FREQUENCIES; frequencyNum++)
 							{
 
 								// All touch button electrodes
 								for (elecNum = 0; elecNum < NUMBER_OF_TOUCH_ELECTRODES; elecNum++)
 								{
 									// Load DF array with new DC tracker value
-									adcDataElectrodeDischargeRawDF[elecNum][frequencyID]= DCTrackerDataBuffer[elecNum];
+									elecData[elecNum].adcDataElectrodeDischargeRawDF[frequencyNum]= elecData[elecNum].DCTrackerDataBuffer;
 								}
 							}
-							// Set back original frequencyID
-							frequencyID = frequencyIDsave;
 #endif
 						}
 #endif
@@ -1475,6 +3320,76 @@ void ElectrodeSensingCyclesChange(void)
 // Wake up electrode define
 #endif
 
+#if TS_ADAPTIVE_SENSING_CYCLES
+/*****************************************************************************
+ *
+ * Function: void ElectrodeSensingCyclesAdapt(uint32_t electrodeNum, tSenseCtx *ctxPtr)
+ *
+ * Input: Number of not touched touch button electrode, sensing context of the scan
+ *
+ * Description: Update electrode raw data noise variance and adapt the electrode number of
+ * 				sensing cycles per sample to reach the target SNR with the fewest cycles
+ *
+ * Note: Noise variance is inversely proportional to the number of sensing cycles,
+ * 		 the number is decreased only if the target SNR is kept with one cycle less
+ *
+ *****************************************************************************/
+void ElectrodeSensingCyclesAdapt(uint32_t electrodeNum, tSenseCtx *ctxPtr)
+{
+	tElecData  *elecDataPtr = &ctxPtr->elecDataPtr[electrodeNum];
+
+	int32_t   deviation;
+	uint32_t  deviationSquare;
+	uint64_t  thresholdSquare, noiseSquare;
+
+	// Raw data deviation from the DC tracker (baseline)
+	deviation = elecDataPtr->adcDataElectrodeDischargeRaw[ctxPtr->frequencyID] - elecDataPtr->DCTrackerDataBuffer;
+	if (deviation < 0)
+	{
+		deviation = -deviation;
+	}
+	// Limit deviation square to 32 bits
+	if (deviation > 0xFFFF)
+	{
+		deviation = 0xFFFF;
+	}
+	deviationSquare = (uint32_t)deviation * (uint32_t)deviation;
+
+	// Noise variance - deviation square exponential moving average
+	if (deviationSquare > elecDataPtr->elecNoiseVariance)
+	{
+		elecDataPtr->elecNoiseVariance += (deviationSquare - elecDataPtr->elecNoiseVariance) >> ADAPTIVE_SENSING_NOISE_FILTER_SHIFT;
+	}
+	else
+	{
+		elecDataPtr->elecNoiseVariance -= (elecDataPtr->elecNoiseVariance - deviationSquare) >> ADAPTIVE_SENSING_NOISE_FILTER_SHIFT;
+	}
+
+	// Touch threshold delta square and target noise square
+	thresholdSquare = (uint64_t)(elecDataPtr->detectorThresholdTouchDelta * elecDataPtr->detectorThresholdTouchDelta);
+	noiseSquare = (uint64_t)elecDataPtr->elecNoiseVariance * (ADAPTIVE_SENSING_TARGET_SNR * ADAPTIVE_SENSING_TARGET_SNR);
+
+	// Target SNR not reached?
+	if (thresholdSquare < noiseSquare)
+	{
+		// More sensing cycles, up to the actual (idle or active) number
+		if (elecDataPtr->elecSensingCyclesPerSample < numberOfElectrodeSensingCyclesPerSample)
+		{
+			elecDataPtr->elecSensingCyclesPerSample++;
+		}
+	}
+	// Target SNR kept with one sensing cycle less?
+	else if (elecDataPtr->elecSensingCyclesPerSample > ADAPTIVE_SENSING_MIN_CYCLES)
+	{
+		if ((thresholdSquare * (elecDataPtr->elecSensingCyclesPerSample - 1)) > (noiseSquare * elecDataPtr->elecSensingCyclesPerSample * ADAPTIVE_SENSING_HYSTERESIS))
+		{
+			// Less sensing cycles
+			elecDataPtr->elecSensingCyclesPerSample--;
+		}
+	}
+}
+#endif
+
 #if FREQUENCY_HOPPING
 /*****************************************************************************
  *
@@ -1487,7 +3402,7 @@ void FrequencyHop(void)
 {
 #ifdef WAKE_UP_ELECTRODE
 	// If EGS touched
-	if(electrodeTouch[WAKE_UP_ELECTRODE][0] == 1)
+	if(elecData[WAKE_UP_ELECTRODE].electrodeTouch[0] == 1)
 #else
 		// Frequency hopping all the time
 		if(1)
@@ -1530,22 +3445,26 @@ void FrequencyHop(void)
 #if DECIMATION_FILTER
 /*****************************************************************************
  *
- * Function: void DecimationFilter(uint32_t electrodeNum)
+ * Function: void DecimationFilter(uint32_t electrodeNum, tSenseCtx *ctxPtr)
+ *
+ * Input: Electrode number, sensing context of the scan
  *
  * Description: Increment or decrement decimation filter value
  *
  *****************************************************************************/
-void DecimationFilter(uint32_t electrodeNum)
+void DecimationFilter(uint32_t electrodeNum, tSenseCtx *ctxPtr)
 {
+	tElecData  *elecDataPtr = &ctxPtr->elecDataPtr[electrodeNum];
+	uint8_t   scanFrequencyID = ctxPtr->frequencyID;
 
 	// Is the electrode raw data value still smaller than electrode decimation filter value?
-	if(adcDataElectrodeDischargeRaw[electrodeNum][frequencyID] < adcDataElectrodeDischargeRawDF[electrodeNum][frequencyID])
+	if(elecDataPtr->adcDataElectrodeDischargeRaw[scanFrequencyID] < elecDataPtr->adcDataElectrodeDischargeRawDF[scanFrequencyID])
 	{
 		// Decrement DF value - follow the raw data down
-		adcDataElectrodeDischargeRawDF[electrodeNum][frequencyID] -= DECIMATION_STEP ;
+		elecDataPtr->adcDataElectrodeDischargeRawDF[scanFrequencyID] -= DECIMATION_STEP ;
 	}
 	// Is the electrode raw data value same as electrode decimation filter value?
-	else if ((adcDataElectrodeDischargeRaw[electrodeNum][frequencyID] == adcDataElectrodeDischargeRawDF[electrodeNum][frequencyID]))
+	else if ((elecDataPtr->adcDataElectrodeDischargeRaw[scanFrequencyID] == elecDataPtr->adcDataElectrodeDischargeRawDF[scanFrequencyID]))
 	{
 		// Do nothing
 	}
@@ -1553,7 +3472,7 @@ void DecimationFilter(uint32_t electrodeNum)
 	else
 	{
 		// Increment DF value - follow  the raw data back up to the baseline
-		adcDataElectrodeDischargeRawDF[electrodeNum][frequencyID] += DECIMATION_STEP;
+		elecDataPtr->adcDataElectrodeDischargeRawDF[scanFrequencyID] += DECIMATION_STEP;
 	}
 
 }
@@ -1568,7 +3487,7 @@ void DecimationFilterCMRchange(void)
 {
 #ifdef WAKE_UP_ELECTRODE
 	// If EGS touched
-	if(electrodeTouch[WAKE_UP_ELECTRODE][0] == 1)
+	if(elecData[WAKE_UP_ELECTRODE].electrodeTouch[0] == 1)
 #else
 		// Decimation filtering all the time
 		if(1)
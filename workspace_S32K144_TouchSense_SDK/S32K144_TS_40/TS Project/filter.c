@@ -24,17 +24,7 @@
 *******************************************************************************/
 // IIR1 filter coefficients
 tFrac32 FilterIIR1CoeffB0[NUMBER_OF_FILTERS_USED], FilterIIR1CoeffB1[NUMBER_OF_FILTERS_USED], FilterIIR1CoeffA1[NUMBER_OF_FILTERS_USED];
-#if SLIDER_ENABLE
-// IIR1 filter buffer x(k-1), y(k-1)
-tFrac32 FilterIIR1BufferX[NUMBER_OF_ELECTRODES + NUMBER_OF_SLIDER_ELECTRODES][NUMBER_OF_FILTERS_USED][NUMBER_OF_HOPPING_FREQUENCIES], FilterIIR1BufferY[NUMBER_OF_ELECTRODES + NUMBER_OF_SLIDER_ELECTRODES][NUMBER_OF_FILTERS_USED][NUMBER_OF_HOPPING_FREQUENCIES];
-// IIR1 Filter type
-extern uint8_t   LPFilterType[NUMBER_OF_ELECTRODES + NUMBER_OF_SLIDER_ELECTRODES];
-#else
-// IIR1 filter buffer x(k-1), y(k-1)
-tFrac32 FilterIIR1BufferX[NUMBER_OF_ELECTRODES][NUMBER_OF_FILTERS_USED][NUMBER_OF_HOPPING_FREQUENCIES], FilterIIR1BufferY[NUMBER_OF_ELECTRODES][NUMBER_OF_FILTERS_USED][NUMBER_OF_HOPPING_FREQUENCIES];
-// IIR1 Filter type
-extern uint8_t   LPFilterType[NUMBER_OF_ELECTRODES];
-#endif
+
 /****************************************************************************
 * Math functions
 ****************************************************************************/
@@ -102,26 +92,26 @@ void FilterIIR1Init(void)
 
 /*****************************************************************************
 *
-* void FilterIIR1BufferInit(uint8_t elec, tFrac32 valueBufferX, tFrac32 valueBufferY, uint8_t frequencyID)
+* void FilterIIR1BufferInit(tFilterIIR1Buffer *bufferPtr, tFrac32 valueBufferX, tFrac32 valueBufferY)
 *
 * Description: Init IIR1 low pass filter buffer
 *
 *****************************************************************************/
-void FilterIIR1BufferInit(uint8_t elec, tFrac32 valueBufferX, tFrac32 valueBufferY, uint8_t frequencyID)
+void FilterIIR1BufferInit(tFilterIIR1Buffer *bufferPtr, tFrac32 valueBufferX, tFrac32 valueBufferY)
 {
-	FilterIIR1BufferX[elec][LPFilterType[elec]][frequencyID] = valueBufferX << IIR_FILTER_VALUE_SHIFT;
-	FilterIIR1BufferY[elec][LPFilterType[elec]][frequencyID] = valueBufferY << IIR_FILTER_VALUE_SHIFT;
+	bufferPtr->bufferX = valueBufferX << IIR_FILTER_VALUE_SHIFT;
+	bufferPtr->bufferY = valueBufferY << IIR_FILTER_VALUE_SHIFT;
 }
 
 /*****************************************************************************
 *
-* Function: tFrac16 FilterIIR1(uint8_t elec, tFrac32 x_k, uint8_t frequencyID)
+* Function: tFrac32 FilterIIR1(uint8_t filterType, tFilterIIR1Buffer *bufferPtr, tFrac32 x_k)
 *
 * Description: IIR1 filter implementation
 *              y(k) = b0*x(k) + b1*x(k-1) - a1*y(k-1)
 *
 *****************************************************************************/
-tFrac32 FilterIIR1(uint8_t elec, tFrac32 x_k, uint8_t frequencyID)
+tFrac32 FilterIIR1(uint8_t filterType, tFilterIIR1Buffer *bufferPtr, tFrac32 x_k)
 {
 	register tFrac32 M1;
 	register tFrac32 M2;
@@ -133,13 +123,13 @@ tFrac32 FilterIIR1(uint8_t elec, tFrac32 x_k, uint8_t frequencyID)
 	x_k = x_k << IIR_FILTER_VALUE_SHIFT;
 
     // M1 = b0 * x(k)
-	M1 = Mul_F32_C(FilterIIR1CoeffB0[LPFilterType[elec]], x_k);
+	M1 = Mul_F32_C(FilterIIR1CoeffB0[filterType], x_k);
 
     // M2 = b1 * x(k-1)
-    M2 = Mul_F32_C(FilterIIR1CoeffB1[LPFilterType[elec]], FilterIIR1BufferX[elec][LPFilterType[elec]][frequencyID]);
+    M2 = Mul_F32_C(FilterIIR1CoeffB1[filterType], bufferPtr->bufferX);
 
     // M3 = a1 * y(k-1)
-    M3 = Mul_F32_C(FilterIIR1CoeffA1[LPFilterType[elec]], FilterIIR1BufferY[elec][LPFilterType[elec]][frequencyID]);
+    M3 = Mul_F32_C(FilterIIR1CoeffA1[filterType], bufferPtr->bufferY);
 
     // Acc = M2 - M3
     Acc = (tFrac32)(M2 - M3);
@@ -152,9 +142,9 @@ tFrac32 FilterIIR1(uint8_t elec, tFrac32 x_k, uint8_t frequencyID)
 
 	// IIR1 filter buffer x(k-1), y(k-1)
 	// x(k-1)
-	FilterIIR1BufferX[elec][LPFilterType[elec]][frequencyID] = x_k;
+	bufferPtr->bufferX = x_k;
 	// y(k-1)
-	FilterIIR1BufferY[elec][LPFilterType[elec]][frequencyID] = y_k;
+	bufferPtr->bufferY = y_k;
 
 	// Shift right the result to compensate value increase due to desired highest resolution
 	y_k = y_k >> IIR_FILTER_VALUE_SHIFT;
@@ -162,3 +152,138 @@ tFrac32 FilterIIR1(uint8_t elec, tFrac32 x_k, uint8_t frequencyID)
     // Return value
     return(y_k);
 }
+
+/*****************************************************************************
+*
+* Function: void TrimAccInit(tTrimAcc *accPtr, uint8_t rejectLow, uint8_t rejectHigh)
+*
+* Input: Accumulator, number of rejected lowest and highest samples (max. TRIM_ACC_REJECT_MAX)
+*
+* Description: Reset trimmed mean sample accumulator
+*
+*****************************************************************************/
+void TrimAccInit(tTrimAcc *accPtr, uint8_t rejectLow, uint8_t rejectHigh)
+{
+	// No samples
+	accPtr->sum = 0;
+	accPtr->samplesNum = 0;
+
+	// Number of rejected samples, limited by the buffers size
+	accPtr->rejectLow = (rejectLow < TRIM_ACC_REJECT_MAX) ? rejectLow : TRIM_ACC_REJECT_MAX;
+	accPtr->rejectHigh = (rejectHigh < TRIM_ACC_REJECT_MAX) ? rejectHigh : TRIM_ACC_REJECT_MAX;
+}
+
+/*****************************************************************************
+*
+* Function: void TrimAccAdd(tTrimAcc *accPtr, int16_t sample)
+*
+* Input: Accumulator, new sample
+*
+* Description: Add sample to the sum, keep the lowest and highest samples sorted
+*
+* Note: Insertion into rejectLow (rejectHigh) long buffers, no pass over all samples
+*
+*****************************************************************************/
+void TrimAccAdd(tTrimAcc *accPtr, int16_t sample)
+{
+	uint16_t  bufferNum, i;
+
+	// Samples sum
+	accPtr->sum += sample;
+
+	// Lowest samples buffer filled
+	bufferNum = (accPtr->samplesNum < accPtr->rejectLow) ? accPtr->samplesNum : accPtr->rejectLow;
+
+	// Buffer not full or sample lower than the highest of the lowest samples?
+	if ((bufferNum < accPtr->rejectLow) || ((bufferNum > 0) && (sample < accPtr->low[bufferNum - 1])))
+	{
+		// Free position, or the highest of the lowest samples dropped
+		i = (bufferNum < accPtr->rejectLow) ? bufferNum : (bufferNum - 1);
+
+		// Shift higher samples up, insert the new one
+		while ((i > 0) && (accPtr->low[i - 1] > sample))
+		{
+			accPtr->low[i] = accPtr->low[i - 1];
+			i--;
+		}
+		accPtr->low[i] = sample;
+	}
+
+	// Highest samples buffer filled
+	bufferNum = (accPtr->samplesNum < accPtr->rejectHigh) ? accPtr->samplesNum : accPtr->rejectHigh;
+
+	// Buffer not full or sample higher than the lowest of the highest samples?
+	if ((bufferNum < accPtr->rejectHigh) || ((bufferNum > 0) && (sample > accPtr->high[bufferNum - 1])))
+	{
+		// Free position, or the lowest of the highest samples dropped
+		i = (bufferNum < accPtr->rejectHigh) ? bufferNum : (bufferNum - 1);
+
+		// Shift lower samples down, insert the new one
+		while ((i > 0) && (accPtr->high[i - 1] < sample))
+		{
+			accPtr->high[i] = accPtr->high[i - 1];
+			i--;
+		}
+		accPtr->high[i] = sample;
+	}
+
+	// Number of samples
+	accPtr->samplesNum++;
+}
+
+/*****************************************************************************
+*
+* Function: int32_t TrimAccSum(tTrimAcc *accPtr)
+*
+* Input: Accumulator
+*
+* Output: Sum of samples without the rejected lowest and highest samples
+*
+* Description: Trimmed sum, all samples sum if there are not enough samples to reject
+*
+*****************************************************************************/
+int32_t TrimAccSum(tTrimAcc *accPtr)
+{
+	int32_t  sum;
+	uint8_t  i;
+
+	// All samples sum
+	sum = accPtr->sum;
+
+	// Enough samples?
+	if (accPtr->samplesNum > (accPtr->rejectLow + accPtr->rejectHigh))
+	{
+		// Subtract the lowest samples
+		for (i = 0; i < accPtr->rejectLow; i++)
+		{
+			sum -= accPtr->low[i];
+		}
+		// Subtract the highest samples
+		for (i = 0; i < accPtr->rejectHigh; i++)
+		{
+			sum -= accPtr->high[i];
+		}
+	}
+
+	return sum;
+}
+
+/*****************************************************************************
+*
+* Function: uint16_t TrimAccSamplesNum(tTrimAcc *accPtr)
+*
+* Input: Accumulator
+*
+* Output: Number of samples in the trimmed sum
+*
+*****************************************************************************/
+uint16_t TrimAccSamplesNum(tTrimAcc *accPtr)
+{
+	// Enough samples?
+	if (accPtr->samplesNum > (accPtr->rejectLow + accPtr->rejectHigh))
+	{
+		return (accPtr->samplesNum - accPtr->rejectLow - accPtr->rejectHigh);
+	}
+
+	return accPtr->samplesNum;
+}
@@ -12,23 +12,22 @@
 #ifndef __FILTER_H
 #define __FILTER_H
 
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+
 /*******************************************************************************
 * Type defines
 *******************************************************************************/
-typedef signed char int8_t;
-typedef unsigned char uint8_t;
-typedef volatile signed char vint8_t;
-typedef volatile unsigned char vuint8_t;
+typedef volatile int8_t vint8_t;
+typedef volatile uint8_t vuint8_t;
 
-typedef signed short int16_t;
-typedef unsigned short uint16_t;
-typedef volatile signed short vint16_t;
-typedef volatile unsigned short vuint16_t;
+typedef volatile int16_t vint16_t;
+typedef volatile uint16_t vuint16_t;
 
-typedef signed long int32_t;
-typedef unsigned long uint32_t;
-typedef volatile signed long vint32_t;
-typedef volatile unsigned long vuint32_t;
+typedef volatile int32_t vint32_t;
+typedef volatile uint32_t vuint32_t;
 
 typedef int16_t   tFrac16;        // 16-bit signed fractional Q1.15 type
 typedef int32_t   tFrac32;        // 32-bit signed fractional Q1.31 type
@@ -36,7 +35,7 @@ typedef float     tFloat;         // single precision float type
 typedef int32_t   tS32;
 typedef uint32_t   tU32;
 typedef uint16_t   tU16;
-typedef signed long   tS64;       // signed 64-bit integer type
+typedef int64_t   tS64;       // signed 64-bit integer type
 
 /*******************************************************************************
 * Project Related Defines
@@ -73,12 +72,42 @@ typedef signed long   tS64;       // signed 64-bit integer type
 // Macro converting a signed fractional [-1,1) number into a 32-bit fixed point number in format Q1.31.
 #define FRAC32(x)           ((tFrac32) (((x) < SFRACT_MAX) ? (((x) >= SFRACT_MIN) ? ((x)*2147483648.0) : INT32_MIN) : INT32_MAX))
 
+/*******************************************************************************
+* IIR1 filter buffer x(k-1), y(k-1) of one electrode and hopping frequency
+*******************************************************************************/
+typedef struct
+{
+	tFrac32   bufferX;                       // x(k-1)
+	tFrac32   bufferY;                       // y(k-1)
+}tFilterIIR1Buffer;
+
+/*******************************************************************************
+* Trimmed mean sample accumulator
+* Maximal number of rejected lowest (highest) samples
+*******************************************************************************/
+#define TRIM_ACC_REJECT_MAX   4
+
+typedef struct
+{
+	int32_t   sum;                           // Sum of all samples
+	uint16_t  samplesNum;                    // Number of all samples
+	uint8_t   rejectLow;                     // Number of rejected lowest samples
+	uint8_t   rejectHigh;                    // Number of rejected highest samples
+	int16_t   low[TRIM_ACC_REJECT_MAX];      // Lowest samples, ascending
+	int16_t   high[TRIM_ACC_REJECT_MAX];     // Highest samples, descending
+}tTrimAcc;
+
 /*******************************************************************************
 * Function prototypes
 ******************************************************************************/
 void FilterIIR1Init(void);
-void FilterIIR1BufferInit(uint8_t elec, tFrac32 valueBufferX, tFrac32 valueBufferY, uint8_t frequencyID);
-tFrac32 FilterIIR1(uint8_t elec, tFrac32 x_k, uint8_t frequencyID);
+void FilterIIR1BufferInit(tFilterIIR1Buffer *bufferPtr, tFrac32 valueBufferX, tFrac32 valueBufferY);
+tFrac32 FilterIIR1(uint8_t filterType, tFilterIIR1Buffer *bufferPtr, tFrac32 x_k);
+
+void TrimAccInit(tTrimAcc *accPtr, uint8_t rejectLow, uint8_t rejectHigh);
+void TrimAccAdd(tTrimAcc *accPtr, int16_t sample);
+int32_t TrimAccSum(tTrimAcc *accPtr);
+uint16_t TrimAccSamplesNum(tTrimAcc *accPtr);
 
 
 #endif /* __FILTER_H */
@@ -35,18 +35,23 @@ tElecStatus   sliderElectrodesStatus;
 tElecStruct  sliderElecStruct[NUMBER_OF_SLIDER_ELECTRODES];
 extern tElecStruct  elecStruct[NUMBER_OF_ELECTRODES];
 
+// Slider electrode processing state
+tSliderElecData  sliderElecData[NUMBER_OF_SLIDER_ELECTRODES];
+extern tElecData  elecData[NUMBER_OF_ELECTRODES];
+// Number of self-trim cycles to calculate DC tracker power-up value
+extern uint16_t  selfTrimCycles;
+
 // Slider electrode capacitance to equivalent voltage conversion
 int16_t   numberOfElectrodeSensingCyclesPerSampleSlider, sliderDroppedSamples;
-int32_t   sliderAdcDataElectrodeDischargeRaw[NUMBER_OF_SLIDER_ELECTRODES][NUMBER_OF_HOPPING_FREQUENCIES];
-int16_t   sliderAdcDataElectrodeDischargeRawSample[NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_ACTIVE];
-int16_t   sliderAdcDataElectrodeDischargeRawSampleElec0[NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_ACTIVE];
-int16_t   sliderAdcDataElectrodeDischargeRawSampleElec1[NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_ACTIVE];
+// Slider electrode samples trimmed mean accumulators (second one for simultaneous conversion)
+tTrimAcc  sliderTrimAcc0, sliderTrimAcc1;
 int32_t   sliderAdcDataElectrodeDischargeRawCalc;
 
 // Extern variables for slider electrode capacitance to equivalent voltage conversion
-extern uint8_t elecNum;
-extern uint8_t sampleNum;
 extern uint16_t  chargeDistributionPeriod, chargeDistributionPeriodTmp;
+#if(TS_ASM_OPTIMIZE == 1)
+extern tConvKernel convKernel;
+#endif
 
 // Wake up
 extern uint16_t  electrodeWakeUpActivateCounter;
@@ -56,23 +61,15 @@ uint8_t   sliderElecNumAct;
 // Slider Electrode DC tracker self-trim after power-up or reset
 int32_t   sliderAdcDataElectrodeDischargeBuffer[NUMBER_OF_SLIDER_ELECTRODES];
 uint16_t  sliderAdcDataElectrodeDischargeBufferCounter[NUMBER_OF_SLIDER_ELECTRODES];
-
-// DC Tracker
-int32_t   sliderDCTrackerDataBufferRaw[NUMBER_OF_SLIDER_ELECTRODES];
-int32_t   sliderDCTrackerDataBuffer[NUMBER_OF_SLIDER_ELECTRODES];
-uint8_t   sliderDCTrackerDataShift[NUMBER_OF_SLIDER_ELECTRODES];
-
-// LP Filter
-tFrac32   sliderLPFilterData[NUMBER_OF_SLIDER_ELECTRODES][NUMBER_OF_HOPPING_FREQUENCIES];
-extern uint8_t   LPFilterType[NUMBER_OF_ELECTRODES + NUMBER_OF_SLIDER_ELECTRODES];
-extern tFrac32   LPFilterData[NUMBER_OF_ELECTRODES][NUMBER_OF_HOPPING_FREQUENCIES];// For sampling change EGS
+#if TS_SELF_TRIM_CONVERGENCE
+// Slider self-trim samples spread, all slider baselines settled
+tSelfTrimVar  sliderSelfTrimVar[NUMBER_OF_SLIDER_ELECTRODES];
+uint8_t   sliderSelfTrimSettled;
+// Slider self-trim scans, electrode samples restart when drifting
+uint16_t  sliderSelfTrimScans;
+#endif
 
 // Detector
-int32_t   sliderDetectorThresholdTouch[NUMBER_OF_SLIDER_ELECTRODES];
-int16_t   sliderDetectorThresholdTouchDelta[NUMBER_OF_SLIDER_ELECTRODES];
-uint8_t   sliderElectrodeTouch[NUMBER_OF_SLIDER_ELECTRODES][NUMBER_OF_HOPPING_FREQUENCIES];
-extern 	uint8_t   electrodeTouch[NUMBER_OF_ELECTRODES][NUMBER_OF_HOPPING_FREQUENCIES];
-extern int32_t   detectorThresholdTouch[NUMBER_OF_ELECTRODES];// For sampling change EGS
 uint8_t   sliderVirtualEGSTouch;
 
 // Slider Touch qualification
@@ -101,14 +98,75 @@ int8_t numberOfHysteresisBlindPoints;
 extern uint8_t  lowPowerModeCtrl;
 
 // FrequencyHopping
-extern uint8_t   frequencyID,frequencyIDsave;
+extern uint8_t   frequencyID;
 extern uint8_t   frequencyHoppingActivation;
 
-// Decimation filter
-int32_t   sliderAdcDataElectrodeDischargeRawDF[NUMBER_OF_SLIDER_ELECTRODES][NUMBER_OF_HOPPING_FREQUENCIES];
-
 // Oversampling
 uint8_t sliderOversamplingActivationReport;
+
+// Slider enable requested by the application and applied to the scan
+volatile uint8_t  sliderEnable = YES;
+uint8_t   sliderEnabled = YES;
+// Slider electrodes scanned in the last period, baseline re-seed on the next scan
+uint8_t   sliderScanned = YES;
+uint8_t   sliderBaselineReseed;
+
+#if TS_DEFERRED_PROCESSING
+// Acquisition frame of the scan being acquired, raw data go to slider electrodes processing state if none
+extern tAcqFrame  *acqFramePtr;
+#endif
+
+#ifdef DEBUG_SCAN_TIMING
+// Interrupts masked window start, longest window in the current scan [core clock cycles]
+uint32_t  sliderIrqMaskStart;
+extern uint32_t  scanTimingIrqMaskedCycles;
+#endif
+
+/*****************************************************************************
+ *
+ * Function: static inline uint32_t SliderIrqMaskEnter(void)
+ *
+ * Description: Mask interrupts for the charge distribution and redistribution of one sensing cycle,
+ * 				return the previous interrupt mask
+ *
+ *****************************************************************************/
+static inline uint32_t SliderIrqMaskEnter(void)
+{
+	uint32_t  primask;
+
+	// Save interrupt mask, disable interrupts
+	SaveAndDisableInterrupts(primask);
+
+#ifdef DEBUG_SCAN_TIMING
+	// Interrupts masked window start
+	sliderIrqMaskStart = DWT_CYCCNT_REG;
+#endif
+
+	return primask;
+}
+
+/*****************************************************************************
+ *
+ * Function: static inline void SliderIrqMaskExit(uint32_t primask)
+ *
+ * Description: Restore the interrupt mask saved by SliderIrqMaskEnter
+ *
+ *****************************************************************************/
+static inline void SliderIrqMaskExit(uint32_t primask)
+{
+#ifdef DEBUG_SCAN_TIMING
+	uint32_t  maskedCycles = DWT_CYCCNT_REG - sliderIrqMaskStart;
+
+	// Longest interrupts masked window in the current scan
+	if (maskedCycles > scanTimingIrqMaskedCycles)
+	{
+		scanTimingIrqMaskedCycles = maskedCycles;
+	}
+#endif
+
+	// Restore interrupt mask
+	RestoreInterrupts(primask);
+}
 /*****************************************************************************
  *
  * Function: void SliderElectrodeStructureInit(void)
@@ -118,6 +176,10 @@ uint8_t sliderOversamplingActivationReport;
  *****************************************************************************/
 void SliderElectrodeStructureInit(void)
 {
+#if (TS_RAW_DATA_CALCULATION == OVERSAMPLING) || (defined(WAKE_UP_ELECTRODE) && ((DECIMATION_FILTER) || (FREQUENCY_HOPPING)))
+	uint32_t  elecNum;
+#endif
+
 #ifdef SLIDER_ELEC0
 	// Load slider electrode 0 hardware data
 	sliderElecStruct[0].adcBasePtr = SLIDER_ELEC0_ADC;
@@ -128,9 +190,9 @@ void SliderElectrodeStructureInit(void)
 	sliderElecStruct[0].pinNumberCext = SLIDER_ELEC0_CEXT_GPIO_PIN;
 	sliderElecStruct[0].portMask = SLIDER_ELEC0_PORT_MASK;
 	// Load electrode 0 application data
-	sliderDCTrackerDataShift[0] = SLIDER_ELEC0_DCTRACKER_FILTER_FACTOR;
-	LPFilterType[NUMBER_OF_ELECTRODES + 0] = SLIDER_ELEC0_LPFILTER_TYPE;
-	sliderDetectorThresholdTouchDelta[0] = SLIDER_ELEC0_TOUCH_THRESHOLD_DELTA;
+	sliderElecData[0].DCTrackerDataShift = SLIDER_ELEC0_DCTRACKER_FILTER_FACTOR;
+	sliderElecData[0].LPFilterType = SLIDER_ELEC0_LPFILTER_TYPE;
+	sliderElecData[0].detectorThresholdTouchDelta = SLIDER_ELEC0_TOUCH_THRESHOLD_DELTA;
 #endif
 
 #ifdef SLIDER_ELEC1
@@ -143,9 +205,9 @@ void SliderElectrodeStructureInit(void)
 	sliderElecStruct[1].pinNumberCext = SLIDER_ELEC1_CEXT_GPIO_PIN;
 	sliderElecStruct[1].portMask = SLIDER_ELEC1_PORT_MASK;
 	// Load slider electrode 1 application data
-	sliderDCTrackerDataShift[1] = SLIDER_ELEC1_DCTRACKER_FILTER_FACTOR;
-	LPFilterType[NUMBER_OF_ELECTRODES + 1] = SLIDER_ELEC1_LPFILTER_TYPE;
-	sliderDetectorThresholdTouchDelta[1] = SLIDER_ELEC1_TOUCH_THRESHOLD_DELTA;
+	sliderElecData[1].DCTrackerDataShift = SLIDER_ELEC1_DCTRACKER_FILTER_FACTOR;
+	sliderElecData[1].LPFilterType = SLIDER_ELEC1_LPFILTER_TYPE;
+	sliderElecData[1].detectorThresholdTouchDelta = SLIDER_ELEC1_TOUCH_THRESHOLD_DELTA;
 #endif
 
 	// If EGS is OFF and TS method is oversampling
@@ -154,10 +216,10 @@ void SliderElectrodeStructureInit(void)
 	for(elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 	{
 		// Set slider Threshold delta values to correspond to number of samples taken in Idle state
-		sliderDetectorThresholdTouchDelta[elecNum] /= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_MULTIPLY;
+		sliderElecData[elecNum].detectorThresholdTouchDelta /= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_MULTIPLY;
 
 		// Update DC tracker shift
-		sliderDCTrackerDataShift[elecNum] = SLIDER_ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
+		sliderElecData[elecNum].DCTrackerDataShift = SLIDER_ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
 	}
 	#endif
 
@@ -167,7 +229,7 @@ void SliderElectrodeStructureInit(void)
 	for(elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 	{
 		// Update DC tracker shift
-		sliderDCTrackerDataShift[elecNum] = SLIDER_ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
+		sliderElecData[elecNum].DCTrackerDataShift = SLIDER_ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
 	}
 	#endif
 	#endif
@@ -182,6 +244,8 @@ void SliderElectrodeStructureInit(void)
 *****************************************************************************/
 void SliderElectrodeADCchannelOffset(void)
 {
+	uint32_t  elecNum;
+
 	// All slider electrodes
 	for(elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 	{
@@ -191,6 +255,11 @@ void SliderElectrodeADCchannelOffset(void)
 			// Add offset
 			sliderElecStruct[elecNum].adcChNum += ELECTRODE_ADC_CHANNEL_OFFSET;
 		}
+
+#if (ADC_CONVERSION_WAIT == ADC_WAIT_SLEEP)
+		// Conversion complete interrupt enable, wakes core from sleep
+		sliderElecStruct[elecNum].adcChNum |= ADC_SC1_AIEN_MASK;
+#endif
 	}
 
 }
@@ -204,6 +273,9 @@ void SliderElectrodeADCchannelOffset(void)
  *****************************************************************************/
 void SliderElectrodeTouchSenseInit(void)
 {
+#if !defined(WAKE_UP_ELECTRODE) && TS_RAW_DATA_CALCULATION == OVERSAMPLING
+	uint32_t  elecNum;
+#endif
 
 	// Slider electrodes structure init
 	SliderElectrodeStructureInit();
@@ -239,7 +311,7 @@ void SliderElectrodeTouchSenseInit(void)
 	sliderAdditionDataThreshold = SLIDER_DIFFADD_DATA_OFFSET;
 	for(elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 		{
-		sliderAdditionDataThreshold -= sliderDetectorThresholdTouchDelta[elecNum];
+		sliderAdditionDataThreshold -= sliderElecData[elecNum].detectorThresholdTouchDelta;
 		}
 	#else
 	// Set the default slider addition data threshold of y-direction false touch canceling
@@ -313,14 +385,39 @@ void SliderDifferenceDataHelperThresholds (void)
  *****************************************************************************/
 void SliderElectrodeSelfTrim(void)
 {
+	uint32_t  elecNum;
+
 	// Device after power-up / reset ?
-	if (sliderAdcDataElectrodeDischargeBufferCounter[0] < NUMBER_OF_CYCLES_DCTRACKER_PWRUP)
+#if TS_SELF_TRIM_CONVERGENCE
+	if ((sliderSelfTrimScans < selfTrimCycles) && (sliderSelfTrimSettled == NO))
+#else
+	if (sliderAdcDataElectrodeDischargeBufferCounter[0] < selfTrimCycles)
+#endif
 	{
+#if TS_SELF_TRIM_CONVERGENCE
+		// Slider self-trim scan
+		sliderSelfTrimScans++;
+		// Settled unless any slider electrode is not
+		sliderSelfTrimSettled = YES;
+#endif
+
 		// All Slider electrodes
 		for (elecNum = 0; elecNum < (NUMBER_OF_SLIDER_ELECTRODES); elecNum++)
 		{
+#if TS_SELF_TRIM_CONVERGENCE
+			// Accumulate Slider electrode samples spread
+			ElectodeVarAcc(sliderElecData[elecNum].adcDataElectrodeDischargeRaw[frequencyID], &sliderSelfTrimVar[elecNum], sliderAdcDataElectrodeDischargeBufferCounter[elecNum]);
+#endif
 			// Store Slider electrode init value
-			ElectodeBufferInitVal(sliderAdcDataElectrodeDischargeRaw[elecNum][frequencyID], &(sliderAdcDataElectrodeDischargeBuffer[elecNum]), &(sliderAdcDataElectrodeDischargeBufferCounter[elecNum]));
+			ElectodeBufferInitVal(sliderElecData[elecNum].adcDataElectrodeDischargeRaw[frequencyID], &(sliderAdcDataElectrodeDischargeBuffer[elecNum]), &(sliderAdcDataElectrodeDischargeBufferCounter[elecNum]));
+#if TS_SELF_TRIM_CONVERGENCE
+			// Slider electrode baseline not settled yet?
+			if (ElectodeVarSettled(sliderElecData[elecNum].adcDataElectrodeDischargeRaw[frequencyID], &(sliderAdcDataElectrodeDischargeBuffer[elecNum]), &sliderSelfTrimVar[elecNum], \
+					&(sliderAdcDataElectrodeDischargeBufferCounter[elecNum]), sliderElecData[elecNum].detectorThresholdTouchDelta) == NO)
+			{
+				sliderSelfTrimSettled = NO;
+			}
+#endif
 		}
 	}
 	// Calculate and load init value
@@ -346,22 +443,15 @@ void SliderElectrodeSelfTrim(void)
  *****************************************************************************/
 void SliderElectrodeSelfTrimSense(void)
 {
+	uint32_t  elecNum;
+
 #ifdef DEBUG_ALGORITHM
 	// Pin clear
 	R_RMW32(&(DA_GPIO->PCOR), DA_PIN, 1);
 #endif
 
-	// Configure all slider electrodes floating
-	for (elecNum = 0; elecNum < (NUMBER_OF_SLIDER_ELECTRODES); elecNum++)
-	{
-		ElectrodeFloat(&sliderElecStruct[elecNum]);
-	}
-
-	// Configure all touch button (and EGS) electrodes floating
-	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
-	{
-	    ElectrodeFloat(&elecStruct[elecNum]);
-	}
+	// Configure all slider and touch button (and EGS) electrodes floating
+	ElectrodesFloatAll();
 
 #if (NUMBER_OF_USED_ADC_MODULES == 2)
 	// Convert slider electrodes capacitance to equivalent voltage simultaneously - at once
@@ -370,17 +460,8 @@ void SliderElectrodeSelfTrimSense(void)
 	// Convert Slider electrode capacitance to equivalent voltage one by one (the other slider electrode (and EGS) serve as a guard)
 	SliderElectrodeCapToVoltConvELCHGuard(SLIDER_ELEC0, SLIDER_ELEC1);
 #endif
-	// Drive all slider electrodes to GND
-	for (elecNum = 0; elecNum < (NUMBER_OF_SLIDER_ELECTRODES); elecNum++)
-	{
-		ElectrodeGnd(&sliderElecStruct[elecNum]);
-	}
-
-	// Drive all touch button (and EGS) electrodes to GND
- 	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
- 	{
- 		ElectrodeGnd(&elecStruct[elecNum]);
- 	}
+	// Drive all slider and touch button (and EGS) electrodes to GND
+	ElectrodesGndAll();
 
 	// Slider electrodes self trim
 	SliderElectrodeSelfTrim();
@@ -392,11 +473,11 @@ void SliderElectrodeSelfTrimSense(void)
 		for (elecNum = 0; elecNum < (NUMBER_OF_SLIDER_ELECTRODES); elecNum++)
 		{
 			// DC tracker data
-			sliderDCTrackerDataBuffer[elecNum] = sliderAdcDataElectrodeDischargeBuffer[elecNum];
+			sliderElecData[elecNum].DCTrackerDataBuffer = sliderAdcDataElectrodeDischargeBuffer[elecNum];
 			// Load DC tracker buffer
-			sliderDCTrackerDataBufferRaw[elecNum] = (sliderDCTrackerDataBuffer[elecNum]) << ((sliderDCTrackerDataShift[elecNum]));
+			sliderElecData[elecNum].DCTrackerDataBufferRaw = (sliderElecData[elecNum].DCTrackerDataBuffer) << ((sliderElecData[elecNum].DCTrackerDataShift));
 			// Slider Electrode touch and release thresholds
-			sliderDetectorThresholdTouch[elecNum] = sliderDCTrackerDataBuffer[elecNum] - sliderDetectorThresholdTouchDelta[elecNum];
+			sliderElecData[elecNum].detectorThresholdTouch = sliderElecData[elecNum].DCTrackerDataBuffer - sliderElecData[elecNum].detectorThresholdTouchDelta;
 		}
 
 		// All (both) used scanning frequencies
@@ -406,13 +487,13 @@ void SliderElectrodeSelfTrimSense(void)
         	for (elecNum = 0; elecNum < (NUMBER_OF_SLIDER_ELECTRODES); elecNum++)
         	{
     			// Slider electrodes LP IIR filter buffer init (FM only)
-    			sliderLPFilterData[elecNum][frequencyID] = sliderDCTrackerDataBuffer[elecNum];
+    			sliderElecData[elecNum].LPFilterData[frequencyID] = sliderElecData[elecNum].DCTrackerDataBuffer;
         		// Slider Raw data preset as baseline
-        		sliderAdcDataElectrodeDischargeRaw[elecNum][frequencyID] = sliderDCTrackerDataBuffer[elecNum];
+        		sliderElecData[elecNum].adcDataElectrodeDischargeRaw[frequencyID] = sliderElecData[elecNum].DCTrackerDataBuffer;
 
 			#if DECIMATION_FILTER
 				// Pre-load DF array
-				sliderAdcDataElectrodeDischargeRawDF[elecNum][frequencyID] = sliderDCTrackerDataBuffer[elecNum];
+				sliderElecData[elecNum].adcDataElectrodeDischargeRawDF[frequencyID] = sliderElecData[elecNum].DCTrackerDataBuffer;
 			#endif
         	}
         }
@@ -423,10 +504,10 @@ void SliderElectrodeSelfTrimSense(void)
         for (frequencyID = 0; frequencyID < NUMBER_OF_HOPPING_FREQUENCIES; frequencyID++)
         {
     		// All Slider electrodes
-    		for (elecNum = NUMBER_OF_ELECTRODES; elecNum < (NUMBER_OF_ELECTRODES + NUMBER_OF_SLIDER_ELECTRODES); elecNum++)
+    		for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
     		{
     			// Init IIR filter
-    			FilterIIR1BufferInit(elecNum, ((tFrac32)(sliderDCTrackerDataBuffer[(elecNum) - NUMBER_OF_ELECTRODES])), ((tFrac32)(sliderDCTrackerDataBuffer[(elecNum) - NUMBER_OF_ELECTRODES])), frequencyID);
+    			FilterIIR1BufferInit(&sliderElecData[elecNum].LPFilterBuffer[frequencyID], ((tFrac32)(sliderElecData[elecNum].DCTrackerDataBuffer)), ((tFrac32)(sliderElecData[elecNum].DCTrackerDataBuffer)));
     		}
         }
         // Reset frequencyID
@@ -454,18 +535,20 @@ void SliderElectrodeSelfTrimSense(void)
  *****************************************************************************/
 void SliderDCTrackerShiftIncrease(void)
 {
+	uint32_t  elecNum;
+
 		// All slider electrodes
 		for(elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 		{
 			// Load new shift to update the DC tracker
-			sliderDCTrackerDataShift[elecNum] = SLIDER_ELEC_DCTRACKER_FILTER_FACTOR_ACTIVE;
+			sliderElecData[elecNum].DCTrackerDataShift = SLIDER_ELEC_DCTRACKER_FILTER_FACTOR_ACTIVE;
 		}
 
 		// All slider electrodes
 		for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 		{
 			// Load DC tracker buffer
-			sliderDCTrackerDataBufferRaw[elecNum] = (sliderDCTrackerDataBuffer[elecNum]) << ((sliderDCTrackerDataShift[elecNum]));
+			sliderElecData[elecNum].DCTrackerDataBufferRaw = (sliderElecData[elecNum].DCTrackerDataBuffer) << ((sliderElecData[elecNum].DCTrackerDataShift));
 		}
 }
 
@@ -478,20 +561,91 @@ void SliderDCTrackerShiftIncrease(void)
  *****************************************************************************/
 void SliderDCTrackerShiftDecrease(void)
 {
+	uint32_t  elecNum;
+
 		// All slider electrodes
 		for(elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 		{
 			// Load new shift to update the DC tracker
-			sliderDCTrackerDataShift[elecNum] = SLIDER_ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
+			sliderElecData[elecNum].DCTrackerDataShift = SLIDER_ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
 		}
 
 		// All slider electrodes
 		for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 		{
 			// Load DC tracker buffer
-			sliderDCTrackerDataBufferRaw[elecNum] = (sliderDCTrackerDataBuffer[elecNum]) << ((sliderDCTrackerDataShift[elecNum]));
+			sliderElecData[elecNum].DCTrackerDataBufferRaw = (sliderElecData[elecNum].DCTrackerDataBuffer) << ((sliderElecData[elecNum].DCTrackerDataShift));
 		}
 }
+/*****************************************************************************
+ *
+ * Function: void SliderTrimAccInit(void)
+ *
+ * Description: Reset slider electrode samples accumulators, reject the lowest and highest samples
+ * 				with active number of sensing cycles only
+ *
+ *****************************************************************************/
+void SliderTrimAccInit(void)
+{
+	// Active number of sensing cycles?
+	if(numberOfElectrodeSensingCyclesPerSampleSlider == NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_ACTIVE)
+	{
+		// Reject the lowest and highest samples
+		TrimAccInit(&sliderTrimAcc0, SLIDER_SAMPLES_REJECT_LOW, SLIDER_SAMPLES_REJECT_HIGH);
+		TrimAccInit(&sliderTrimAcc1, SLIDER_SAMPLES_REJECT_LOW, SLIDER_SAMPLES_REJECT_HIGH);
+		sliderDroppedSamples = SLIDER_SAMPLES_REJECT_LOW + SLIDER_SAMPLES_REJECT_HIGH;
+	}
+	else
+	{
+		// Keep all samples
+		TrimAccInit(&sliderTrimAcc0, 0, 0);
+		TrimAccInit(&sliderTrimAcc1, 0, 0);
+		sliderDroppedSamples = 0;
+	}
+}
+
+/*****************************************************************************
+ *
+ * Function: void SliderRawDataCalc(uint32_t sliderElectrodeNum, tTrimAcc *accPtr)
+ *
+ * Input: Number of the slider electrode, samples accumulator of the electrode (pre-cycles excluded)
+ *
+ * Description: Calculate slider electrode raw data as a samples sum (oversampling) or samples average (averaging)
+ * 				of the trimmed samples
+ *
+ *****************************************************************************/
+void SliderRawDataCalc(uint32_t sliderElectrodeNum, tTrimAcc *accPtr)
+{
+	int32_t  rawData;
+
+	// Trimmed samples sum
+	sliderAdcDataElectrodeDischargeRawCalc = TrimAccSum(accPtr);
+
+#if(TS_RAW_DATA_CALCULATION == OVERSAMPLING)
+	// Samples sum scaled to the actual (idle or active) number of sensing cycles
+	rawData = (sliderAdcDataElectrodeDischargeRawCalc * numberOfElectrodeSensingCyclesPerSampleSlider) / TrimAccSamplesNum(accPtr);
+#elif(TS_RAW_DATA_CALCULATION == AVERAGING)
+	// Samples value average
+	rawData = (int16_t)(sliderAdcDataElectrodeDischargeRawCalc / TrimAccSamplesNum(accPtr));
+#else
+	#error Please select valid TS method in ts_cfg_general.h
+#endif
+
+#if TS_DEFERRED_PROCESSING
+	// Scan acquired for deferred processing?
+	if (acqFramePtr != 0)
+	{
+		// Store raw data to the acquisition frame
+		acqFramePtr->sliderRaw[sliderElectrodeNum] = rawData;
+	}
+	else
+#endif
+	{
+		// Store raw data to the slider electrode processing state
+		sliderElecData[sliderElectrodeNum].adcDataElectrodeDischargeRaw[frequencyID] = rawData;
+	}
+}
+
 /*****************************************************************************
  *
  * Function: void SliderElectrodeCapToVoltConvELCH(uint32_t sliderElectrodeNum)
@@ -503,6 +657,10 @@ void SliderDCTrackerShiftDecrease(void)
  *****************************************************************************/
 void SliderElectrodeCapToVoltConvELCH(uint32_t sliderElectrodeNum)
 {
+	int32_t   sampleNum;
+	uint32_t  primask;
+	int16_t  sample;
+
 	// Clear ADCs gain (lower noise)
 	ClearADCsGain();
 
@@ -512,74 +670,64 @@ void SliderElectrodeCapToVoltConvELCH(uint32_t sliderElectrodeNum)
 #endif
 
 
+	// Reset samples accumulator
+	SliderTrimAccInit();
+
 	// Slider electrode capacitance to voltage conversion
 	for (sampleNum = 0; sampleNum < NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSampleSlider; sampleNum++)
 	{
+#if(TS_ASM_OPTIMIZE == 1)
+		// Electrode low, Cext high, both pins GPIO
+		ChargeDistributionPinsSet(&sliderElecStruct[sliderElectrodeNum]);
+		// Conversion kernel parameters, single distribution stage
+		ConversionKernelSet(&convKernel, sliderElecStruct[sliderElectrodeNum].gpioBasePtr, sliderElecStruct[sliderElectrodeNum].portMask, chargeDistributionPeriod,
+							sliderElecStruct[sliderElectrodeNum].gpioBasePtr, sliderElecStruct[sliderElectrodeNum].portMask, 0,
+							&(sliderElecStruct[sliderElectrodeNum].adcBasePtr->SC1[0]), sliderElecStruct[sliderElectrodeNum].adcChNum);
+		// Mask interrupts, charge distribution timing must not be stretched
+		primask = SliderIrqMaskEnter();
+		// Distribute charge, start Cext voltage ADC conversion and redistribute Electrode and Cext charge
+		ConversionKernelRun(&convKernel);
+		// Unmask interrupts, Cext voltage conversion already started
+		SliderIrqMaskExit(primask);
+#else
+		// Mask interrupts, charge distribution timing must not be stretched
+		primask = SliderIrqMaskEnter();
 		// Distribute Electrode and Cext charge
 		ChargeDistribution(&sliderElecStruct[sliderElectrodeNum]);
 		// Delay to distribute charge
 		chargeDistributionPeriodTmp = chargeDistributionPeriod;
 		while (chargeDistributionPeriodTmp) {chargeDistributionPeriodTmp--;}
 
-		// If compiler optimization is not -O3 (is set to none -> -O0), then set TS_ASM_OPTIMIZE macro to 1 in ts_cfg.h
-#if(TS_ASM_OPTIMIZE == 1)
-        asm volatile (
-            /***** ASSEMBLY TEMPLATE ****************************************/
-            // Start Cext voltage ADC conversion
-            "str %1, [%0, #0]\n\t"    // store %1 to address in %0 with 0 byte offset
-            // Redistribute Electrode and Cext charge
-            "str %3, [%2, #0]"        // store %3 to address in %2 with 0 byte offset
-            /***** LIST OF OUTPUT OPERANDS **********************************/
-            :
-            /***** LIST OF INPUT OPERANDS ***********************************/
-            :  "r" (&sliderElecStruct[sliderElectrodeNum].adcBasePtr->SC1[0]),  // operand %0
-               "r" (sliderElecStruct[sliderElectrodeNum].adcChNum),             // operand %1
-               "r" (&sliderElecStruct[sliderElectrodeNum].gpioBasePtr->PDDR),   // operand %2
-               "r" ((sliderElecStruct[sliderElectrodeNum].gpioBasePtr->PDDR) & ~(sliderElecStruct[sliderElectrodeNum].portMask))    // operand %3
-        );
-#else
 		// Start Cext voltage ADC conversion
 		sliderElecStruct[sliderElectrodeNum].adcBasePtr->SC1[0] = sliderElecStruct[sliderElectrodeNum].adcChNum;
 
 		// Redistribute Electrode and Cext charge
 		ChargeRedistribution(&sliderElecStruct[sliderElectrodeNum]);
+
+		// Unmask interrupts, Cext voltage conversion already started
+		SliderIrqMaskExit(primask);
 #endif
 
 		// Equivalent voltage digitalization
-		sliderAdcDataElectrodeDischargeRawSample[sampleNum] = EquivalentVoltageDigitalization(&sliderElecStruct[sliderElectrodeNum]);
+		sample = EquivalentVoltageDigitalization(&sliderElecStruct[sliderElectrodeNum]);
+
+		// Pre-cycles done?
+		if (sampleNum >= NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE)
+		{
+			// Accumulate sample
+			TrimAccAdd(&sliderTrimAcc0, sample);
+		}
 
 		#if JITTERING
 			#if (JITTERING_OPTION == 2)
 				// Jitter sample rate
-				Jitter(sliderAdcDataElectrodeDischargeRaw[sliderElectrodeNum][frequencyID]);
+				Jitter(sliderElecData[sliderElectrodeNum].adcDataElectrodeDischargeRaw[frequencyID]);
 			#endif
 		#endif
 	}
 
-#if SLIDER_NOISE_CANCELING
-	SliderNoiseCanceling();
-#endif
-
-	#if(TS_RAW_DATA_CALCULATION == OVERSAMPLING)
-	// Calculate samples sum
-	sliderAdcDataElectrodeDischargeRawCalc = 0;
-	for (sampleNum = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSampleSlider); sampleNum++)
-	{
-		sliderAdcDataElectrodeDischargeRawCalc = sliderAdcDataElectrodeDischargeRawCalc + sliderAdcDataElectrodeDischargeRawSample[sampleNum];
-	}
-	sliderAdcDataElectrodeDischargeRaw[sliderElectrodeNum][frequencyID] = sliderAdcDataElectrodeDischargeRawCalc;
-
-	#elif(TS_RAW_DATA_CALCULATION == AVERAGING)
-	// Calculate samples value average
-	sliderAdcDataElectrodeDischargeRawCalc = 0;
-	for (sampleNum = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSampleSlider); sampleNum++)
-	{
-		sliderAdcDataElectrodeDischargeRawCalc = sliderAdcDataElectrodeDischargeRawCalc + sliderAdcDataElectrodeDischargeRawSample[sampleNum];
-	}
-	sliderAdcDataElectrodeDischargeRaw[sliderElectrodeNum][frequencyID] = (int16_t)(sliderAdcDataElectrodeDischargeRawCalc / (numberOfElectrodeSensingCyclesPerSampleSlider-sliderDroppedSamples));
-	#else
-	#error Please select valid TS method in ts_cfg_general.h
-	#endif
+	// Calculate slider electrode raw data from samples
+	SliderRawDataCalc(sliderElectrodeNum, &sliderTrimAcc0);
 
 #ifdef DEBUG_ELECTRODE_SENSE
 	// Pin set
@@ -603,6 +751,10 @@ void SliderElectrodeCapToVoltConvELCH(uint32_t sliderElectrodeNum)
  *****************************************************************************/
 void SliderSimultaneousElectrodeCapToVoltConvELCH(uint32_t sliderElectrode0Num,uint32_t sliderElectrode1Num)
 {
+	int32_t   sampleNum;
+	uint32_t  primask;
+	int16_t  sample0, sample1;
+
 	// Clear ADCs gain (lower noise)
 	ClearADCsGain();
 
@@ -611,9 +763,44 @@ void SliderSimultaneousElectrodeCapToVoltConvELCH(uint32_t sliderElectrode0Num,u
 	R_RMW32(&(DES_GPIO->PCOR), DES_PIN, 1);
 #endif
 
+	// Reset samples accumulators
+	SliderTrimAccInit();
+
 	// Simultaneous slider electrodes capacitance to voltage conversion
 	for (sampleNum = 0; sampleNum < NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSampleSlider; sampleNum++)
 	{
+#if(TS_ASM_OPTIMIZE == 1)
+		// Slider electrodes low, Cexts high, all pins GPIO
+		SimultaneousChargeDistributionPinsSet(&sliderElecStruct[sliderElectrode0Num],&sliderElecStruct[sliderElectrode1Num]);
+#if (OPTIONAL_WAKE_UP_ELECTRODE == WAKE_ELEC_YES)
+		// EGS electrode low, Cext high, both pins GPIO
+		ChargeDistributionPinsSet(&elecStruct[WAKE_UP_ELECTRODE]);
+#endif
+
+		// Cext voltage conversion - channel PRE-assignment for both slider electrodes
+		sliderElecStruct[sliderElectrode0Num].adcBasePtr->SC1[0] = sliderElecStruct[sliderElectrode0Num].adcChNum;
+		sliderElecStruct[sliderElectrode1Num].adcBasePtr->SC1[0] = sliderElecStruct[sliderElectrode1Num].adcChNum;
+
+#if (OPTIONAL_WAKE_UP_ELECTRODE == WAKE_ELEC_YES)
+		// Conversion kernel parameters, slider electrodes then EGS distribution stage, SW trigger to TRGMUX
+		ConversionKernelSet(&convKernel, sliderElecStruct[sliderElectrode0Num].gpioBasePtr, sliderElecStruct[sliderElectrode0Num].portMask + sliderElecStruct[sliderElectrode1Num].portMask, chargeDistributionPeriod,
+							elecStruct[WAKE_UP_ELECTRODE].gpioBasePtr, elecStruct[WAKE_UP_ELECTRODE].portMask, chargeDistributionPeriod,
+							&(SIM->MISCTRL1), SIM_MISCTRL1_SW_TRG_MASK);
+#else
+		// Conversion kernel parameters, single distribution stage, SW trigger to TRGMUX
+		ConversionKernelSet(&convKernel, sliderElecStruct[sliderElectrode0Num].gpioBasePtr, sliderElecStruct[sliderElectrode0Num].portMask + sliderElecStruct[sliderElectrode1Num].portMask, chargeDistributionPeriod,
+							sliderElecStruct[sliderElectrode0Num].gpioBasePtr, sliderElecStruct[sliderElectrode0Num].portMask + sliderElecStruct[sliderElectrode1Num].portMask, 0,
+							&(SIM->MISCTRL1), SIM_MISCTRL1_SW_TRG_MASK);
+#endif
+		// Mask interrupts, charge distribution timing must not be stretched
+		primask = SliderIrqMaskEnter();
+		// Distribute charge, start Cext voltage conversion in both ADC modules and redistribute charge
+		ConversionKernelRun(&convKernel);
+		// Unmask interrupts, Cext voltage conversion already started
+		SliderIrqMaskExit(primask);
+#else
+		// Mask interrupts, charge distribution timing must not be stretched
+		primask = SliderIrqMaskEnter();
 		// Distribute Electrode and Cext charge
 		SimultaneousChargeDistribution(&sliderElecStruct[sliderElectrode0Num],&sliderElecStruct[sliderElectrode1Num]);
 		// Delay to distribute charge
@@ -632,31 +819,6 @@ void SliderSimultaneousElectrodeCapToVoltConvELCH(uint32_t sliderElectrode0Num,u
 		sliderElecStruct[sliderElectrode0Num].adcBasePtr->SC1[0] = sliderElecStruct[sliderElectrode0Num].adcChNum;
 		sliderElecStruct[sliderElectrode1Num].adcBasePtr->SC1[0] = sliderElecStruct[sliderElectrode1Num].adcChNum;
 
-		// If compiler optimization is not -O3 (is set to none -> -O0), then set TS_ASM_OPTIMIZE macro to 1 in ts_cfg.h
-#if(TS_ASM_OPTIMIZE == 1)
-        asm volatile (
-            /***** ASSEMBLY TEMPLATE ****************************************/
-            // Start Cext voltage ADC conversion
-            "str %1, [%0, #0]\n\t"    // store %1 to address in %0 with 0 byte offset
-            // Redistribute Electrode and Cext charge
-            "str %3, [%2, #0]"        // store %3 to address in %2 with 0 byte offset
-#if (OPTIONAL_WAKE_UP_ELECTRODE == WAKE_ELEC_YES)
-			// Redistribute EGS Electrode and Cext charge
-			"\n\tstr %5, [%4, #0]"        // store %5 to address in %4 with 0 byte offset
-#endif
-            /***** LIST OF OUTPUT OPERANDS **********************************/
-            :
-            /***** LIST OF INPUT OPERANDS ***********************************/
-            :  "r" (&SIM->MISCTRL1),  // operand %0
-               "r" (SIM_MISCTRL1_SW_TRG_MASK),             // operand %1
-               "r" (&sliderElecStruct[sliderElectrode0Num].gpioBasePtr->PDDR),   // operand %2
-               "r" ((sliderElecStruct[sliderElectrode0Num].gpioBasePtr->PDDR) & ~(sliderElecStruct[sliderElectrode0Num].portMask + sliderElecStruct[sliderElectrode1Num].portMask))    // operand %3
-#if (OPTIONAL_WAKE_UP_ELECTRODE == WAKE_ELEC_YES)
-			   ,"r" (&elecStruct[WAKE_UP_ELECTRODE].gpioBasePtr->PDDR), // operand %4
-			   "r" ((elecStruct[WAKE_UP_ELECTRODE].gpioBasePtr->PDDR) & ~(elecStruct[WAKE_UP_ELECTRODE].portMask))  // operand %5
-#endif
-        );
-#else
 		// Generate SW trigger to TRGMUX -> and thus initiate the Cext voltage conversion in both ADC0 and ADC1 at the same time
 		// Optimization of code must be set the highest (-O3)
 		SIM->MISCTRL1 = SIM_MISCTRL1_SW_TRG_MASK;
@@ -669,65 +831,35 @@ void SliderSimultaneousElectrodeCapToVoltConvELCH(uint32_t sliderElectrode0Num,u
 			ChargeRedistribution(&elecStruct[WAKE_UP_ELECTRODE]);
 #endif
 
+		// Unmask interrupts, Cext voltage conversion already started
+		SliderIrqMaskExit(primask);
 #endif
 			// Equivalent voltage digitalization for both electrodes of slider at once
 			SimultaneousEquivalentVoltageDigitalization(&sliderElecStruct[sliderElectrode0Num],&sliderElecStruct[sliderElectrode1Num]);
 
 			// Store result of the first and second electrode, clear COCO flag
-			sliderAdcDataElectrodeDischargeRawSampleElec0[sampleNum] = sliderElecStruct[sliderElectrode0Num].adcBasePtr->R[0];
-			sliderAdcDataElectrodeDischargeRawSampleElec1[sampleNum] = sliderElecStruct[sliderElectrode1Num].adcBasePtr->R[0];
+			sample0 = sliderElecStruct[sliderElectrode0Num].adcBasePtr->R[0];
+			sample1 = sliderElecStruct[sliderElectrode1Num].adcBasePtr->R[0];
+
+			// Pre-cycles done?
+			if (sampleNum >= NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE)
+			{
+				// Accumulate samples of both electrodes
+				TrimAccAdd(&sliderTrimAcc0, sample0);
+				TrimAccAdd(&sliderTrimAcc1, sample1);
+			}
 
 		#if JITTERING
 			#if (JITTERING_OPTION == 2)
 				// Jitter sample rate
-				Jitter(sliderAdcDataElectrodeDischargeRaw[sliderElectrode0Num][frequencyID]);
+				Jitter(sliderElecData[sliderElectrode0Num].adcDataElectrodeDischargeRaw[frequencyID]);
 			#endif
 		#endif
 	}
 
-#if SLIDER_NOISE_CANCELING
-	SliderNoiseCanceling();
-#endif
-
-	#if(TS_RAW_DATA_CALCULATION == OVERSAMPLING)
-	// Calculate samples sum
-	sliderAdcDataElectrodeDischargeRawCalc = 0;
-	for (sampleNum = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSampleSlider); sampleNum++)
-	{
-		sliderAdcDataElectrodeDischargeRawCalc = sliderAdcDataElectrodeDischargeRawCalc + sliderAdcDataElectrodeDischargeRawSampleElec0[sampleNum];
-	}
-	sliderAdcDataElectrodeDischargeRaw[sliderElectrode0Num][frequencyID] = sliderAdcDataElectrodeDischargeRawCalc;
-
-	// Calculate samples sum
-	sliderAdcDataElectrodeDischargeRawCalc = 0;
-	for (sampleNum = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSampleSlider); sampleNum++)
-	{
-		sliderAdcDataElectrodeDischargeRawCalc = sliderAdcDataElectrodeDischargeRawCalc + sliderAdcDataElectrodeDischargeRawSampleElec1[sampleNum];
-	}
-	sliderAdcDataElectrodeDischargeRaw[sliderElectrode1Num][frequencyID] = sliderAdcDataElectrodeDischargeRawCalc;
-
-	#elif(TS_RAW_DATA_CALCULATION == AVERAGING)
-	// Calculate samples value average
-	// First electrode
-	sliderAdcDataElectrodeDischargeRawCalc = 0;
-	for (sampleNum = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSampleSlider); sampleNum++)
-	{
-		sliderAdcDataElectrodeDischargeRawCalc = sliderAdcDataElectrodeDischargeRawCalc + sliderAdcDataElectrodeDischargeRawSampleElec0[sampleNum];
-	}
-	sliderAdcDataElectrodeDischargeRaw[sliderElectrode0Num][frequencyID] = (int16_t)(sliderAdcDataElectrodeDischargeRawCalc / (numberOfElectrodeSensingCyclesPerSampleSlider-sliderDroppedSamples));
-
-
-	// Calculate samples value average
-	// Second electrode
-	sliderAdcDataElectrodeDischargeRawCalc = 0;
-	for (sampleNum = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSampleSlider); sampleNum++)
-	{
-		sliderAdcDataElectrodeDischargeRawCalc = sliderAdcDataElectrodeDischargeRawCalc + sliderAdcDataElectrodeDischargeRawSampleElec1[sampleNum];
-	}
-	sliderAdcDataElectrodeDischargeRaw[sliderElectrode1Num][frequencyID] = (int16_t)(sliderAdcDataElectrodeDischargeRawCalc / (numberOfElectrodeSensingCyclesPerSampleSlider-sliderDroppedSamples));
-	#else
-	#error Please select valid TS method in ts_cfg_general.h
-	#endif
+	// Calculate slider electrodes raw data from samples
+	SliderRawDataCalc(sliderElectrode0Num, &sliderTrimAcc0);
+	SliderRawDataCalc(sliderElectrode1Num, &sliderTrimAcc1);
 
 #ifdef DEBUG_ELECTRODE_SENSE
 	// Pin set
@@ -751,6 +883,10 @@ void SliderSimultaneousElectrodeCapToVoltConvELCH(uint32_t sliderElectrode0Num,u
  *****************************************************************************/
 void SliderElectrodeCapToVoltConvELCHGuard(uint32_t sliderElectrode0Num,uint32_t sliderElectrode1Num)
 {
+	uint32_t  elecNum, primask;
+	int32_t   sampleNum;
+	int16_t  sample;
+
 	// Clear ADCs gain (lower noise)
 	ClearADCsGain();
 
@@ -762,9 +898,38 @@ void SliderElectrodeCapToVoltConvELCHGuard(uint32_t sliderElectrode0Num,uint32_t
 	// Convert Slider electrode capacitance to equivalent voltage one by one
 	for(elecNum = 0 ; elecNum < NUMBER_OF_SLIDER_ELECTRODES ; elecNum++)
 	{
+		// Reset samples accumulator
+		SliderTrimAccInit();
+
 		// Slider electrodes capacitance to voltage conversion
 		for (sampleNum = 0; sampleNum < NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSampleSlider; sampleNum++)
 		{
+#if(TS_ASM_OPTIMIZE == 1)
+			// Slider electrodes low, Cexts high, all pins GPIO
+			SimultaneousChargeDistributionPinsSet(&sliderElecStruct[sliderElectrode0Num],&sliderElecStruct[sliderElectrode1Num]);
+#if (OPTIONAL_WAKE_UP_ELECTRODE == WAKE_ELEC_YES)
+			// EGS electrode low, Cext high, both pins GPIO
+			ChargeDistributionPinsSet(&elecStruct[WAKE_UP_ELECTRODE]);
+
+			// Conversion kernel parameters, slider electrodes then EGS (guard) distribution stage, scanned electrode SW trigger
+			ConversionKernelSet(&convKernel, sliderElecStruct[sliderElectrode0Num].gpioBasePtr, sliderElecStruct[sliderElectrode0Num].portMask + sliderElecStruct[sliderElectrode1Num].portMask, chargeDistributionPeriod,
+								elecStruct[WAKE_UP_ELECTRODE].gpioBasePtr, elecStruct[WAKE_UP_ELECTRODE].portMask, chargeDistributionPeriod,
+								&(sliderElecStruct[elecNum].adcBasePtr->SC1[0]), sliderElecStruct[elecNum].adcChNum);
+#else
+			// Conversion kernel parameters, single distribution stage, scanned electrode SW trigger
+			ConversionKernelSet(&convKernel, sliderElecStruct[sliderElectrode0Num].gpioBasePtr, sliderElecStruct[sliderElectrode0Num].portMask + sliderElecStruct[sliderElectrode1Num].portMask, chargeDistributionPeriod,
+								sliderElecStruct[sliderElectrode0Num].gpioBasePtr, sliderElecStruct[sliderElectrode0Num].portMask + sliderElecStruct[sliderElectrode1Num].portMask, 0,
+								&(sliderElecStruct[elecNum].adcBasePtr->SC1[0]), sliderElecStruct[elecNum].adcChNum);
+#endif
+			// Mask interrupts, charge distribution timing must not be stretched
+			primask = SliderIrqMaskEnter();
+			// Distribute charge, start Cext voltage ADC conversion and redistribute charge
+			ConversionKernelRun(&convKernel);
+			// Unmask interrupts, Cext voltage conversion already started
+			SliderIrqMaskExit(primask);
+#else
+			// Mask interrupts, charge distribution timing must not be stretched
+			primask = SliderIrqMaskEnter();
 			// Distribute Electrode and Cext charge
 			SimultaneousChargeDistribution(&sliderElecStruct[sliderElectrode0Num],&sliderElecStruct[sliderElectrode1Num]);
 			// Delay to distribute charge
@@ -779,77 +944,40 @@ void SliderElectrodeCapToVoltConvELCHGuard(uint32_t sliderElectrode0Num,uint32_t
 			while (chargeDistributionPeriodTmp) {chargeDistributionPeriodTmp--;}
 			#endif
 
-			// If compiler optimization is not -O3 (is set to none -> -O0), then set TS_ASM_OPTIMIZE macro to 1 in ts_cfg.h
-#if(TS_ASM_OPTIMIZE == 1)
-        asm volatile (
-            /***** ASSEMBLY TEMPLATE ****************************************/
-            // Start Cext voltage ADC conversion
-            "str %1, [%0, #0]\n\t"    // store %1 to address in %0 with 0 byte offset
-            // Redistribute Electrode and Cext charge
-            "str %3, [%2, #0]"        // store %3 to address in %2 with 0 byte offset
-#if (OPTIONAL_WAKE_UP_ELECTRODE == WAKE_ELEC_YES)
-			// Redistribute EGS Electrode and Cext charge
-			"\n\tstr %5, [%4, #0]"        // store %5 to address in %4 with 0 byte offset
-#endif
-            /***** LIST OF OUTPUT OPERANDS **********************************/
-            :
-            /***** LIST OF INPUT OPERANDS ***********************************/
-            :  "r" (&sliderElecStruct[elecNum].adcBasePtr->SC1[0]),  // operand %0
-               "r" (sliderElecStruct[elecNum].adcChNum),             // operand %1
-               "r" (&sliderElecStruct[sliderElectrode0Num].gpioBasePtr->PDDR),   // operand %2
-               "r" ((sliderElecStruct[sliderElectrode0Num].gpioBasePtr->PDDR) & ~(sliderElecStruct[sliderElectrode0Num].portMask + sliderElecStruct[sliderElectrode1Num].portMask))    // operand %3
-#if (OPTIONAL_WAKE_UP_ELECTRODE == WAKE_ELEC_YES)
-			   ,"r" (&elecStruct[WAKE_UP_ELECTRODE].gpioBasePtr->PDDR), // operand %4
-			   "r" ((elecStruct[WAKE_UP_ELECTRODE].gpioBasePtr->PDDR) & ~(elecStruct[WAKE_UP_ELECTRODE].portMask))  // operand %5
-#endif
-        );
-#else
-        // Start Cext voltage ADC conversion
-		sliderElecStruct[elecNum].adcBasePtr->SC1[0] = sliderElecStruct[elecNum].adcChNum;
+			// Start Cext voltage ADC conversion
+			sliderElecStruct[elecNum].adcBasePtr->SC1[0] = sliderElecStruct[elecNum].adcChNum;
 
-		// Redistribute Electrode and Cext charge
-		SimultaneousChargeRedistribution(&sliderElecStruct[sliderElectrode0Num],&sliderElecStruct[sliderElectrode1Num]);
+			// Redistribute Electrode and Cext charge
+			SimultaneousChargeRedistribution(&sliderElecStruct[sliderElectrode0Num],&sliderElecStruct[sliderElectrode1Num]);
 
 #if (OPTIONAL_WAKE_UP_ELECTRODE == WAKE_ELEC_YES)
-		// Redistribute Electrode and Cext charge
-		ChargeRedistribution(&elecStruct[WAKE_UP_ELECTRODE]);
+			// Redistribute Electrode and Cext charge
+			ChargeRedistribution(&elecStruct[WAKE_UP_ELECTRODE]);
 #endif
 
+			// Unmask interrupts, Cext voltage conversion already started
+			SliderIrqMaskExit(primask);
 #endif
+
 			// Equivalent voltage digitalization
-			sliderAdcDataElectrodeDischargeRawSample[sampleNum] = EquivalentVoltageDigitalization(&sliderElecStruct[elecNum]);
+			sample = EquivalentVoltageDigitalization(&sliderElecStruct[elecNum]);
+
+			// Pre-cycles done?
+			if (sampleNum >= NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE)
+			{
+				// Accumulate sample
+				TrimAccAdd(&sliderTrimAcc0, sample);
+			}
 
 			#if JITTERING
 				#if (JITTERING_OPTION == 2)
-					Jitter(sliderAdcDataElectrodeDischargeRaw[sliderElectrode0Num][frequencyID]);
+					Jitter(sliderElecData[sliderElectrode0Num].adcDataElectrodeDischargeRaw[frequencyID]);
 				#endif
 			#endif
 		}
 
-#if SLIDER_NOISE_CANCELING
-		SliderNoiseCanceling();
-#endif
-
-		#if(TS_RAW_DATA_CALCULATION == OVERSAMPLING)
-		// Calculate samples sum
-		sliderAdcDataElectrodeDischargeRawCalc = 0;
-		for (sampleNum = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSampleSlider); sampleNum++)
-		{
-			sliderAdcDataElectrodeDischargeRawCalc = sliderAdcDataElectrodeDischargeRawCalc + sliderAdcDataElectrodeDischargeRawSample[sampleNum];
-		}
-		sliderAdcDataElectrodeDischargeRaw[elecNum][frequencyID] = sliderAdcDataElectrodeDischargeRawCalc;
-
-		#elif(TS_RAW_DATA_CALCULATION == AVERAGING)
-		// Calculate samples value average
-		sliderAdcDataElectrodeDischargeRawCalc = 0;
-		for (sampleNum = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSampleSlider); sampleNum++)
-		{
-			sliderAdcDataElectrodeDischargeRawCalc = sliderAdcDataElectrodeDischargeRawCalc + sliderAdcDataElectrodeDischargeRawSample[sampleNum];
-		}
-		sliderAdcDataElectrodeDischargeRaw[elecNum][frequencyID] = (int16_t)(sliderAdcDataElectrodeDischargeRawCalc / (numberOfElectrodeSensingCyclesPerSampleSlider-sliderDroppedSamples));
-		#else
-		#error Please select valid TS method in ts_cfg_general.h
-		#endif
+		// Calculate slider electrode raw data from samples
+		SliderRawDataCalc(elecNum, &sliderTrimAcc0);
 
 	}
 	#ifdef DEBUG_ELECTRODE_SENSE
@@ -862,22 +990,26 @@ void SliderElectrodeCapToVoltConvELCHGuard(uint32_t sliderElectrode0Num,uint32_t
 
 /*****************************************************************************
 *
-* Function: void SliderElectrodeTouchDetect(uint32_t electrodeNum)
+* Function: void SliderElectrodeTouchDetect(uint32_t electrodeNum, uint8_t scanFrequencyID)
+*
+* Input: Electrode number, scanning period/frequency ID of the scan
 *
 * Description: Detect electrode touch
 *
 *****************************************************************************/
-void SliderElectrodeTouchDetect(uint32_t electrodeNum)
+void SliderElectrodeTouchDetect(uint32_t electrodeNum, uint8_t scanFrequencyID)
 {
+	tSliderElecData  *sliderElecDataPtr = &sliderElecData[electrodeNum];
+
 	// Slider electrode touched ? z-axis touch detection
-	if (sliderLPFilterData[electrodeNum][frequencyID] < sliderDetectorThresholdTouch[electrodeNum])
+	if (sliderElecDataPtr->LPFilterData[scanFrequencyID] < sliderElecDataPtr->detectorThresholdTouch)
 
 	{
 		// y-axis touch confirmation
 		if (sliderAdditionData < sliderAdditionDataThreshold)
 		{
 			// Report touch detected and confirmed
-			sliderElectrodeTouch[electrodeNum][frequencyID] = 2;
+			sliderElecDataPtr->electrodeTouch[scanFrequencyID] = 2;
 
 			#ifdef WAKE_UP_ELECTRODE
 			// Load counter to do not return to the wake-up function
@@ -893,25 +1025,25 @@ void SliderElectrodeTouchDetect(uint32_t electrodeNum)
 		else
 		{
 			// Report touch detected, but not confirmed
-			sliderElectrodeTouch[electrodeNum][frequencyID] = 1;
+			sliderElecDataPtr->electrodeTouch[scanFrequencyID] = 1;
 		}
 	}
 	// Electrode released?
 	else
 	{
 		// Report released
-		sliderElectrodeTouch[electrodeNum][frequencyID] = 0;
+		sliderElecDataPtr->electrodeTouch[scanFrequencyID] = 0;
 	}
 
 	// Fast release detection
 	// Previously touched slider Electrode FAST RELEASED? z-axis touch detection
-	if (sliderElectrodeTouch[electrodeNum][frequencyID] > 1)
+	if (sliderElecDataPtr->electrodeTouch[scanFrequencyID] > 1)
 	{
 		// Slider electrode raw data risen above touch threshold?
-		if (sliderAdcDataElectrodeDischargeRaw[electrodeNum][frequencyID] > sliderDetectorThresholdTouch[electrodeNum])
+		if (sliderElecDataPtr->adcDataElectrodeDischargeRaw[scanFrequencyID] > sliderElecDataPtr->detectorThresholdTouch)
 		{
 			// Report released
-			sliderElectrodeTouch[electrodeNum][frequencyID] = 0;
+			sliderElecDataPtr->electrodeTouch[scanFrequencyID] = 0;
 		}
 	}
 }
@@ -924,9 +1056,6 @@ void SliderElectrodeTouchDetect(uint32_t electrodeNum)
  *****************************************************************************/
 void SliderElectrodesTouchElecSense(void)
 {
-	// Disable interrupts
-	DisableInterrupts;
-
 #ifndef WAKE_UP_ELECTRODE
 #ifdef DEBUG_ALGORITHM
 	// Pin clear
@@ -934,118 +1063,267 @@ void SliderElectrodesTouchElecSense(void)
 #endif
 #endif
 
-	// Configure all slider electrodes floating
-	for (elecNum = 0; elecNum < (NUMBER_OF_SLIDER_ELECTRODES); elecNum++)
-	{
-		ElectrodeFloat(&sliderElecStruct[elecNum]);
-	}
+	// Convert slider electrodes capacitance to equivalent voltage
+	SliderElectrodesTouchElecAcquire();
+
+	// Detect and qualify slider touch event
+	SliderElectrodesTouchProcess(frequencyID);
+
+#ifndef WAKE_UP_ELECTRODE
+#ifdef DEBUG_ALGORITHM
+	// Pin set
+	R_RMW32(&(DA_GPIO->PSOR), DA_PIN, 1);
+#endif
+#endif
+}
 
-	// Configure all touch button (and EGS) electrodes floating
-	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+/*****************************************************************************
+ *
+ * Function: void SliderElectrodesTouchElecAcquire(void)
+ *
+ * Description: Convert slider electrodes capacitance to equivalent voltage,
+ * 				electrodes floating during conversion and driven to GND afterwards
+ *
+ *****************************************************************************/
+void SliderElectrodesTouchElecAcquire(void)
+{
+	// Slider enabled? Disabled slider electrodes stay driven to GND
+	if (sliderEnabled == YES)
 	{
-	    ElectrodeFloat(&elecStruct[elecNum]);
-	}
+		// Configure all slider and touch button (and EGS) electrodes floating
+		ElectrodesFloatAll();
 
 #if (NUMBER_OF_USED_ADC_MODULES == 2)
-	// Convert slider electrodes capacitance to equivalent voltage simultaneously - at once
-	SliderSimultaneousElectrodeCapToVoltConvELCH(SLIDER_ELEC0, SLIDER_ELEC1);
+		// Convert slider electrodes capacitance to equivalent voltage simultaneously - at once
+		SliderSimultaneousElectrodeCapToVoltConvELCH(SLIDER_ELEC0, SLIDER_ELEC1);
 #else
-	// Convert Slider electrode capacitance to equivalent voltage one by one (the other slider electrode (and EGS) serve as a guard)
-	SliderElectrodeCapToVoltConvELCHGuard(SLIDER_ELEC0, SLIDER_ELEC1);
+		// Convert Slider electrode capacitance to equivalent voltage one by one (the other slider electrode (and EGS) serve as a guard)
+		SliderElectrodeCapToVoltConvELCHGuard(SLIDER_ELEC0, SLIDER_ELEC1);
 #endif
 
+		// Drive all slider and touch button (and EGS) electrodes to GND
+		ElectrodesGndAll();
+	}
+
+#if TS_DEFERRED_PROCESSING
+	// Scan acquired for deferred processing?
+	if (acqFramePtr != 0)
+	{
+		// Report slider scanned in the acquisition frame
+		acqFramePtr->sliderScanned = sliderEnabled;
+	}
+	else
+#endif
+	{
+		// Report slider scanned
+		sliderScanned = sliderEnabled;
+	}
+}
+
+/*****************************************************************************
+ *
+ * Function: void SliderElectrodesTouchProcess(uint8_t scanFrequencyID)
+ *
+ * Input: Scanning period/frequency ID of the scan
+ *
+ * Description: Process raw data of slider electrodes - DC tracker, IIR LP filter,
+ * 				slider data, touch detection and qualification
+ *
+ *****************************************************************************/
+void SliderElectrodesTouchProcess(uint8_t scanFrequencyID)
+{
+	uint32_t  elecNum;
+
+	// Apply slider enable change
+	SliderEnableUpdate();
+
+	// Slider disabled or not scanned in this period?
+	if ((sliderEnabled == NO) || (sliderScanned == NO))
+	{
+		return;
+	}
+
+	// Slider re-enabled?
+	if (sliderBaselineReseed == YES)
+	{
+		// Re-seed baseline and filters from the first raw data
+		SliderBaselineReseed(scanFrequencyID);
+	}
+
 	// All slider electrodes
 	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 	{
 		// Update DC Tracker, if both slider electrodes not touched
-		if (sliderElectrodeTouch[SLIDER_ELEC0][frequencyID] < 1 && sliderElectrodeTouch[SLIDER_ELEC1][frequencyID] < 1)
+		if (sliderElecData[SLIDER_ELEC0].electrodeTouch[scanFrequencyID] < 1 && sliderElecData[SLIDER_ELEC1].electrodeTouch[scanFrequencyID] < 1)
 		{
 			// Update DC Tracker
-			sliderDCTrackerDataBuffer[elecNum] = DCTracker(sliderAdcDataElectrodeDischargeRaw[elecNum][frequencyID], &(sliderDCTrackerDataBufferRaw[elecNum]), sliderDCTrackerDataShift[elecNum]);
+			sliderElecData[elecNum].DCTrackerDataBuffer = DCTracker(sliderElecData[elecNum].adcDataElectrodeDischargeRaw[scanFrequencyID], &(sliderElecData[elecNum].DCTrackerDataBufferRaw), sliderElecData[elecNum].DCTrackerDataShift, &(sliderElecData[elecNum].DCTrackerSlewRun));
+		}
+#if TS_DCTRACKER_ADAPTIVE_SLEW
+		else
+		{
+			// DC tracker frozen while touched, slew back to the slowest step
+			sliderElecData[elecNum].DCTrackerSlewRun = 0;
 		}
+#endif
 
 #if DECIMATION_FILTER
 		// Decimation filtering
-		SliderDecimationFilter(elecNum);
+		SliderDecimationFilter(elecNum, scanFrequencyID);
 #endif
 		// Calculate the relative touch threshold of the slider electrode
-		sliderDetectorThresholdTouch[elecNum] = sliderDCTrackerDataBuffer[elecNum] - sliderDetectorThresholdTouchDelta[elecNum];
+		sliderElecData[elecNum].detectorThresholdTouch = sliderElecData[elecNum].DCTrackerDataBuffer - sliderElecData[elecNum].detectorThresholdTouchDelta;
 	}
 
 	// All slider electrodes
-	for(elecNum = NUMBER_OF_ELECTRODES; elecNum < (NUMBER_OF_ELECTRODES + NUMBER_OF_SLIDER_ELECTRODES); elecNum++)
+	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 	{
 #if DECIMATION_FILTER
 		// Filter Slider electrode DF signal using IIR LP filter
-		sliderLPFilterData[(elecNum) - NUMBER_OF_ELECTRODES][frequencyID] = FilterIIR1(elecNum, (tFrac32)(sliderAdcDataElectrodeDischargeRawDF[(elecNum) - NUMBER_OF_ELECTRODES][frequencyID]), frequencyID);
+		sliderElecData[elecNum].LPFilterData[scanFrequencyID] = FilterIIR1(sliderElecData[elecNum].LPFilterType, &sliderElecData[elecNum].LPFilterBuffer[scanFrequencyID], (tFrac32)(sliderElecData[elecNum].adcDataElectrodeDischargeRawDF[scanFrequencyID]));
 #else
 		// Filter Slider electrode raw signal using IIR LP filter
-		sliderLPFilterData[(elecNum) - NUMBER_OF_ELECTRODES][frequencyID] = FilterIIR1(elecNum, (tFrac32)(sliderAdcDataElectrodeDischargeRaw[(elecNum) - NUMBER_OF_ELECTRODES][frequencyID]), frequencyID);
+		sliderElecData[elecNum].LPFilterData[scanFrequencyID] = FilterIIR1(sliderElecData[elecNum].LPFilterType, &sliderElecData[elecNum].LPFilterBuffer[scanFrequencyID], (tFrac32)(sliderElecData[elecNum].adcDataElectrodeDischargeRaw[scanFrequencyID]));
 #endif
 	}
 
 	// Calculate slider addition and difference data
-	SliderDataCalculation(SLIDER_ELEC0, SLIDER_ELEC1);
+	SliderDataCalculation(SLIDER_ELEC0, SLIDER_ELEC1, scanFrequencyID);
 
 	// All slider electrodes
 	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 	{
 		// Slider electrode touched?
-		SliderElectrodeTouchDetect(elecNum);
+		SliderElectrodeTouchDetect(elecNum, scanFrequencyID);
 	}
 
 	// Qualify the slider touch event - x-axis touch qualification
-	SliderDifferenceDataElectrodeTouchQualify(SLIDER_ELEC0, SLIDER_ELEC1);
+	SliderDifferenceDataElectrodeTouchQualify(SLIDER_ELEC0, SLIDER_ELEC1, scanFrequencyID);
+}
 
-	// Drive all Slider electrodes to GND
-	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
+/*****************************************************************************
+ *
+ * Function: void SliderEnableUpdate(void)
+ *
+ * Description: Apply slider enable requested in sliderEnable - disabled slider touch released,
+ * 				re-enabled slider baseline re-seeded on its next scan, electrodes pins mask
+ * 				rebuilt to keep disabled slider electrodes driven to GND
+ *
+ *****************************************************************************/
+void SliderEnableUpdate(void)
+{
+	uint32_t  elecNum;
+	uint8_t   frequencyNum;
+
+	// Slider enable changed?
+	if (sliderEnable != sliderEnabled)
 	{
-		ElectrodeGnd(&sliderElecStruct[elecNum]);
+		// Apply enable
+		sliderEnabled = sliderEnable;
+
+		// Slider enabled?
+		if (sliderEnabled == YES)
+		{
+			// Re-seed baseline on the next scan
+			sliderBaselineReseed = YES;
+		}
+		else
+		{
+			// All slider electrodes
+			for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
+			{
+				// All used scanning frequencies
+				for (frequencyNum = 0; frequencyNum < NUMBER_OF_HOPPING_FREQUENCIES; frequencyNum++)
+				{
+					// Released
+					sliderElecData[elecNum].electrodeTouch[frequencyNum] = 0;
+				}
+			}
+
+			// Report slider electrode release for flextimer for background lightning and for jumping to VLPS
+			sliderElectrodeTouchQualifiedReport = 0;
+			// Report no slider qualified touch
+			sliderElectrodeTouchQualified = 0;
+			// Reset the firstSliderTouch variable
+			firstSliderTouch = TRUE;
+		}
+
+		// Float enabled electrodes only
+		ElectrodesPortMaskInit();
 	}
+}
 
-	// Drive all touch button (and EGS) electrodes to GND
-	for (elecNum = 0; elecNum < NUMBER_OF_ELECTRODES; elecNum++)
+/*****************************************************************************
+ *
+ * Function: void SliderBaselineReseed(uint8_t scanFrequencyID)
+ *
+ * Input: Scanning period/frequency ID of the scan
+ *
+ * Description: Load DC tracker, IIR LP filter and raw data of all scanning frequencies
+ * 				of slider electrodes with their first raw data after re-enabling
+ *
+ *****************************************************************************/
+void SliderBaselineReseed(uint8_t scanFrequencyID)
+{
+	uint32_t  elecNum;
+	uint8_t   frequencyNum;
+
+	// All slider electrodes
+	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 	{
-		ElectrodeGnd(&elecStruct[elecNum]);
-	}
-#ifndef WAKE_UP_ELECTRODE
-#ifdef DEBUG_ALGORITHM
-	// Pin set
-	R_RMW32(&(DA_GPIO->PSOR), DA_PIN, 1);
-#endif
+		// DC tracker data
+		sliderElecData[elecNum].DCTrackerDataBuffer = sliderElecData[elecNum].adcDataElectrodeDischargeRaw[scanFrequencyID];
+		// Load DC tracker buffer
+		sliderElecData[elecNum].DCTrackerDataBufferRaw = (sliderElecData[elecNum].DCTrackerDataBuffer) << (sliderElecData[elecNum].DCTrackerDataShift);
+		// DC tracker slowest step
+		sliderElecData[elecNum].DCTrackerSlewRun = 0;
+
+		// All used scanning frequencies
+		for (frequencyNum = 0; frequencyNum < NUMBER_OF_HOPPING_FREQUENCIES; frequencyNum++)
+		{
+			// Slider raw data preset as baseline
+			sliderElecData[elecNum].adcDataElectrodeDischargeRaw[frequencyNum] = sliderElecData[elecNum].DCTrackerDataBuffer;
+			// LP IIR filter buffer init
+			sliderElecData[elecNum].LPFilterData[frequencyNum] = sliderElecData[elecNum].DCTrackerDataBuffer;
+			FilterIIR1BufferInit(&sliderElecData[elecNum].LPFilterBuffer[frequencyNum], ((tFrac32)(sliderElecData[elecNum].DCTrackerDataBuffer)), ((tFrac32)(sliderElecData[elecNum].DCTrackerDataBuffer)));
+#if DECIMATION_FILTER
+			// Pre-load DF array
+			sliderElecData[elecNum].adcDataElectrodeDischargeRawDF[frequencyNum] = sliderElecData[elecNum].DCTrackerDataBuffer;
 #endif
+		}
+	}
 
-	// Enable interrupts
-	EnableInterrupts;
+	// Re-seeded
+	sliderBaselineReseed = NO;
 }
 
 /*****************************************************************************
  *
- * Function: void SliderDataCalculation(uint32_t sliderElectrode0Num,uint32_t sliderElectrode1Num)
+ * Function: void SliderDataCalculation(uint32_t sliderElectrode0Num,uint32_t sliderElectrode1Num, uint8_t scanFrequencyID)
  *
- * Input: Numbers of the slider electrodes pair (e.g. 0, 1)
+ * Input: Numbers of the slider electrodes pair (e.g. 0, 1), scanning period/frequency ID of the scan
  *
  * Description: Calculate slider differential and addition data (el0-el1 etc.)
  *
  *****************************************************************************/
-void SliderDataCalculation(uint32_t sliderElectrode0Num, uint32_t sliderElectrode1Num)
+void SliderDataCalculation(uint32_t sliderElectrode0Num, uint32_t sliderElectrode1Num, uint8_t scanFrequencyID)
 {
 	// Difference data
 	// Subtract the raw data from each other, normalize them with respect to their different baselines, and add SLIDER_DIFFADD_DATA_OFFSET (new baseline)
 	// el0-el1
-	sliderDifferenceData = (sliderAdcDataElectrodeDischargeRaw[sliderElectrode0Num][frequencyID] - sliderAdcDataElectrodeDischargeRaw[sliderElectrode1Num][frequencyID]) - (sliderDCTrackerDataBuffer[sliderElectrode0Num] - sliderDCTrackerDataBuffer[sliderElectrode1Num]);
+	sliderDifferenceData = (sliderElecData[sliderElectrode0Num].adcDataElectrodeDischargeRaw[scanFrequencyID] - sliderElecData[sliderElectrode1Num].adcDataElectrodeDischargeRaw[scanFrequencyID]) - (sliderElecData[sliderElectrode0Num].DCTrackerDataBuffer - sliderElecData[sliderElectrode1Num].DCTrackerDataBuffer);
 	sliderDifferenceData += SLIDER_DIFFADD_DATA_OFFSET;
 
 	// Difference data filtered
 	// Subtract the filtered data from each other, normalize them with respect to their different baselines, and add SLIDER_DIFFADD_DATA_OFFSET (new baseline)
 	// el0-el1
-	sliderDifferenceDataFiltered = (sliderLPFilterData[sliderElectrode0Num][frequencyID] - sliderLPFilterData[sliderElectrode1Num][frequencyID]) - (sliderDCTrackerDataBuffer[sliderElectrode0Num] - sliderDCTrackerDataBuffer[sliderElectrode1Num]);
+	sliderDifferenceDataFiltered = (sliderElecData[sliderElectrode0Num].LPFilterData[scanFrequencyID] - sliderElecData[sliderElectrode1Num].LPFilterData[scanFrequencyID]) - (sliderElecData[sliderElectrode0Num].DCTrackerDataBuffer - sliderElecData[sliderElectrode1Num].DCTrackerDataBuffer);
 	sliderDifferenceDataFiltered += SLIDER_DIFFADD_DATA_OFFSET;
 
 	// Addition data
 	// Add the raw data of both electrodes, normalize them with respect to their different baselines, and add SLIDER_DIFFADD_DATA_OFFSET (new baseline)
 	// el0+el1
-	sliderAdditionData = (sliderAdcDataElectrodeDischargeRaw[sliderElectrode0Num][frequencyID] + sliderAdcDataElectrodeDischargeRaw[sliderElectrode1Num][frequencyID]) - (sliderDCTrackerDataBuffer[sliderElectrode0Num] + sliderDCTrackerDataBuffer[sliderElectrode1Num]);
+	sliderAdditionData = (sliderElecData[sliderElectrode0Num].adcDataElectrodeDischargeRaw[scanFrequencyID] + sliderElecData[sliderElectrode1Num].adcDataElectrodeDischargeRaw[scanFrequencyID]) - (sliderElecData[sliderElectrode0Num].DCTrackerDataBuffer + sliderElecData[sliderElectrode1Num].DCTrackerDataBuffer);
 	sliderAdditionData += SLIDER_DIFFADD_DATA_OFFSET;
 
 	// Calculate slider absolute raw and filtered data value, slider resolution: approx. range 0-49 (50 values)
@@ -1055,23 +1333,23 @@ void SliderDataCalculation(uint32_t sliderElectrode0Num, uint32_t sliderElectrod
 
 /*****************************************************************************
  *
- * Function: void SliderDifferenceDataElectrodeTouchQualify (uint32_t sliderElectrode0Num,uint32_t sliderElectrode1Num)
+ * Function: void SliderDifferenceDataElectrodeTouchQualify (uint32_t sliderElectrode0Num,uint32_t sliderElectrode1Num, uint8_t scanFrequencyID)
  *
- * Input: Numbers of the slider electrodes pair (e.g. 0, 1)
+ * Input: Numbers of the slider electrodes pair (e.g. 0, 1), scanning period/frequency ID of the scan
  *
  * Description: Qualification of the slider touch event when using the differential data = ((el0-el1)-(el1-el0))
  *
  *****************************************************************************/
-void SliderDifferenceDataElectrodeTouchQualify (uint32_t sliderElectrode0Num, uint32_t sliderElectrode1Num)
+void SliderDifferenceDataElectrodeTouchQualify (uint32_t sliderElectrode0Num, uint32_t sliderElectrode1Num, uint8_t scanFrequencyID)
 {
 
 #if FREQUENCY_HOPPING
 	// At least one of the slider electrodes reported as touched AND the number of samples per cycle has been risen (from previous mcu duty cycle)
-	if (((sliderElectrodeTouch[sliderElectrode0Num][0] > 1 && sliderElectrodeTouch[sliderElectrode0Num][1] > 1) || (sliderElectrodeTouch[sliderElectrode1Num][0] > 1 && sliderElectrodeTouch[sliderElectrode1Num][1] > 1)) &&
-			numberOfElectrodeSensingCyclesPerSampleSlider == NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_ACTIVE && frequencyID == 1)
+	if (((sliderElecData[sliderElectrode0Num].electrodeTouch[0] > 1 && sliderElecData[sliderElectrode0Num].electrodeTouch[1] > 1) || (sliderElecData[sliderElectrode1Num].electrodeTouch[0] > 1 && sliderElecData[sliderElectrode1Num].electrodeTouch[1] > 1)) &&
+			numberOfElectrodeSensingCyclesPerSampleSlider == NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_ACTIVE && scanFrequencyID == 1)
 #else
 		// At least one of the slider electrodes reported as touched AND the number of samples per cycle has been risen (from previous mcu duty cycle)
-	if ((sliderElectrodeTouch[sliderElectrode0Num][frequencyID] > 1 || sliderElectrodeTouch[sliderElectrode1Num][frequencyID] > 1) &&
+	if ((sliderElecData[sliderElectrode0Num].electrodeTouch[scanFrequencyID] > 1 || sliderElecData[sliderElectrode1Num].electrodeTouch[scanFrequencyID] > 1) &&
 			numberOfElectrodeSensingCyclesPerSampleSlider == NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_ACTIVE)
 #endif
 	{
@@ -1213,7 +1491,7 @@ void SliderDifferenceDataElectrodeTouchQualify (uint32_t sliderElectrode0Num, ui
 	else
 	{
 #if FREQUENCY_HOPPING
-		if (frequencyID == 1)
+		if (scanFrequencyID == 1)
 #endif
 		{
 			// Report slider electrode release for flextimer for background lightning and for jumping to VLPS
@@ -1238,6 +1516,13 @@ void SliderDifferenceDataElectrodeTouchQualify (uint32_t sliderElectrode0Num, ui
 
 void SliderelectrodeWakeElecSense(void)
 {
+	uint32_t  elecNum;
+
+	// Slider disabled? Its electrodes stay driven to GND
+	if (sliderEnabled == NO)
+	{
+		return;
+	}
 
 #if (NUMBER_OF_USED_ADC_MODULES == 2)
 
@@ -1247,7 +1532,7 @@ void SliderelectrodeWakeElecSense(void)
 	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 	{
 		// Update DC Tracker of both slider electrodes
-		sliderDCTrackerDataBuffer[elecNum] = DCTracker(sliderAdcDataElectrodeDischargeRaw[elecNum][frequencyID], &(sliderDCTrackerDataBufferRaw[elecNum]), sliderDCTrackerDataShift[elecNum]);
+		sliderElecData[elecNum].DCTrackerDataBuffer = DCTracker(sliderElecData[elecNum].adcDataElectrodeDischargeRaw[frequencyID], &(sliderElecData[elecNum].DCTrackerDataBufferRaw), sliderElecData[elecNum].DCTrackerDataShift, &(sliderElecData[elecNum].DCTrackerSlewRun));
 	}
 
 #else
@@ -1257,7 +1542,7 @@ void SliderelectrodeWakeElecSense(void)
 	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 	{
 		// Update DC Tracker of both slider electrodes
-		sliderDCTrackerDataBuffer[elecNum] = DCTracker(sliderAdcDataElectrodeDischargeRaw[elecNum][frequencyID], &(sliderDCTrackerDataBufferRaw[elecNum]), sliderDCTrackerDataShift[elecNum]);
+		sliderElecData[elecNum].DCTrackerDataBuffer = DCTracker(sliderElecData[elecNum].adcDataElectrodeDischargeRaw[frequencyID], &(sliderElecData[elecNum].DCTrackerDataBufferRaw), sliderElecData[elecNum].DCTrackerDataShift, &(sliderElecData[elecNum].DCTrackerSlewRun));
 	}
 #endif
 
@@ -1272,136 +1557,22 @@ void SliderelectrodeWakeElecSense(void)
  *****************************************************************************/
 void SliderElectrodeWakeElecFilterLoad(void)
 {
+	uint32_t  elecNum;
+
 	// All slider electrodes
-	for (elecNum = NUMBER_OF_ELECTRODES; elecNum < (NUMBER_OF_ELECTRODES + NUMBER_OF_SLIDER_ELECTRODES); elecNum++)
+	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 	{
 		// Touch not detected nor confirmed on both slider electrodes?
-		if (sliderElectrodeTouch[SLIDER_ELEC0][frequencyID] < 1 && sliderElectrodeTouch[SLIDER_ELEC1][frequencyID] < 1)
+		if (sliderElecData[SLIDER_ELEC0].electrodeTouch[frequencyID] < 1 && sliderElecData[SLIDER_ELEC1].electrodeTouch[frequencyID] < 1)
 		{
 		// Load IIR1 LP Filter buffer (X, Y) with (sliderDCTracker - threshold / 2)
-		FilterIIR1BufferInit(elecNum, ((tFrac32)(sliderDCTrackerDataBuffer[(elecNum) - NUMBER_OF_ELECTRODES] - (sliderDetectorThresholdTouchDelta[(elecNum) - NUMBER_OF_ELECTRODES] / 2))), \
-				((tFrac32)((sliderDCTrackerDataBuffer[(elecNum) - NUMBER_OF_ELECTRODES]- (sliderDetectorThresholdTouchDelta[(elecNum) - NUMBER_OF_ELECTRODES] / 2)))), frequencyID);
+		FilterIIR1BufferInit(&sliderElecData[elecNum].LPFilterBuffer[frequencyID], ((tFrac32)(sliderElecData[elecNum].DCTrackerDataBuffer - (sliderElecData[elecNum].detectorThresholdTouchDelta / 2))), \
+				((tFrac32)((sliderElecData[elecNum].DCTrackerDataBuffer- (sliderElecData[elecNum].detectorThresholdTouchDelta / 2)))));
 
 		}
 	}
 
 }
-#if SLIDER_NOISE_CANCELING
-/*****************************************************************************
- *
- * Function: void SliderNoiseCanceling(void)
- *
- * Description: Slider noise canceling function
- *
- *****************************************************************************/
-void SliderNoiseCanceling(void)
-{
-	switch(NUMBER_OF_USED_ADC_MODULES)
-	{
-	case 2:
-	{
-		// Find minimal sample values for each electrode and cancel it
-		if(numberOfElectrodeSensingCyclesPerSampleSlider == NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_ACTIVE)
-		{
-
-			for(sampleNum=0; sampleNum < 1; sampleNum++)
-			{
-				FindMinimumAndDeleteIt(sliderAdcDataElectrodeDischargeRawSampleElec0);
-				FindMinimumAndDeleteIt(sliderAdcDataElectrodeDischargeRawSampleElec1);
-			}
-			sliderDroppedSamples = 1;
-		}
-		else
-
-			sliderDroppedSamples = 0;
-	}
-	break;
-
-	case 1:
-	{
-		// Find minimal sample values for each electrode and cancel it
-		if(numberOfElectrodeSensingCyclesPerSampleSlider == NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_ACTIVE)
-		{
-
-			for(sampleNum=0; sampleNum<1; sampleNum++)
-			{
-				FindMinimumAndDeleteIt(sliderAdcDataElectrodeDischargeRawSample);
-			}
-			sliderDroppedSamples = 1;
-		}
-		else
-
-			sliderDroppedSamples = 0;
-
-	}
-	break;
-	}
-
-}
-/*****************************************************************************
- *
- * Function: void FindMinimumAndDeleteIt(int16_t sliderInputSamplesArray[])
- *
- * Input: Array of ADC cycles (scans) for one averaged sample
- *
- * Description: Finds minimum element in an array and deletes it, can be used multiple times
- *
- *****************************************************************************/
-void FindMinimumAndDeleteIt(int16_t sliderInputSamplesArray[])
-{
-
-	int16_t min, index, i, sampleNum;
-	i = 0;
-
-	do
-	{
-		min = sliderInputSamplesArray[NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE+i];//set the minimum on [1] place in the array
-		index = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE+i;
-		i++;
-	}while(min == 0);// While the minimum is zero, try  next element
-
-	for (sampleNum = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE; sampleNum < (NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSampleSlider); sampleNum++)
-	{
-		//if the array element is smaller than the set minimum and is not 0
-		if (sliderInputSamplesArray[sampleNum] < min && sliderInputSamplesArray[sampleNum] > 0)
-		{
-			index = sampleNum;
-			min = sliderInputSamplesArray[sampleNum];
-		}
-	}
-
-	sliderInputSamplesArray[index] = 0;// Delete that minimum element
-}
-
-/*****************************************************************************
- *
- * Function: void FindMaximumAndDeleteIt(int16_t sliderInputSamplesArray[])
- *
- * Input: Array of ADC cycles (scans) for one averaged sample
- *
- * Description: Finds maximum element in an array and deletes it, can be used multiple times
- *
- *****************************************************************************/
-void FindMaximumAndDeleteIt(int16_t sliderInputSamplesArray[])
-{
-
-	int16_t max, index, sampleNum;
-
-	max = sliderInputSamplesArray[NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE];
-	index = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE;
-
-	for (sampleNum = NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE; sampleNum < NUMBER_OF_ELECTRODE_SENSING_PRECYCLES_PER_SAMPLE + numberOfElectrodeSensingCyclesPerSampleSlider; sampleNum++)
-	{
-		if (sliderInputSamplesArray[sampleNum] > max)
-		{
-			index = sampleNum;
-			max = sliderInputSamplesArray[sampleNum];
-		}
-	}
-
-	sliderInputSamplesArray[index] = 0;
-}
-#endif
 
 #ifdef WAKE_UP_ELECTRODE
 /*****************************************************************************
@@ -1413,7 +1584,7 @@ void FindMaximumAndDeleteIt(int16_t sliderInputSamplesArray[])
  *****************************************************************************/
 void SliderSensingCyclesChangeEGS(void)
 {
-	if(electrodeTouch[WAKE_UP_ELECTRODE][0] == 1)
+	if(elecData[WAKE_UP_ELECTRODE].electrodeTouch[0] == 1)
 	{
 		// Change the number of slider sensing cycles per sample to active
 		numberOfElectrodeSensingCyclesPerSampleSlider = NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_ACTIVE;
@@ -1427,25 +1598,36 @@ void SliderSensingCyclesChangeEGS(void)
 #else
 /*****************************************************************************
  *
- * Function: void SliderSensingCyclesChange(void)
+ * Function: void SliderSensingCyclesChange(uint8_t scanFrequencyID)
+ *
+ * Input: Scanning period/frequency ID of the scan
  *
  * Description: Changes the number of sensing cycles per sample for slider electrodes
  *
  *****************************************************************************/
-void SliderSensingCyclesChange(void)
+void SliderSensingCyclesChange(uint8_t scanFrequencyID)
 {
+#if (TS_RAW_DATA_CALCULATION == OVERSAMPLING)
+	uint32_t  elecNum;
+	uint8_t   frequencyNum;
+#endif
 	uint8_t electrodeNum;
 
+#if FREQUENCY_HOPPING
+	// Proximity checked on both periods/frequencies, scan ID not used
+	(void)scanFrequencyID;
+#endif
+
 	// Detect if any of the slider electrodes was reported as proximately touched
 	for(electrodeNum = 0; electrodeNum < NUMBER_OF_SLIDER_ELECTRODES; electrodeNum++)
 	{
 #if FREQUENCY_HOPPING
 		// If on both frequencies proximity detected
-		if((sliderLPFilterData[electrodeNum][0] < (sliderDCTrackerDataBuffer[electrodeNum] - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)) &&  \
-				(sliderLPFilterData[electrodeNum][1] < (sliderDCTrackerDataBuffer[electrodeNum] - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)))
+		if((sliderElecData[electrodeNum].LPFilterData[0] < (sliderElecData[electrodeNum].DCTrackerDataBuffer - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)) &&  \
+				(sliderElecData[electrodeNum].LPFilterData[1] < (sliderElecData[electrodeNum].DCTrackerDataBuffer - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)))
 #else
 			// If proximity detected
-			if(sliderLPFilterData[electrodeNum][frequencyID] < (sliderDCTrackerDataBuffer[electrodeNum] - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA))
+			if(sliderElecData[electrodeNum].LPFilterData[scanFrequencyID] < (sliderElecData[electrodeNum].DCTrackerDataBuffer - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA))
 #endif
 			{
 				// Report wake up
@@ -1471,45 +1653,36 @@ void SliderSensingCyclesChange(void)
 						for(elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 						{
 							// Set slider Threshold delta values to correspond to number of samples taken in Active state
-							sliderDetectorThresholdTouchDelta[elecNum] *= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_MULTIPLY;
+							sliderElecData[elecNum].detectorThresholdTouchDelta *= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_MULTIPLY;
 						}
 
-						// Save frequencyID
-						frequencyIDsave = frequencyID;
 
 						// All (both) used scanning frequencies
-						for (frequencyID = 0; frequencyID < NUMBER_OF_HOPPING_FREQUENCIES; frequencyID++)
+						for (frequencyNum = 0; frequencyNum < NUMBER_OF_HOPPING_FREQUENCIES; frequencyNum++)
 						{
 							// All slider electrodes
-							for(elecNum = NUMBER_OF_ELECTRODES; elecNum < (NUMBER_OF_ELECTRODES + NUMBER_OF_SLIDER_ELECTRODES); elecNum++)
+							for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 							{
 								// Load IIR1 LP Filter buffer (X, Y) exactly with corresponding value
-								FilterIIR1BufferInit(elecNum, ((tFrac32)(sliderDCTrackerDataBuffer[elecNum - NUMBER_OF_ELECTRODES] - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)), \
-										((tFrac32)(sliderDCTrackerDataBuffer[elecNum - NUMBER_OF_ELECTRODES] - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)), frequencyID);
+								FilterIIR1BufferInit(&sliderElecData[elecNum].LPFilterBuffer[frequencyNum], ((tFrac32)(sliderElecData[elecNum].DCTrackerDataBuffer - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)), \
+										((tFrac32)(sliderElecData[elecNum].DCTrackerDataBuffer - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA)));
 							}
 						}
-						// Set back original frequencyID
-						frequencyID = frequencyIDsave;
 
 						// Set the slider addition data threshold of y-direction false touch canceling with respect to active mode
 						sliderAdditionDataThreshold = SLIDER_ADDITION_DATA_THRESHOLD_DEFAULT;
 
 #if DECIMATION_FILTER
-						// Save frequencyID
-						frequencyIDsave = frequencyID;
-
 						// All (both) used scanning frequencies
-						for (frequencyID = 0; frequencyID < NUMBER_OF_HOPPING_FREQUENCIES; frequencyID++)
+						for (frequencyNum = 0; frequencyNum < NUMBER_OF_HOPPING_FREQUENCIES; frequencyNum++)
 						{
 							// All slider electrodes
 							for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 							{
 								// Load DF array exactly with corresponding value
-								sliderAdcDataElectrodeDischargeRawDF[elecNum][frequencyID] = sliderDCTrackerDataBuffer[elecNum] - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA;
+								sliderElecData[elecNum].adcDataElectrodeDischargeRawDF[frequencyNum] = sliderElecData[elecNum].DCTrackerDataBuffer - VIRTUAL_EGS_TOUCH_THRESHOLD_DELTA;
 							}
 						}
-						// Set back original frequencyID
-						frequencyID = frequencyIDsave;
 #endif
 
 					}
@@ -1543,50 +1716,41 @@ void SliderSensingCyclesChange(void)
 							for(elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 							{
 								// Set slider Threshold delta values to correspond to number of samples taken in Active state
-								sliderDetectorThresholdTouchDelta[elecNum] /= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_MULTIPLY;
+								sliderElecData[elecNum].detectorThresholdTouchDelta /= NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_MULTIPLY;
 							}
 
 							// Set the slider addition data threshold of y-direction false touch canceling with respect to idle mode
 							sliderAdditionDataThreshold = SLIDER_DIFFADD_DATA_OFFSET;
 							for(elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 							{
-								sliderAdditionDataThreshold -= sliderDetectorThresholdTouchDelta[elecNum];
+								sliderAdditionDataThreshold -= sliderElecData[elecNum].detectorThresholdTouchDelta;
 							}
-							// Save frequencyID
-							frequencyIDsave = frequencyID;
 
 							// Load DF array with new DC tracker value
-							for (frequencyID = 0; frequencyID < NUMBER_OF_HOPPING_FREQUENCIES; frequencyID++)
+							for (frequencyNum = 0; frequencyNum < NUMBER_OF_HOPPING_FREQUENCIES; frequencyNum++)
 							{
 								// All slider electrodes
-								for(elecNum = NUMBER_OF_ELECTRODES; elecNum < (NUMBER_OF_ELECTRODES + NUMBER_OF_SLIDER_ELECTRODES); elecNum++)
+								for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 								{
 									// Load IIR1 LP Filter buffer (X, Y) with DC tracker value
-									FilterIIR1BufferInit(elecNum, ((tFrac32)(sliderDCTrackerDataBuffer[elecNum - NUMBER_OF_ELECTRODES])), \
-											((tFrac32)(sliderDCTrackerDataBuffer[elecNum - NUMBER_OF_ELECTRODES])), frequencyID);
+									FilterIIR1BufferInit(&sliderElecData[elecNum].LPFilterBuffer[frequencyNum], ((tFrac32)(sliderElecData[elecNum].DCTrackerDataBuffer)), \
+											((tFrac32)(sliderElecData[elecNum].DCTrackerDataBuffer)));
 								}
 							}
-							// Set back original frequencyID
-							frequencyID = frequencyIDsave;
 							// Report electrodes Oversampling de-activation done
 							sliderOversamplingActivationReport = 0;
 
 #if DECIMATION_FILTER
-							// Save frequencyID
-							frequencyIDsave = frequencyID;
-
 							// All (both) used scanning frequencies
-							for (frequencyID = 0; frequencyID < NUMBER_OF_HOPPING_FREQUENCIES; frequencyID++)
+							for (frequencyNum = 0; frequencyNum < NUMBER_OF_HOPPING_FREQUENCIES; frequencyNum++)
 							{
 								// All slider electrodes
 								for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 								{
 									// Load DF array with new DC tracker value
-									sliderAdcDataElectrodeDischargeRawDF[elecNum][frequencyID] = sliderDCTrackerDataBuffer[elecNum];
+									sliderElecData[elecNum].adcDataElectrodeDischargeRawDF[frequencyNum] = sliderElecData[elecNum].DCTrackerDataBuffer;
 								}
 							}
-							// Set back original frequencyID
-							frequencyID = frequencyIDsave;
 #endif
 						}
 #endif
@@ -1618,39 +1782,39 @@ void SliderSensingCyclesChange(void)
  *****************************************************************************/
 void SliderElecOversamplingActivation(void)
 {
+	uint32_t  elecNum;
+#if DECIMATION_FILTER
+	uint8_t   frequencyNum;
+#endif
+
 	// All slider electrodes
 	for(elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 	{
 		// Load new shift to update the DC tracker
-		sliderDCTrackerDataShift[elecNum] = SLIDER_ELEC_DCTRACKER_FILTER_FACTOR_ACTIVE;
+		sliderElecData[elecNum].DCTrackerDataShift = SLIDER_ELEC_DCTRACKER_FILTER_FACTOR_ACTIVE;
 	}
 
 	// Load new shift to update the DC tracker
 	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 	{
 		// Set DCTracker value to correspond to number of samples taken in Active state
-		sliderDCTrackerDataBuffer[elecNum] = sliderDCTrackerDataBuffer[elecNum] * NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_MULTIPLY;
+		sliderElecData[elecNum].DCTrackerDataBuffer = sliderElecData[elecNum].DCTrackerDataBuffer * NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_MULTIPLY;
 
 		// Load DC tracker buffer
-		sliderDCTrackerDataBufferRaw[elecNum] = (sliderDCTrackerDataBuffer[elecNum]) << ((sliderDCTrackerDataShift[elecNum]));
+		sliderElecData[elecNum].DCTrackerDataBufferRaw = (sliderElecData[elecNum].DCTrackerDataBuffer) << ((sliderElecData[elecNum].DCTrackerDataShift));
 	}
 
 		#if DECIMATION_FILTER
-		   // Save frequencyID
-		   frequencyIDsave = frequencyID;
-
 		   // All (both) used scanning frequencies
-			for (frequencyID = 0; frequencyID < NUMBER_OF_HOPPING_FREQUENCIES; frequencyID++)
+			for (frequencyNum = 0; frequencyNum < NUMBER_OF_HOPPING_FREQUENCIES; frequencyNum++)
 			{
 				// All slider electrodes
 				for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 				{
 					// Load DF array with DC tracker value  - used when oversampling with EGS
-					sliderAdcDataElectrodeDischargeRawDF[elecNum][frequencyID] = sliderDCTrackerDataBuffer[elecNum];
+					sliderElecData[elecNum].adcDataElectrodeDischargeRawDF[frequencyNum] = sliderElecData[elecNum].DCTrackerDataBuffer;
 				}
 			}
-			// Set back original frequencyID
-			frequencyID = frequencyIDsave;
 		#endif
 }
 
@@ -1663,20 +1827,22 @@ void SliderElecOversamplingActivation(void)
  *****************************************************************************/
 void SliderElecOversamplingDeactivation(void)
 {
+	uint32_t  elecNum;
+
 	// All slider electrodes
 	for (elecNum = 0; elecNum < NUMBER_OF_SLIDER_ELECTRODES; elecNum++)
 	{
 		// Update DC tracker shift
-		sliderDCTrackerDataShift[elecNum] = SLIDER_ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
+		sliderElecData[elecNum].DCTrackerDataShift = SLIDER_ELEC_DCTRACKER_FILTER_FACTOR_IDLE;
 
 		// Set DCTracker value to correspond to number of samples taken in Active state
-		sliderDCTrackerDataBuffer[elecNum] = sliderDCTrackerDataBuffer[elecNum] / NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_MULTIPLY;
+		sliderElecData[elecNum].DCTrackerDataBuffer = sliderElecData[elecNum].DCTrackerDataBuffer / NUMBER_OF_ELECTRODE_SENSING_CYCLES_PER_SAMPLE_SLIDER_MULTIPLY;
 
 		// Load DC tracker buffer
-		sliderDCTrackerDataBufferRaw[elecNum] = (sliderDCTrackerDataBuffer[elecNum]) << ((sliderDCTrackerDataShift[elecNum]));
+		sliderElecData[elecNum].DCTrackerDataBufferRaw = (sliderElecData[elecNum].DCTrackerDataBuffer) << ((sliderElecData[elecNum].DCTrackerDataShift));
 
 		// Slider electrode threshold
-		sliderDetectorThresholdTouch[elecNum] = sliderDCTrackerDataBuffer[elecNum] - sliderDetectorThresholdTouchDelta[elecNum];
+		sliderElecData[elecNum].detectorThresholdTouch = sliderElecData[elecNum].DCTrackerDataBuffer - sliderElecData[elecNum].detectorThresholdTouchDelta;
 	}
 
 }
@@ -1685,21 +1851,23 @@ void SliderElecOversamplingDeactivation(void)
 #if DECIMATION_FILTER
 /*****************************************************************************
  *
- * Function: void SliderDecimationFilter(uint32_t electrodeNum)
+ * Function: void SliderDecimationFilter(uint32_t electrodeNum, uint8_t scanFrequencyID)
+ *
+ * Input: Electrode number, scanning period/frequency ID of the scan
  *
  * Description: Incerement or decrement decimation filter value
  *
  *****************************************************************************/
-void SliderDecimationFilter(uint32_t electrodeNum)
+void SliderDecimationFilter(uint32_t electrodeNum, uint8_t scanFrequencyID)
 {
 		// Is the electrode raw data value still smaller than electrode decimation filter value?
-		if(sliderAdcDataElectrodeDischargeRaw[electrodeNum][frequencyID] < sliderAdcDataElectrodeDischargeRawDF[electrodeNum][frequencyID])
+		if(sliderElecData[electrodeNum].adcDataElectrodeDischargeRaw[scanFrequencyID] < sliderElecData[electrodeNum].adcDataElectrodeDischargeRawDF[scanFrequencyID])
 		{
 			// Decrement DF value - follow the raw data down
-			sliderAdcDataElectrodeDischargeRawDF[electrodeNum][frequencyID] -= DECIMATION_STEP ;
+			sliderElecData[electrodeNum].adcDataElectrodeDischargeRawDF[scanFrequencyID] -= DECIMATION_STEP ;
 		}
 		// Is the electrode raw data value same as electrode decimation filter value?
-		else if ((sliderAdcDataElectrodeDischargeRaw[electrodeNum][frequencyID] == sliderAdcDataElectrodeDischargeRawDF[electrodeNum][frequencyID]))
+		else if ((sliderElecData[electrodeNum].adcDataElectrodeDischargeRaw[scanFrequencyID] == sliderElecData[electrodeNum].adcDataElectrodeDischargeRawDF[scanFrequencyID]))
 		{
 			// Do nothing
 		}
@@ -1707,7 +1875,7 @@ void SliderDecimationFilter(uint32_t electrodeNum)
 		else
 		{
 			// Increment DF value - follow  the raw data back up to the baseline
-			sliderAdcDataElectrodeDischargeRawDF[electrodeNum][frequencyID] += DECIMATION_STEP;
+			sliderElecData[electrodeNum].adcDataElectrodeDischargeRawDF[scanFrequencyID] += DECIMATION_STEP;
 		}
 }
 